@@ -0,0 +1,161 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <DataFrame/DataFrame.h>
+#include <DataFrame/RandGen.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr std::size_t   ALIGNMENT = 64;
+constexpr std::size_t   SIZE = 2000000;
+constexpr std::size_t   ITERATIONS = 3;
+
+typedef StdDataFrame64<unsigned long> MyDataFrame;
+
+// -----------------------------------------------------------------------------
+
+static double
+read_mbps(const char *file_name, std::size_t file_size, bool from_stream)  {
+
+    double  best = 0;
+
+    for (std::size_t i = 0; i < ITERATIONS; ++i)  {
+        MyDataFrame df;
+        const auto  start = high_resolution_clock::now();
+
+        if (from_stream)  {
+            std::ifstream   stream (file_name);
+
+            df.read(stream, io_format::csv2);
+        }
+        else
+            df.read(file_name, io_format::csv2);
+
+        const auto      end = high_resolution_clock::now();
+        const double    secs =
+            double(duration_cast<microseconds>(end - start).count()) /
+            1000000.0;
+        const double    mbps = double(file_size) / (1024.0 * 1024.0) / secs;
+
+        if (df.get_index().size() != SIZE)  {
+            std::cout << "Unexpected number of rows: "
+                      << df.get_index().size() << std::endl;
+            return (0);
+        }
+        if (mbps > best)  best = mbps;
+    }
+    return (best);
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int, char *[]) {
+
+    const std::string   file_name =
+        (std::filesystem::temp_directory_path() /
+         "hmdf_csv2_read_performance.csv").string();
+
+    {
+        MyDataFrame             df;
+        RandGenParams<double>   p;
+
+        p.seed = 123;
+        df.load_data(
+            MyDataFrame::gen_sequence_index(0, SIZE, 1),
+            std::make_pair("normal",
+                           gen_normal_dist<double, ALIGNMENT>(SIZE, p)),
+            std::make_pair("uniform",
+                           gen_uniform_real_dist<double, ALIGNMENT>(SIZE, p)));
+
+        auto    &normal = df.get_column<double>("normal");
+        MyDataFrame::StlVecType<long>           longs(SIZE);
+        MyDataFrame::StlVecType<int>            ints(SIZE);
+        MyDataFrame::StlVecType<std::string>    strs(SIZE);
+
+        for (std::size_t i = 0; i < SIZE; ++i)  {
+            longs[i] = long(normal[i] * 1000000.0);
+            ints[i] = int(i % 1000);
+            strs[i] = "str_" + std::to_string(i % 5000);
+        }
+        df.load_column("long", std::move(longs));
+        df.load_column("int", std::move(ints));
+        df.load_column("string", std::move(strs));
+
+        const auto  start = high_resolution_clock::now();
+
+        df.write<double, long, int, std::string>(file_name.c_str(),
+                                                 io_format::csv2);
+
+        const auto  end = high_resolution_clock::now();
+
+        std::cout << "Data generation/write time: "
+                  << double(duration_cast<microseconds>(end - start).count()) /
+                         1000000.0
+                  << " secs" << std::endl;
+    }
+
+    const std::size_t   file_size = std::filesystem::file_size(file_name);
+
+    std::cout << "File size: "
+              << double(file_size) / (1024.0 * 1024.0) << " MB" << std::endl;
+
+    MyDataFrame::set_thread_level(0);
+    std::cout << "Stream read: "
+              << read_mbps(file_name.c_str(), file_size, true) << " MB/s"
+              << std::endl;
+    std::cout << "Serial read: "
+              << read_mbps(file_name.c_str(), file_size, false) << " MB/s"
+              << std::endl;
+
+    MyDataFrame::set_optimum_thread_level();
+    if (MyDataFrame::get_thread_level() < 3)
+        MyDataFrame::set_thread_level(4);
+    std::cout << "Parallel read (" << MyDataFrame::get_thread_level()
+              << " threads): "
+              << read_mbps(file_name.c_str(), file_size, false) << " MB/s"
+              << std::endl;
+
+    std::remove(file_name.c_str());
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,260 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <DataFrame/DataFrame.h>
+#include <DataFrame/DataFrameStatsVisitors.h>
+#include <DataFrame/RandGen.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr std::size_t   ALIGNMENT = 64;
+
+typedef StdDataFrame64<unsigned long> MyDataFrame;
+
+// -----------------------------------------------------------------------------
+
+static double
+secs_since(const high_resolution_clock::time_point &start)  {
+
+    const auto  end = high_resolution_clock::now();
+
+    return (double(duration_cast<microseconds>(end - start).count()) /
+            1000000.0);
+}
+
+// -----------------------------------------------------------------------------
+
+// It looks like a day of minute bars for many symbols, shuffled
+//
+static MyDataFrame
+make_df(std::size_t size, long symbol_cnt)  {
+
+    MyDataFrame             df;
+    RandGenParams<long>     p;
+
+    p.seed = 123;
+    p.min_value = 0;
+    p.max_value = symbol_cnt - 1;
+
+    auto                        symbols =
+        gen_uniform_int_dist<long, ALIGNMENT>(size, p);
+    MyDataFrame::StlVecType<long>   minutes(size);
+    MyDataFrame::StlVecType<long>   ids(size);
+
+    p.seed = 456;
+    p.min_value = 0;
+    p.max_value = 389;
+
+    const auto  rand_minutes = gen_uniform_int_dist<long, ALIGNMENT>(size, p);
+
+    for (std::size_t i = 0; i < size; ++i)  {
+        minutes[i] = rand_minutes[i];
+        ids[i] = symbols[i] * 390 + minutes[i];
+    }
+
+    p.seed = 789;
+    p.min_value = 0;
+    p.max_value = 1000;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, size, 1),
+                 std::make_pair("symbol", std::move(symbols)),
+                 std::make_pair("minute", std::move(minutes)),
+                 std::make_pair("bar_id", std::move(ids)),
+                 std::make_pair("volume",
+                                gen_uniform_int_dist<long, ALIGNMENT>(size,
+                                                                      p)));
+    return (df);
+}
+
+// -----------------------------------------------------------------------------
+
+static MyDataFrame
+groupby_bar_id(const MyDataFrame &df, groupby_policy policy, double &secs)  {
+
+    const auto  start = high_resolution_clock::now();
+    auto        res =
+        df.groupby1<long>(policy,
+                          "bar_id",
+                          LastVisitor<unsigned long, unsigned long>(),
+                          std::make_tuple("volume", "sum_volume",
+                                          SumVisitor<long>()),
+                          std::make_tuple("volume", "max_volume",
+                                          MaxVisitor<long>()));
+
+    secs = secs_since(start);
+    return (res);
+}
+
+// -----------------------------------------------------------------------------
+
+static MyDataFrame
+groupby_symbol_minute(const MyDataFrame &df,
+                      groupby_policy policy,
+                      double &secs)  {
+
+    const auto  start = high_resolution_clock::now();
+    auto        res =
+        df.groupby2<long, long>(policy,
+                                "symbol",
+                                "minute",
+                                LastVisitor<unsigned long, unsigned long>(),
+                                std::make_tuple("volume", "sum_volume",
+                                                SumVisitor<long>()),
+                                std::make_tuple("volume", "max_volume",
+                                                MaxVisitor<long>()));
+
+    secs = secs_since(start);
+    return (res);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename F>
+static void
+compare(const MyDataFrame &df, const char *name, F &&groupby_func)  {
+
+    double              sort_secs;
+    double              hash_secs;
+    double              unsorted_secs;
+    const MyDataFrame   sort_res =
+        groupby_func(df, groupby_policy::sort, sort_secs);
+    const MyDataFrame   hash_res =
+        groupby_func(df, groupby_policy::hash_sorted, hash_secs);
+    const MyDataFrame   unsorted_res =
+        groupby_func(df, groupby_policy::hash_unsorted, unsorted_secs);
+
+    std::cout << name << " (" << sort_res.get_index().size()
+              << " groups):\n"
+              << "    sort:          " << sort_secs << " secs\n"
+              << "    hash_sorted:   " << hash_secs << " secs ("
+              << sort_secs / hash_secs << "x)\n"
+              << "    hash_unsorted: " << unsorted_secs << " secs ("
+              << sort_secs / unsorted_secs << "x)" << std::endl;
+
+    if (sort_res.get_column<long>("sum_volume") !=
+            hash_res.get_column<long>("sum_volume") ||
+        sort_res.get_column<long>("max_volume") !=
+            hash_res.get_column<long>("max_volume") ||
+        sort_res.get_index().size() != unsorted_res.get_index().size())
+        std::cout << "    Results don't match" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+// Two summaries of the same groups. Once by calling groupby1() twice and
+// once by finding the groups once and reusing them.
+//
+static void
+reuse_grouping(const MyDataFrame &df, groupby_policy policy)  {
+
+    auto        start = high_resolution_clock::now();
+    const auto  sum1 =
+        df.groupby1<long>(policy,
+                          "bar_id",
+                          LastVisitor<unsigned long, unsigned long>(),
+                          std::make_tuple("volume", "sum_volume",
+                                          SumVisitor<long>()));
+    const auto  max1 =
+        df.groupby1<long>(policy,
+                          "bar_id",
+                          LastVisitor<unsigned long, unsigned long>(),
+                          std::make_tuple("volume", "max_volume",
+                                          MaxVisitor<long>()));
+    const double    twice_secs = secs_since(start);
+
+    start = high_resolution_clock::now();
+
+    const auto  grouping = df.get_grouping1<long>("bar_id", policy);
+    const auto  sum2 =
+        df.groupby(grouping,
+                   LastVisitor<unsigned long, unsigned long>(),
+                   std::make_tuple("volume", "sum_volume",
+                                   SumVisitor<long>()));
+    const auto  max2 =
+        df.groupby(grouping,
+                   LastVisitor<unsigned long, unsigned long>(),
+                   std::make_tuple("volume", "max_volume",
+                                   MaxVisitor<long>()));
+    const double    reuse_secs = secs_since(start);
+
+    std::cout << "Two summaries of bar_id (" << grouping.group_count()
+              << " groups):\n"
+              << "    groupby1() twice: " << twice_secs << " secs\n"
+              << "    reused grouping:  " << reuse_secs << " secs ("
+              << twice_secs / reuse_secs << "x)" << std::endl;
+
+    if (sum1.get_column<long>("sum_volume") !=
+            sum2.get_column<long>("sum_volume") ||
+        max1.get_column<long>("max_volume") !=
+            max2.get_column<long>("max_volume"))
+        std::cout << "    Results don't match" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+
+    const std::size_t   size =
+        argc > 1 ? std::size_t(std::atol(argv[1])) : 10000000;
+    const long          symbol_cnt = argc > 2 ? std::atol(argv[2]) : 5000;
+
+    std::cout << "Grouping " << size << " rows of " << symbol_cnt
+              << " symbols" << std::endl;
+
+    const MyDataFrame   df = make_df(size, symbol_cnt);
+
+    MyDataFrame::set_thread_level(0);
+    std::cout << "Single thread:" << std::endl;
+    compare(df, "groupby1(bar_id)", groupby_bar_id);
+    compare(df, "groupby2(symbol, minute)", groupby_symbol_minute);
+    reuse_grouping(df, groupby_policy::hash_sorted);
+
+    // The visitors are all mergeable, so groups are aggregated in parallel
+    //
+    MyDataFrame::set_optimum_thread_level();
+    if (MyDataFrame::get_thread_level() > 2)  {
+        std::cout << "With " << MyDataFrame::get_thread_level()
+                  << " threads:" << std::endl;
+        compare(df, "groupby1(bar_id)", groupby_bar_id);
+        compare(df, "groupby2(symbol, minute)", groupby_symbol_minute);
+    }
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
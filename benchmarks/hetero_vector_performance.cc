@@ -0,0 +1,234 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <DataFrame/Vectors/HeteroVector.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr std::size_t   ALIGNMENT = 64;
+constexpr std::size_t   COLUMNS = 200;
+constexpr std::size_t   COL_SIZE = 1000;
+constexpr std::size_t   ITERATIONS = 20000;
+
+template<typename T>
+using VecType = std::vector<T, typename allocator_declare<T, ALIGNMENT>::type>;
+
+// -----------------------------------------------------------------------------
+
+// This reproduces the previous HeteroVector layout where all vectors of
+// type T, for all instances, lived in one process-wide map keyed by the
+// instance address.
+//
+struct  StaticMapHeteroVector  {
+
+    template<typename T>
+    VecType<T> &get_vector()  {
+
+        auto    iter = vectors_<T>.find(this);
+
+        if (iter == vectors_<T>.end()) [[unlikely]]
+            iter = vectors_<T>.emplace(this, VecType<T>()).first;
+        return (iter->second);
+    }
+
+    template<typename T>
+    void move_to(StaticMapHeteroVector &to)  {
+
+        vectors_<T>[&to] = std::move(vectors_<T>[this]);
+        vectors_<T>.erase(this);
+    }
+
+private:
+
+    template<typename T>
+    inline static
+    std::unordered_map<const StaticMapHeteroVector *, VecType<T>> vectors_ { };
+};
+
+// -----------------------------------------------------------------------------
+
+struct  SizeFunctor10 :
+    HeteroVector<ALIGNMENT>::visitor_base<int, long, double, float, short,
+                                          char, unsigned int, unsigned long,
+                                          long long, std::string>  {
+
+    template<typename V>
+    void operator() (const V &vec)  { total += vec.size(); }
+
+    std::size_t total { 0 };
+};
+
+struct  SizeFunctor1 : HeteroVector<ALIGNMENT>::visitor_base<std::string>  {
+
+    template<typename V>
+    void operator() (const V &vec)  { total += vec.size(); }
+
+    std::size_t total { 0 };
+};
+
+// -----------------------------------------------------------------------------
+
+template<typename H>
+static double access_columns(std::vector<H> &columns)  {
+
+    double  sum { 0 };
+
+    for (std::size_t i = 0; i < ITERATIONS; ++i)
+        for (auto &col : columns)
+            sum += col.template get_vector<double>()[i % COL_SIZE];
+    return (sum);
+}
+
+// -----------------------------------------------------------------------------
+
+static void report(const char *name,
+                   const high_resolution_clock::time_point &start,
+                   const high_resolution_clock::time_point &end)  {
+
+    const double    secs =
+        double(duration_cast<microseconds>(end - start).count()) / 1000000.0;
+
+    std::cout << name << ": " << secs << " secs, "
+              << (secs * 1.0e9) / double(COLUMNS * ITERATIONS)
+              << " ns per get_vector()" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int, char *[]) {
+
+    std::vector<HeteroVector<ALIGNMENT>>    columns(COLUMNS);
+    std::vector<StaticMapHeteroVector>      map_columns(COLUMNS);
+
+    for (std::size_t c = 0; c < COLUMNS; ++c)  {
+        columns[c].get_vector<double>().resize(COL_SIZE, double(c));
+        map_columns[c].get_vector<double>().resize(COL_SIZE, double(c));
+    }
+
+    const auto  first = high_resolution_clock::now();
+    const auto  sum1 = access_columns(columns);
+    const auto  second = high_resolution_clock::now();
+    const auto  sum2 = access_columns(map_columns);
+    const auto  third = high_resolution_clock::now();
+
+    std::cout << "Sums: " << sum1 << ", " << sum2 << std::endl;
+    report("In-object column storage", first, second);
+    report("Static pointer-keyed map", second, third);
+
+    // Moving whole frames around, e.g. returning them from functions
+    //
+    std::vector<HeteroVector<ALIGNMENT>>    moved(COLUMNS);
+    std::vector<StaticMapHeteroVector>      map_moved(COLUMNS);
+    const auto                              fourth = high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < ITERATIONS / 100; ++i)
+        for (std::size_t c = 0; c < COLUMNS; ++c)  {
+            if (i & 1)  columns[c] = std::move(moved[c]);
+            else  moved[c] = std::move(columns[c]);
+        }
+
+    const auto  fifth = high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < ITERATIONS / 100; ++i)
+        for (std::size_t c = 0; c < COLUMNS; ++c)  {
+            if (i & 1)  map_moved[c].move_to<double>(map_columns[c]);
+            else  map_columns[c].move_to<double>(map_moved[c]);
+        }
+
+    const auto  sixth = high_resolution_clock::now();
+
+    std::cout << "Column moves -- in-object: "
+              << double(duration_cast<microseconds>(fifth - fourth).count()) / 1000000.0
+              << " secs, static map: "
+              << double(duration_cast<microseconds>(sixth - fifth).count()) / 1000000.0
+              << " secs" << std::endl;
+
+    // change() over 128 columns of 10 different types. The column type is
+    // resolved through the dispatch table, so the cost should not depend on
+    // the length of the types list.
+    //
+    constexpr std::size_t                   CHANGE_COLS = 128;
+    std::vector<HeteroVector<ALIGNMENT>>    frame(CHANGE_COLS);
+
+    for (std::size_t c = 0; c < CHANGE_COLS; ++c)  {
+        switch (c % 10)  {
+        case 0: frame[c].resize<int>(10); break;
+        case 1: frame[c].resize<long>(10); break;
+        case 2: frame[c].resize<double>(10); break;
+        case 3: frame[c].resize<float>(10); break;
+        case 4: frame[c].resize<short>(10); break;
+        case 5: frame[c].resize<char>(10); break;
+        case 6: frame[c].resize<unsigned int>(10); break;
+        case 7: frame[c].resize<unsigned long>(10); break;
+        case 8: frame[c].resize<long long>(10); break;
+        default: frame[c].resize<std::string>(10); break;
+        }
+    }
+
+    SizeFunctor10   functor10;
+    SizeFunctor1    functor1;
+    const auto      seventh = high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < ITERATIONS; ++i)
+        for (auto &col : frame)
+            col.change(functor10);
+
+    const auto  eighth = high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < ITERATIONS; ++i)
+        for (auto &col : frame)
+            col.change(functor1);
+
+    const auto  ninth = high_resolution_clock::now();
+
+    std::cout << "Total sizes: " << functor10.total << ", " << functor1.total
+              << std::endl;
+    std::cout << "change() with 10-type list: "
+              << double(duration_cast<nanoseconds>(eighth - seventh).count()) /
+                     double(CHANGE_COLS * ITERATIONS)
+              << " ns per column\n"
+              << "change() with 1-type list: "
+              << double(duration_cast<nanoseconds>(ninth - eighth).count()) /
+                     double(CHANGE_COLS * ITERATIONS)
+              << " ns per column" << std::endl;
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,175 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <DataFrame/DataFrame.h>
+#include <DataFrame/RandGen.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr std::size_t   ALIGNMENT = 64;
+
+typedef StdDataFrame64<unsigned long> MyDataFrame;
+
+// -----------------------------------------------------------------------------
+
+static double
+secs_since(const high_resolution_clock::time_point &start)  {
+
+    const auto  end = high_resolution_clock::now();
+
+    return (double(duration_cast<microseconds>(end - start).count()) /
+            1000000.0);
+}
+
+// -----------------------------------------------------------------------------
+
+static MyDataFrame
+make_df(std::size_t size, unsigned long step, unsigned int seed)  {
+
+    MyDataFrame             df;
+    RandGenParams<double>   p;
+
+    p.seed = seed;
+    df.load_data(MyDataFrame::gen_sequence_index(0, size * step, step),
+                 std::make_pair("value",
+                                gen_normal_dist<double, ALIGNMENT>(size, p)));
+    return (df);
+}
+
+// -----------------------------------------------------------------------------
+
+// Shuffles the rows by sorting on a random column
+//
+static void
+shuffle_df(MyDataFrame &df)  {
+
+    RandGenParams<double>   p;
+
+    p.seed = 789;
+    df.load_column("shuffle",
+                   gen_uniform_real_dist<double, ALIGNMENT>(
+                       df.get_index().size(), p));
+    df.sort<double, double>("shuffle", sort_spec::ascen);
+    df.remove_column<double>("shuffle");
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+time_join(const char *name,
+          const MyDataFrame &lhs,
+          const MyDataFrame &rhs,
+          join_policy policy,
+          sort_state already_sorted = sort_state::not_sorted)  {
+
+    const auto  start = high_resolution_clock::now();
+    const auto  res =
+        lhs.join_by_index<MyDataFrame, double>(rhs, policy, already_sorted);
+
+    std::cout << "    " << name << ": " << secs_since(start) << " secs ("
+              << res.get_index().size() << " rows)" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+// The last rhs value at or before each lhs row. Once natively and once by an
+// outer join followed by a forward fill.
+//
+static void
+time_asof(const MyDataFrame &lhs, const MyDataFrame &rhs)  {
+
+    auto    start = high_resolution_clock::now();
+    auto    asof = lhs.join_asof<MyDataFrame, double>(rhs);
+
+    std::cout << "    join_asof(): " << secs_since(start) << " secs ("
+              << asof.get_index().size() << " rows)" << std::endl;
+
+    start = high_resolution_clock::now();
+
+    auto    outer =
+        lhs.join_by_index<MyDataFrame, double>(rhs,
+                                               join_policy::left_right_join);
+
+    outer.fill_missing<double>({ "rhs.value" }, fill_policy::fill_forward);
+    std::cout << "    join_by_index() + fill_missing(): " << secs_since(start)
+              << " secs (" << outer.get_index().size() << " rows)"
+              << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+
+    const std::size_t   size =
+        argc > 1 ? std::size_t(std::atol(argv[1])) : 10000000;
+
+    MyDataFrame lhs = make_df(size, 1, 123);
+    MyDataFrame rhs = make_df(size / 2, 2, 456);
+    MyDataFrame small = make_df(size / 100, 97, 321);
+
+    std::cout << "Joining " << size << " rows with " << size / 2
+              << " and " << size / 100 << " rows" << std::endl;
+
+    MyDataFrame::set_thread_level(0);
+    std::cout << "Sorted, merged without sorting:" << std::endl;
+    time_join("inner, detected", lhs, rhs, join_policy::inner_join);
+    time_join("inner, declared", lhs, rhs, join_policy::inner_join,
+              sort_state::sorted);
+    time_join("left_right", lhs, rhs, join_policy::left_right_join);
+
+    std::cout << "As-of join:" << std::endl;
+    time_asof(lhs, small);
+
+    shuffle_df(lhs);
+    shuffle_df(rhs);
+    shuffle_df(small);
+
+    std::cout << "Shuffled, sorted and merged:" << std::endl;
+    time_join("inner", lhs, rhs, join_policy::inner_join);
+    time_join("left_right", lhs, rhs, join_policy::left_right_join);
+    time_join("left_right with small", lhs, small,
+              join_policy::left_right_join);
+
+    std::cout << "Shuffled, hash join on the small side:" << std::endl;
+    time_join("inner with small", lhs, small, join_policy::inner_join);
+    time_join("small left", small, lhs, join_policy::left_join);
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,222 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <DataFrame/Utils/Threads/ThreadPool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+// The previous quick sort is quadratic on these patterns. So it only sorts
+// this many items of them.
+//
+constexpr std::size_t   QUADRATIC_SIZE = 20000;
+
+// -----------------------------------------------------------------------------
+
+// This is the previous ThreadPool::parallel_sort(). It takes the first
+// element as the pivot.
+//
+template<typename I, typename P>
+static void
+old_parallel_sort(ThreadPool &pool, const I begin, const I end, P compare)  {
+
+    using value_type = typename std::iterator_traits<I>::value_type;
+    using fut_type = std::future<void>;
+
+    if (begin >= end) return;
+
+    auto                left_iter = begin;
+    auto                right_iter = end - 1;
+    bool                is_swapped_left = false;
+    bool                is_swapped_right = false;
+    const value_type    pivot = *begin;
+    auto                fwd_iter = begin + 1;
+
+    while (fwd_iter <= right_iter)  {
+        if (compare(*fwd_iter, pivot))  {
+            is_swapped_left = true;
+            std::iter_swap(left_iter, fwd_iter);
+            ++left_iter;
+            ++fwd_iter;
+        }
+        else if (compare(pivot, *fwd_iter))  {
+            is_swapped_right = true;
+            std::iter_swap(right_iter, fwd_iter);
+            --right_iter;
+        }
+        else ++fwd_iter;
+    }
+
+    const bool  do_left =
+        is_swapped_left && std::distance(begin, left_iter) > 0;
+    const bool  do_right =
+        is_swapped_right && std::distance(right_iter, end) > 0;
+
+    if (std::distance(begin, end) >= ThreadPool::MUL_THR_THHOLD)  {
+        fut_type    left_fut;
+        fut_type    right_fut;
+
+        if (do_left)
+            left_fut = pool.dispatch(false,
+                                     &old_parallel_sort<I, P>,
+                                     std::ref(pool), begin, left_iter,
+                                     compare);
+        if (do_right)
+            right_fut = pool.dispatch(false,
+                                      &old_parallel_sort<I, P>,
+                                      std::ref(pool), right_iter + 1, end,
+                                      compare);
+
+        if (do_left)
+            while (left_fut.wait_for(seconds(0)) ==
+                       std::future_status::timeout)
+                pool.run_task();
+        if (do_right)
+            while (right_fut.wait_for(seconds(0)) ==
+                       std::future_status::timeout)
+                pool.run_task();
+    }
+    else  {
+        if (do_left)  old_parallel_sort(pool, begin, left_iter, compare);
+        if (do_right)  old_parallel_sort(pool, right_iter + 1, end, compare);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static std::vector<double>
+make_data(const std::string &pattern, std::size_t size)  {
+
+    std::vector<double>                     data(size);
+    std::mt19937_64                         gen { 123 };
+    std::uniform_real_distribution<double>  dist { -1000000.0, 1000000.0 };
+
+    if (pattern == "few unique")
+        for (auto &v : data)  v = double(gen() % 16);
+    else
+        for (auto &v : data)  v = dist(gen);
+
+    if (pattern == "sorted" || pattern == "nearly sorted")
+        std::sort(data.begin(), data.end());
+    else if (pattern == "reverse sorted")
+        std::sort(data.begin(), data.end(), std::greater<double> { });
+
+    // Swap 1% of the items at random
+    //
+    if (pattern == "nearly sorted")
+        for (std::size_t i = 0; i < size / 100; ++i)
+            std::swap(data[gen() % size], data[gen() % size]);
+    return (data);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename F>
+static double
+time_sort(std::vector<double> data, F &&sort_func)  {
+
+    const auto  start = high_resolution_clock::now();
+
+    sort_func(data);
+
+    const auto      end = high_resolution_clock::now();
+    const double    secs =
+        double(duration_cast<microseconds>(end - start).count()) / 1000000.0;
+
+    if (! std::is_sorted(data.begin(), data.end()))
+        std::cout << "    NOT SORTED" << std::endl;
+    return (secs);
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+
+    const std::size_t   size =
+        argc > 1 ? std::size_t(std::atol(argv[1])) : 10000000;
+    const long          thr_num =
+        std::max(long(std::thread::hardware_concurrency()), 4L);
+    ThreadPool          pool(thr_num);
+    const auto          less = std::less<double> { };
+
+    std::cout << "Sorting " << size << " doubles with " << thr_num
+              << " threads" << std::endl;
+    for (const char *pattern : { "random", "sorted", "reverse sorted",
+                                 "nearly sorted", "few unique" })  {
+        const auto  data = make_data(pattern, size);
+
+        std::cout << pattern << ":\n"
+                  << "    std::sort:             "
+                  << time_sort(data, [](auto &vec) -> void  {
+                         std::sort(vec.begin(), vec.end());
+                     })
+                  << " secs\n"
+                  << "    parallel_sort:         "
+                  << time_sort(data, [&pool](auto &vec) -> void  {
+                         pool.parallel_sort(vec.begin(), vec.end());
+                     })
+                  << " secs" << std::endl;
+
+        const bool  quadratic =
+            std::string(pattern) != "random" &&
+            std::string(pattern) != "few unique";
+        const auto  old_data =
+            quadratic ? make_data(pattern, std::min(size, QUADRATIC_SIZE))
+                      : data;
+
+        std::cout << "    Previous quick sort:   "
+                  << time_sort(old_data, [&pool, less](auto &vec) -> void  {
+                         old_parallel_sort(pool, vec.begin(), vec.end(),
+                                           less);
+                     })
+                  << " secs";
+        if (quadratic)
+            std::cout << " (only " << old_data.size() << " items)";
+        std::cout << std::endl;
+    }
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
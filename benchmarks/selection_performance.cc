@@ -0,0 +1,136 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <DataFrame/DataFrame.h>
+#include <DataFrame/RandGen.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr std::size_t   ALIGNMENT = 64;
+
+typedef StdDataFrame64<unsigned long> MyDataFrame;
+
+// -----------------------------------------------------------------------------
+
+static double
+secs_since(const high_resolution_clock::time_point &start)  {
+
+    const auto  end = high_resolution_clock::now();
+
+    return (double(duration_cast<microseconds>(end - start).count()) /
+            1000000.0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Selects the rows with normal > threshold, once by a functor and once by a
+// column predicate
+//
+static void
+compare(const MyDataFrame &df, double threshold)  {
+
+    auto        functor =
+        [threshold](const unsigned long &, const double &val) -> bool  {
+            return (val > threshold);
+        };
+    auto        start = high_resolution_clock::now();
+    const auto  by_sel =
+        df.get_view_by_sel<double, decltype(functor), double, long>
+            ("normal", functor);
+    const double    sel_secs = secs_since(start);
+
+    start = high_resolution_clock::now();
+
+    const auto  by_pred =
+        df.get_view_by_pred<double, long>(
+            ColumnPred<double> { "normal", compare_op::gt, threshold });
+    const double    pred_secs = secs_since(start);
+
+    std::cout << "normal > " << threshold << " ("
+              << by_pred.get_index().size() << " rows):\n"
+              << "    get_view_by_sel():  " << sel_secs << " secs\n"
+              << "    get_view_by_pred(): " << pred_secs << " secs ("
+              << sel_secs / pred_secs << "x)" << std::endl;
+    if (by_sel.get_index().size() != by_pred.get_index().size())
+        std::cout << "    Results don't match" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+
+    const std::size_t   size =
+        argc > 1 ? std::size_t(std::atol(argv[1])) : 10000000;
+
+    MyDataFrame                 df;
+    RandGenParams<double>       p;
+    RandGenParams<long>         lp;
+
+    p.seed = 123;
+    lp.seed = 456;
+    lp.min_value = 0;
+    lp.max_value = 1000;
+    df.load_data(MyDataFrame::gen_sequence_index(0, size, 1),
+                 std::make_pair("normal",
+                                gen_normal_dist<double, ALIGNMENT>(size, p)),
+                 std::make_pair("volume",
+                                gen_uniform_int_dist<long, ALIGNMENT>(size,
+                                                                      lp)));
+
+    std::cout << "Selecting from " << size << " rows" << std::endl;
+
+    // From about 50% of the rows, where branches are hardest to predict,
+    // to about 0.1%
+    //
+    for (const double threshold : { 0.0, 1.0, 2.0, 3.0 })
+        compare(df, threshold);
+
+    const auto  start = high_resolution_clock::now();
+    const auto  two_cols =
+        df.get_data_by_pred<double, long>(
+            ColumnPred<double> { "normal", compare_op::gt, 0.0 },
+            ColumnPred<long> { "volume", compare_op::lt, 100 });
+
+    std::cout << "normal > 0 and volume < 100 ("
+              << two_cols.get_index().size() << " rows): "
+              << secs_since(start) << " secs" << std::endl;
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,174 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <DataFrame/DataFrame.h>
+#include <DataFrame/RandGen.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <ranges>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr std::size_t   ALIGNMENT = 64;
+
+typedef StdDataFrame64<unsigned long> MyDataFrame;
+
+// -----------------------------------------------------------------------------
+
+static double
+secs_since(const high_resolution_clock::time_point &start)  {
+
+    const auto  end = high_resolution_clock::now();
+
+    return (double(duration_cast<microseconds>(end - start).count()) /
+            1000000.0);
+}
+
+// -----------------------------------------------------------------------------
+
+// This is how DataFrame::sort() sorted a single arithmetic column before the
+// radix sort. It is here as the baseline.
+//
+template<typename T>
+static double
+comparison_sort(MyDataFrame &df, const char *col_name)  {
+
+    const auto  start = high_resolution_clock::now();
+    auto        &vec = df.get_column<T>(col_name);
+    auto        &indices = df.get_index();
+    const auto  idx_s = indices.size();
+
+    MyDataFrame::StlVecType<std::size_t>    sorting_idxs(idx_s);
+
+    std::iota(sorting_idxs.begin(), sorting_idxs.end(), 0);
+
+    auto    zip = std::ranges::views::zip(vec, indices, sorting_idxs);
+
+    std::ranges::sort(zip, [](const auto &lhs, const auto &rhs) -> bool {
+                               return (std::get<0>(lhs) < std::get<0>(rhs));
+                           });
+    return (secs_since(start));
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+static double
+dataframe_sort(MyDataFrame &df, const char *col_name)  {
+
+    const auto  start = high_resolution_clock::now();
+
+    df.sort<T, T>(col_name, sort_spec::ascen);
+    return (secs_since(start));
+}
+
+// -----------------------------------------------------------------------------
+
+// Only the key column is loaded, so both sorts do the same work
+//
+template<typename T>
+static MyDataFrame
+make_df(std::size_t size, const char *col_name)  {
+
+    MyDataFrame             df;
+    RandGenParams<double>   p;
+
+    p.seed = 123;
+    p.min_value = -1000000.0;
+    p.max_value = 1000000.0;
+
+    const auto              dbls =
+        gen_uniform_real_dist<double, ALIGNMENT>(size, p);
+    MyDataFrame::StlVecType<T>  vec(size);
+
+    for (std::size_t i = 0; i < size; ++i)
+        vec[i] = T(dbls[i] * 1000.0);
+    df.load_data(MyDataFrame::gen_sequence_index(0, size, 1),
+                 std::make_pair(col_name, std::move(vec)));
+    return (df);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+static void
+compare(std::size_t size, const char *col_name)  {
+
+    MyDataFrame df1 = make_df<T>(size, col_name);
+    MyDataFrame df2 = make_df<T>(size, col_name);
+    const auto  cmp_secs = comparison_sort<T>(df1, col_name);
+    const auto  df_secs = dataframe_sort<T>(df2, col_name);
+
+    std::cout << col_name << " column:\n"
+              << "    Comparison sort: " << cmp_secs << " secs\n"
+              << "    DataFrame sort:  " << df_secs << " secs ("
+              << cmp_secs / df_secs << "x)" << std::endl;
+
+    const auto  &vec1 = df1.get_column<T>(col_name);
+    const auto  &vec2 = df2.get_column<T>(col_name);
+
+    if (! std::ranges::equal(vec1, vec2))
+        std::cout << "    Results don't match" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+
+    const std::size_t   size =
+        argc > 1 ? std::size_t(std::atol(argv[1])) : 10000000;
+
+    std::cout << "Sorting " << size << " rows" << std::endl;
+
+    MyDataFrame::set_thread_level(0);
+    std::cout << "Single thread:" << std::endl;
+    compare<double>(size, "double");
+    compare<long>(size, "long");
+
+    MyDataFrame::set_optimum_thread_level();
+    if (MyDataFrame::get_thread_level() > 2)  {
+        std::cout << "With " << MyDataFrame::get_thread_level()
+                  << " threads:" << std::endl;
+        compare<double>(size, "double");
+        compare<long>(size, "long");
+    }
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
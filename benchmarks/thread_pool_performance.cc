@@ -0,0 +1,469 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <DataFrame/Utils/Threads/SharedQueue.h>
+#include <DataFrame/Utils/Threads/ThreadPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+#ifdef _MSC_VER
+#  include <malloc.h>
+#endif // _MSC_VER
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr std::size_t   DISPATCHES = 200000;
+constexpr std::size_t   TASKS = 200000;
+constexpr std::size_t   BURSTS = 2000;
+constexpr std::size_t   BURST_SIZE = 64;
+constexpr std::size_t   SORT_SIZE = 5000000;
+constexpr long          SORT_THHOLD = 50000;
+
+// -----------------------------------------------------------------------------
+
+// Count calls to the global allocator.
+// Every scalar, array and aligned form is replaced so they all pair up.
+// They are kept out of line, otherwise GCC sees the inlined malloc()/free()
+// next to new/delete expressions and reports -Wmismatched-new-delete.
+//
+#if defined(__GNUC__)
+#  define BM_NOINLINE   __attribute__((noinline))
+#else
+#  define BM_NOINLINE
+#endif // __GNUC__
+
+static std::atomic<std::size_t> new_calls { 0 };
+
+static inline void *count_alloc_(std::size_t size)  {
+
+    new_calls.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1))  return (ptr);
+    throw std::bad_alloc { };
+}
+static inline void *count_alloc_(std::size_t size, std::align_val_t al)  {
+
+    const std::size_t   align = static_cast<std::size_t>(al);
+
+    // aligned_alloc() wants the size to be a multiple of the alignment
+    //
+    size = ((size ? size : 1) + align - 1) & ~(align - 1);
+    new_calls.fetch_add(1, std::memory_order_relaxed);
+#ifdef _MSC_VER
+    if (void *ptr = _aligned_malloc(size, align))  return (ptr);
+#else
+    if (void *ptr = std::aligned_alloc(align, size))  return (ptr);
+#endif // _MSC_VER
+    throw std::bad_alloc { };
+}
+static inline void aligned_free_(void *ptr) noexcept  {
+
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif // _MSC_VER
+}
+
+BM_NOINLINE void *operator new (std::size_t size)  {
+
+    return (count_alloc_(size));
+}
+BM_NOINLINE void *operator new[] (std::size_t size)  {
+
+    return (count_alloc_(size));
+}
+BM_NOINLINE void operator delete (void *ptr) noexcept  { std::free(ptr); }
+BM_NOINLINE void
+operator delete (void *ptr, std::size_t) noexcept  { std::free(ptr); }
+BM_NOINLINE void operator delete[] (void *ptr) noexcept  { std::free(ptr); }
+BM_NOINLINE void
+operator delete[] (void *ptr, std::size_t) noexcept  { std::free(ptr); }
+
+BM_NOINLINE void *operator new (std::size_t size, std::align_val_t al)  {
+
+    return (count_alloc_(size, al));
+}
+BM_NOINLINE void *operator new[] (std::size_t size, std::align_val_t al)  {
+
+    return (count_alloc_(size, al));
+}
+BM_NOINLINE void operator delete (void *ptr, std::align_val_t) noexcept  {
+
+    aligned_free_(ptr);
+}
+BM_NOINLINE void
+operator delete (void *ptr, std::size_t, std::align_val_t) noexcept  {
+
+    aligned_free_(ptr);
+}
+BM_NOINLINE void operator delete[] (void *ptr, std::align_val_t) noexcept  {
+
+    aligned_free_(ptr);
+}
+BM_NOINLINE void
+operator delete[] (void *ptr, std::size_t, std::align_val_t) noexcept  {
+
+    aligned_free_(ptr);
+}
+
+// -----------------------------------------------------------------------------
+
+// This reproduces the previous ThreadPool design. Each thread has a mutex
+// guarded std::queue and idle threads block on the global SharedQueue.
+//
+class   SharedQueuePool  {
+
+public:
+
+    explicit SharedQueuePool(long thr_num)  {
+
+        for (long i = 0; i < thr_num; ++i)
+            local_queues_.push_back(LocalQueueType { });
+        for (long i = 0; i < thr_num; ++i)
+            threads_.emplace_back(&SharedQueuePool::thread_routine_, this, i);
+        while (capacity_ != thr_num)  std::this_thread::yield();
+    }
+    ~SharedQueuePool()  {
+
+        for (std::size_t i = 0; i < threads_.size(); ++i)
+            global_queue_.push(WorkUnit { nullptr, true });
+        for (auto &thr : threads_)  thr.join();
+    }
+
+    template<typename F>
+    std::future<std::invoke_result_t<F>> dispatch(bool, F &&routine)  {
+
+        using ret_t = std::invoke_result_t<F>;
+
+        auto        callable {
+            std::make_shared<std::packaged_task<ret_t()>>
+                (std::forward<F>(routine))
+        };
+        auto        fut { callable->get_future() };
+        WorkUnit    work_unit { [callable]() -> void { (*callable)(); } };
+
+        if (local_queue_)  {
+            const std::lock_guard<std::mutex>   guard { state_ };
+
+            local_queue_->push(work_unit);
+        }
+        else
+            global_queue_.push(work_unit);
+        return (fut);
+    }
+
+    bool run_task() noexcept  {
+
+        WorkUnit    work_unit { };
+
+        {
+            const std::lock_guard<std::mutex>   guard { state_ };
+
+            if (local_queue_ && ! local_queue_->empty())  {
+                work_unit = local_queue_->front();
+                local_queue_->pop();
+            }
+            else
+                for (auto &q : local_queues_)
+                    if (! q.empty())  {
+                        work_unit = q.front();
+                        q.pop();
+                        break;
+                    }
+        }
+        if (! work_unit.func && ! work_unit.terminate)  {
+            const auto  opt_ret = global_queue_.pop_front(false);
+
+            if (opt_ret.has_value())  work_unit = opt_ret.value();
+        }
+        if (work_unit.func)  {
+            work_unit.func();
+            return (true);
+        }
+        if (work_unit.terminate)  global_queue_.push(work_unit);
+        return (false);
+    }
+
+private:
+
+    struct  WorkUnit  {
+
+        std::function<void()>   func { };
+        bool                    terminate { false };
+    };
+
+    using LocalQueueType = std::queue<WorkUnit>;
+
+    void thread_routine_(long idx) noexcept  {
+
+        auto    iter = local_queues_.begin();
+
+        std::advance(iter, idx);
+        local_queue_ = &(*iter);
+        ++capacity_;
+        while (true)  {
+            for (int counter = 0; counter < 80; ++counter)  run_task();
+
+            const auto  opt_ret = global_queue_.pop_front(true);
+
+            if (opt_ret.has_value())  {
+                if (opt_ret.value().terminate)  break;
+                if (opt_ret.value().func)  opt_ret.value().func();
+            }
+        }
+        local_queue_ = nullptr;
+    }
+
+    std::vector<std::thread>    threads_ { };
+    std::list<LocalQueueType>   local_queues_ { };
+    SharedQueue<WorkUnit>       global_queue_ { };
+    std::mutex                  state_ { };
+    std::atomic<long>           capacity_ { 0 };
+
+    inline static thread_local LocalQueueType   *local_queue_ { nullptr };
+};
+
+// -----------------------------------------------------------------------------
+
+// Same recursive fork/join quick-sort for both pools. The waiting parent
+// helps by running tasks, as ThreadPool::parallel_sort() does.
+//
+template<typename P, typename I>
+static void pool_sort(P &pool, I begin, I end)  {
+
+    if (end - begin < SORT_THHOLD)  {
+        std::sort(begin, end);
+        return;
+    }
+
+    const auto  pivot = *(begin + (end - begin) / 2);
+    const I     mid1 =
+        std::partition(begin, end, [pivot](int v) { return (v < pivot); });
+    const I     mid2 =
+        std::partition(mid1, end, [pivot](int v) { return (! (pivot < v)); });
+    auto        left =
+        pool.dispatch(false, [&pool, begin, mid1]() -> void {
+                                 pool_sort(pool, begin, mid1);
+                             });
+    auto        right =
+        pool.dispatch(false, [&pool, mid2, end]() -> void {
+                                 pool_sort(pool, mid2, end);
+                             });
+
+    while (left.wait_for(seconds(0)) == std::future_status::timeout)
+        pool.run_task();
+    while (right.wait_for(seconds(0)) == std::future_status::timeout)
+        pool.run_task();
+}
+
+// -----------------------------------------------------------------------------
+
+// Round trip of dispatch(), run_task() and future::get() for an empty task
+// from inside a pool thread. This is the per-task overhead that fine
+// grained parallel loops pay.
+//
+template<typename P>
+static void dispatch_latency(const char *name, P &pool)  {
+
+    const auto  round_trips = [&pool]() -> std::vector<double>  {
+        std::vector<double> ret(DISPATCHES);
+
+        for (std::size_t i = 0; i < DISPATCHES; ++i)  {
+            const auto  start = steady_clock::now();
+            auto        f = pool.dispatch(false, [i]() { return (i); });
+
+            while (f.wait_for(seconds(0)) == std::future_status::timeout)
+                pool.run_task();
+            f.get();
+            ret[i] = double(duration_cast<nanoseconds>
+                                (steady_clock::now() - start).count());
+        }
+        return (ret);
+    };
+
+    pool.dispatch(false, round_trips).get();  // Warm up the caches
+
+    const std::size_t   calls_before = new_calls.load();
+    auto                latencies = pool.dispatch(false, round_trips).get();
+    const std::size_t   calls = new_calls.load() - calls_before;
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << name << " -- dispatch round trip: p50 "
+              << latencies[DISPATCHES / 2] << " ns, p99 "
+              << latencies[(DISPATCHES * 99) / 100] << " ns, "
+              << double(calls) / double(DISPATCHES)
+              << " allocations per dispatch" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename P>
+static void run_benchmarks(const char *name, P &pool)  {
+
+    dispatch_latency(name, pool);
+
+    // Throughput of many tiny tasks dispatched from outside the pool
+    //
+    {
+        std::vector<std::future<std::size_t>>   futs;
+
+        futs.reserve(TASKS);
+
+        const auto  start = high_resolution_clock::now();
+
+        for (std::size_t i = 0; i < TASKS; ++i)
+            futs.push_back(pool.dispatch(false, [i]() { return (i); }));
+
+        std::size_t sum { 0 };
+
+        for (auto &f : futs)  sum += f.get();
+
+        const auto      end = high_resolution_clock::now();
+        const double    secs =
+            double(duration_cast<microseconds>(end - start).count()) /
+            1000000.0;
+
+        std::cout << name << " -- tiny tasks: "
+                  << double(TASKS) / secs / 1000000.0 << " M tasks/s"
+                  << " (sum " << sum << ")" << std::endl;
+    }
+
+    // Dispatch-to-start latency of bursts. Each burst is submitted by one
+    // task, so the children land on a pool thread's local queue.
+    //
+    {
+        std::vector<double> latencies;
+
+        latencies.reserve(BURSTS * BURST_SIZE);
+        for (std::size_t b = 0; b < BURSTS; ++b)  {
+            auto    parent =
+                pool.dispatch(false, [&pool]() -> std::vector<double> {
+                    std::vector<std::future<double>>    futs;
+                    std::vector<double>                 ret;
+
+                    for (std::size_t i = 0; i < BURST_SIZE; ++i)  {
+                        const auto  sent = steady_clock::now();
+
+                        futs.push_back(pool.dispatch(false, [sent]() {
+                            const auto  now = steady_clock::now();
+
+                            std::this_thread::sleep_for(microseconds(20));
+                            return (double(duration_cast<nanoseconds>
+                                               (now - sent).count()));
+                        }));
+                    }
+                    for (auto &f : futs)  {
+                        while (f.wait_for(seconds(0)) ==
+                                   std::future_status::timeout)
+                            pool.run_task();
+                        ret.push_back(f.get());
+                    }
+                    return (ret);
+                });
+            const auto  lats = parent.get();
+
+            latencies.insert(latencies.end(), lats.begin(), lats.end());
+        }
+        std::sort(latencies.begin(), latencies.end());
+
+        const std::size_t   n = latencies.size();
+
+        std::cout << name << " -- burst latency: p50 "
+                  << latencies[n / 2] / 1000.0 << " us, p99 "
+                  << latencies[(n * 99) / 100] / 1000.0 << " us, max "
+                  << latencies.back() / 1000.0 << " us" << std::endl;
+    }
+
+    // Recursive fork/join sort
+    //
+    {
+        std::vector<int>    data(SORT_SIZE);
+        std::mt19937        gen { 123 };
+
+        for (auto &v : data)  v = int(gen());
+
+        const auto  start = high_resolution_clock::now();
+
+        pool_sort(pool, data.begin(), data.end());
+
+        const auto  end = high_resolution_clock::now();
+
+        std::cout << name << " -- fork/join sort: "
+                  << double(duration_cast<microseconds>(end - start).count()) /
+                         1000000.0
+                  << " secs"
+                  << (std::is_sorted(data.begin(), data.end())
+                          ? "" : " (NOT SORTED)")
+                  << std::endl;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int, char *[]) {
+
+    const long  thr_num =
+        std::max(long(std::thread::hardware_concurrency()), 4L);
+
+    std::cout << "Threads: " << thr_num << std::endl;
+    {
+        SharedQueuePool pool(thr_num);
+
+        run_benchmarks("SharedQueue pool", pool);
+    }
+    {
+        ThreadPool  pool(thr_num);
+
+        run_benchmarks("Work-stealing pool", pool);
+    }
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,198 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <DataFrame/DataFrame.h>
+#include <DataFrame/DataFrameStatsVisitors.h>
+#include <DataFrame/RandGen.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr std::size_t   ALIGNMENT = 64;
+constexpr std::size_t   REPEAT = 3;
+
+typedef StdDataFrame64<unsigned long> MyDataFrame;
+
+// -----------------------------------------------------------------------------
+
+static double
+secs_since(const high_resolution_clock::time_point &start)  {
+
+    const auto  end = high_resolution_clock::now();
+
+    return (double(duration_cast<microseconds>(end - start).count()) /
+            1000000.0);
+}
+
+// -----------------------------------------------------------------------------
+
+// The results are compared within the square root of epsilon, because the
+// two paths add the items in different orders
+//
+template<typename T>
+static void
+report(const char *label,
+       std::size_t bytes,
+       double visit_secs,
+       double single_act_secs,
+       double visit_result,
+       double single_act_result)  {
+
+    std::cout << label << ":\n"
+              << "    visit():            "
+              << double(bytes) / visit_secs / 1.0e9 << " GB/s\n"
+              << "    single_act_visit(): "
+              << double(bytes) / single_act_secs / 1.0e9 << " GB/s ("
+              << visit_secs / single_act_secs << "x)" << std::endl;
+    const double    tolerance =
+        std::sqrt(double(std::numeric_limits<T>::epsilon()));
+
+    if (std::fabs(visit_result - single_act_result) >
+            tolerance * std::max(1.0, std::fabs(visit_result)))
+        std::cout << "    Results don't match: " << visit_result << " vs "
+                  << single_act_result << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+// visit() passes the items one by one, which is the scalar path.
+// single_act_visit() passes the whole column, which is the kernel path.
+// It reports the best of REPEAT runs.
+//
+template<typename T, typename V>
+static void
+compare(const MyDataFrame &df, const char *label, const char *col_name)  {
+
+    double  visit_secs { 1.0e9 };
+    double  single_act_secs { 1.0e9 };
+    V       visit_v;
+    V       single_act_v;
+
+    for (std::size_t i = 0; i < REPEAT; ++i)  {
+        auto    start = high_resolution_clock::now();
+
+        df.visit<T>(col_name, visit_v);
+        visit_secs = std::min(visit_secs, secs_since(start));
+
+        start = high_resolution_clock::now();
+        df.single_act_visit<T>(col_name, single_act_v);
+        single_act_secs = std::min(single_act_secs, secs_since(start));
+    }
+    report<T>(label, df.get_index().size() * sizeof(T),
+           visit_secs, single_act_secs,
+           double(visit_v.get_result()), double(single_act_v.get_result()));
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T, typename V>
+static void
+compare2(const MyDataFrame &df,
+         const char *label,
+         const char *col_name1,
+         const char *col_name2)  {
+
+    double  visit_secs { 1.0e9 };
+    double  single_act_secs { 1.0e9 };
+    V       visit_v;
+    V       single_act_v;
+
+    for (std::size_t i = 0; i < REPEAT; ++i)  {
+        auto    start = high_resolution_clock::now();
+
+        df.visit<T, T>(col_name1, col_name2, visit_v);
+        visit_secs = std::min(visit_secs, secs_since(start));
+
+        start = high_resolution_clock::now();
+        df.single_act_visit<T, T>(col_name1, col_name2, single_act_v);
+        single_act_secs = std::min(single_act_secs, secs_since(start));
+    }
+    report<T>(label, df.get_index().size() * sizeof(T) * 2,
+           visit_secs, single_act_secs,
+           double(visit_v.get_result()), double(single_act_v.get_result()));
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+
+    const std::size_t   size =
+        argc > 1 ? std::size_t(std::atol(argv[1])) : 50000000;
+
+    MyDataFrame             df;
+    RandGenParams<double>   p;
+    RandGenParams<double>   p2;
+    RandGenParams<float>    fp;
+    RandGenParams<int>      ip;
+
+    p.seed = 123;
+    p2.seed = 456;
+    fp.seed = 789;
+    ip.seed = 321;
+    ip.min_value = -1000;
+    ip.max_value = 1000;
+    df.load_data(MyDataFrame::gen_sequence_index(0, size, 1),
+                 std::make_pair("normal",
+                                gen_normal_dist<double, ALIGNMENT>(size, p)),
+                 std::make_pair("normal_2",
+                                gen_normal_dist<double, ALIGNMENT>(size, p2)),
+                 std::make_pair("float",
+                                gen_normal_dist<float, ALIGNMENT>(size, fp)),
+                 std::make_pair("int",
+                                gen_uniform_int_dist<int, ALIGNMENT>(size,
+                                                                     ip)));
+
+    std::cout << "Visiting " << size << " rows" << std::endl;
+
+    compare<double, SumVisitor<double>>(df, "Sum", "normal");
+    compare<float, SumVisitor<float>>(df, "Sum float", "float");
+    compare<int, SumVisitor<int>>(df, "Sum int", "int");
+    compare<double, MeanVisitor<double>>(df, "Mean", "normal");
+    compare<double, MaxVisitor<double>>(df, "Max", "normal");
+    compare<int, MinVisitor<int>>(df, "Min int", "int");
+    compare<double, VarVisitor<double>>(df, "Var", "normal");
+    compare2<double, DotProdVisitor<double>>(df, "DotProd",
+                                             "normal", "normal_2");
+    compare2<double, CorrVisitor<double>>(df, "Corr", "normal", "normal_2");
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
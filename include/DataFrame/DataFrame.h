@@ -38,11 +38,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/Threads/ThreadGranularity.h>
 #include <DataFrame/Utils/Utils.h>
 
+#include <any>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <future>
 #include <ios>
 #include <limits>
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
@@ -117,6 +123,22 @@ public:  // Construction
 
     using seed_t = std::random_device::result_type;
 
+    // Rows grouped by equal keys. See get_grouping1/2/3() and groupby().
+    // permutation has the row numbers ordered so rows with equal keys are
+    // next to each other. offsets has the start of each group in
+    // permutation, followed by the number of rows.
+    //
+    struct  Grouping  {
+
+        StlVecType<size_type>   permutation {  };
+        StlVecType<size_type>   offsets { StlVecType<size_type>(1, 0) };
+
+        [[nodiscard]] inline size_type group_count() const  {
+
+            return (offsets.size() - 1);
+        }
+    };
+
     DataFrame() = default;
 
     // Because of thread safety, these need tender loving care
@@ -626,7 +648,9 @@ public:  // Load/append/remove interfaces
     append_row(IndexType *idx_val, Ts&& ... args);
 
     // It removes the data rows from index begin to index end.
-    // DataFrame must be sorted by index or behavior is undefined.
+    // If the index is sorted (see is_index_sorted()), the range is found by
+    // binary search. Otherwise, all rows with begin <= index <= end are
+    // removed by a linear scan.
     // This function first calls make_consistent() that may add nan values to
     // data columns.
     //
@@ -681,10 +705,13 @@ public:  // Load/append/remove interfaces
     //   Name of the data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T, typename F, typename ... Ts>
     void
-    remove_data_by_sel(const char *name, F &sel_functor);
+    remove_data_by_sel(const char *name, F &sel_functor,
+                       bool parallel = false);
 
     // This does the same function as above remove_data_by_sel() but operating
     // on two columns.
@@ -706,10 +733,13 @@ public:  // Load/append/remove interfaces
     //   Name of the second data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename F, typename ... Ts>
     void
-    remove_data_by_sel(const char *name1, const char *name2, F &sel_functor);
+    remove_data_by_sel(const char *name1, const char *name2, F &sel_functor,
+                       bool parallel = false);
 
     // This does the same function as above remove_data_by_sel() but operating
     // on three columns.
@@ -735,6 +765,8 @@ public:  // Load/append/remove interfaces
     //   Name of the third data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename T3, typename F,
              typename ... Ts>
@@ -742,7 +774,23 @@ public:  // Load/append/remove interfaces
     remove_data_by_sel(const char *name1,
                        const char *name2,
                        const char *name3,
-                       F &sel_functor);
+                       F &sel_functor,
+                       bool parallel = false);
+
+    // This removes the rows that satisfy all the given column predicates.
+    // See get_data_by_pred() for how the predicates are evaluated.
+    //
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // Ps:
+    //   Types of the predicate columns. They are deduced from preds
+    // preds:
+    //   One or more column predicates (See ColumnPred definition)
+    //
+    template<typename ... Ts, typename ... Ps>
+    void
+    remove_data_by_pred(const ColumnPred<Ps> & ... preds);
 
     // This reomves data rows by basic Glob-like pattern matching (also similar
     // to SQL like clause) to filter data in the named column. Each element of
@@ -1345,6 +1393,12 @@ public:  // Data manipulation
     // If the named column is other than index column, then the returned
     // DataFrame also has a column with the same name which has the unique
     // values of the named column.
+    // The groups are found once and all the columns are summarized over them.
+    // If the index and all column visitors are mergeable (see
+    // mergeable_visitor), the rows are split between threads and the partial
+    // aggregates of each group are merged. Otherwise, the columns are
+    // summarized in parallel, one column per thread.
+    // Also see get_grouping1() and groupby().
     // Also see bucketize().
     //
     // T:
@@ -1422,6 +1476,98 @@ public:  // Data manipulation
              I_V &&idx_visitor,
              Ts&& ... args) const;
 
+    // These are the same as above groupby1/2/3(), but the policy specifies
+    // how rows with equal keys are found.
+    // With the hash policies, each row is given a dense group id in one
+    // hashing pass. Then the rows are bucketed by group id in linear time,
+    // instead of sorting all the rows. For hash_sorted, only the unique keys
+    // are sorted, so the result is in the same order as the sort policy.
+    // This is usually much faster when there are many rows or many groups.
+    // With the hash policies, the visitors see the rows of each group in
+    // their original order.
+    // The hash policies need std::hash to be defined for the groupby column
+    // type(s), otherwise NotFeasible is thrown.
+    //
+    // policy:
+    //   Specifies how to group and the order of groups in the result
+    //
+    template<comparable T, typename I_V, typename ... Ts>
+    [[nodiscard]] DataFrame
+    groupby1(groupby_policy policy,
+             const char *col_name,
+             I_V &&idx_visitor,
+             Ts&& ... args) const;
+
+    template<comparable T1, comparable T2, typename I_V, typename ... Ts>
+    [[nodiscard]] DataFrame
+    groupby2(groupby_policy policy,
+             const char *col_name1,
+             const char *col_name2,
+             I_V &&idx_visitor,
+             Ts&& ... args) const;
+
+    template<comparable T1, comparable T2, comparable T3,
+             typename I_V, typename ... Ts>
+    [[nodiscard]] DataFrame
+    groupby3(groupby_policy policy,
+             const char *col_name1,
+             const char *col_name2,
+             const char *col_name3,
+             I_V &&idx_visitor,
+             Ts&& ... args) const;
+
+    // These group the rows by the named column(s), the same way as
+    // groupby1/2/3() with the same policy. They return the grouping without
+    // aggregating anything. The grouping can then be given to groupby() for
+    // any number of aggregations, without finding the groups again.
+    // A grouping is valid as long as the rows of this DataFrame don't change.
+    //
+    // T, T1, T2, T3:
+    //   Types of groupby columns. In case if index, it is type of index
+    // col_name, col_name1, col_name2, col_name3:
+    //   Names of the grouop-by'ing columns
+    // policy:
+    //   Specifies how to group and the order of groups
+    //
+    template<comparable T>
+    [[nodiscard]] Grouping
+    get_grouping1(const char *col_name,
+                  groupby_policy policy = groupby_policy::sort) const;
+
+    template<comparable T1, comparable T2>
+    [[nodiscard]] Grouping
+    get_grouping2(const char *col_name1,
+                  const char *col_name2,
+                  groupby_policy policy = groupby_policy::sort) const;
+
+    template<comparable T1, comparable T2, comparable T3>
+    [[nodiscard]] Grouping
+    get_grouping3(const char *col_name1,
+                  const char *col_name2,
+                  const char *col_name3,
+                  groupby_policy policy = groupby_policy::sort) const;
+
+    // It summarizes the groups of the given grouping, the same way as
+    // groupby1/2/3(). But the result doesn't have the groupby column(s).
+    // To get them, summarize them with a FirstVisitor.
+    // If grouping is not consistent with this DataFrame (see Grouping), it
+    // throws InconsistentData.
+    //
+    // I_V:
+    //   Type of visitor to be used to summarize the index column
+    // Ts:
+    //   Types of triples to specify the column summarization
+    // grouping:
+    //   A grouping of this DataFrame by get_grouping1/2/3()
+    // idx_visitor:
+    //   A visitor to specify the index summarization
+    // args:
+    //   List of triples to specify the column summarization
+    //
+    template<typename I_V, typename ... Ts>
+    [[nodiscard]] DataFrame
+    groupby(const Grouping &grouping, I_V &&idx_visitor, Ts&& ... args) const;
+
     // Same as groupby1() above, but executed asynchronously
     //
     template<comparable T, typename I_V, typename ... Ts>
@@ -1567,10 +1713,17 @@ public:  // Data manipulation
     // join_policy:
     //   Specifies how to join. For example inner join, or left join, etc.
     //   (See join_policy definition)
+    // already_sorted:
+    //   If both self and rhs are already sorted by index, this will save
+    //   checking for it. Sides that are sorted are merged without sorting.
+    //   If one side is much smaller and the other is not sorted, a hash join
+    //   is done, when the join_policy allows it.
     //
     template<typename RHS_T, typename ... Ts>
     [[nodiscard]] DataFrame<I, H>
-    join_by_index(const RHS_T &rhs, join_policy jp) const;
+    join_by_index(const RHS_T &rhs,
+                  join_policy jp,
+                  sort_state already_sorted = sort_state::not_sorted) const;
 
     // It joins the data between self (lhs) and rhs and returns the joined data
     // in a StdDataFrame, based on specification in join_policy.
@@ -1600,10 +1753,61 @@ public:  // Data manipulation
     // join_policy:
     //   Specifies how to join. For example inner join, or left join, etc.
     //   (See join_policy definition)
+    // already_sorted:
+    //   If the named column is already sorted in both self and rhs. It works
+    //   the same way as in join_by_index() above.
     //
     template<typename RHS_T, comparable T, typename ... Ts>
     [[nodiscard]] DataFrame<unsigned int, H>
-    join_by_column(const RHS_T &rhs, const char *name, join_policy jp) const;
+    join_by_column(const RHS_T &rhs,
+                   const char *name,
+                   join_policy jp,
+                   sort_state already_sorted = sort_state::not_sorted) const;
+
+    // It joins each row of self (lhs) with the rhs row that has the nearest
+    // index in the direction given by asof_policy, for example the last
+    // quote at or before each trade. The result has the lhs index and all
+    // lhs rows. rhs columns are gathered from the matched rows. Rows with
+    // no match get nan in the rhs columns. Columns with the same name in both
+    // are named lhs.<name> and rhs.<name>, as in join_by_index().
+    // Both indices must be sorted, otherwise NotFeasible is thrown.
+    // It is one linear pass over both indices.
+    //
+    // RHS_T:
+    //   Type of DataFrame rhs
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // rhs:
+    //   The rhs DataFrame
+    // ap:
+    //   Specifies the direction of the match (See asof_policy definition)
+    // tolerance:
+    //   If given, matches farther than this are dropped. The distance is
+    //   the difference of the two indices as a double. For DateTime that is
+    //   in seconds.
+    //
+    template<typename RHS_T, typename ... Ts>
+    [[nodiscard]] DataFrame<I, H>
+    join_asof(const RHS_T &rhs,
+              asof_policy ap = asof_policy::backward,
+              std::optional<double> tolerance = { }) const;
+
+    // Same as join_asof() above, but an lhs row is only matched with rhs rows
+    // that have the same value in the by_name column, for example the same
+    // symbol.
+    //
+    // T:
+    //   Type of the by_name column
+    // by_name:
+    //   Name of the column that must match between lhs and rhs
+    //
+    template<typename RHS_T, comparable T, typename ... Ts>
+    [[nodiscard]] DataFrame<I, H>
+    join_asof(const RHS_T &rhs,
+              const char *by_name,
+              asof_policy ap = asof_policy::backward,
+              std::optional<double> tolerance = { }) const;
 
     // It concatenates rhs to the end of self and returns the result as
     // another DataFrame.
@@ -1905,7 +2109,9 @@ public: // Read/access and slicing interfaces
 
     // It returns a DataFrame (including the index and data columns)
     // containing the data from index begin to index end.
-    // DataFrame must be sorted by index or behavior is undefined.
+    // If the index is sorted (see is_index_sorted()), the range is found by
+    // binary search. Otherwise, all rows with begin <= index <= end are
+    // selected by a linear scan, in their original order.
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -1944,6 +2150,8 @@ public: // Read/access and slicing interfaces
     //       For example, you cannot add/delete columns, etc.
     // NOTE: Views could not be const, becuase you can change original data
     //       through views.
+    // NOTE: Since the view is a contiguous range, the index must be sorted.
+    //       Otherwise, it throws NotFeasible.
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -2077,6 +2285,14 @@ public: // Read/access and slicing interfaces
     //       empty columns will _not_ be padded with NaN's. You can always
     //       call make_consistent() on the original or result DataFrame to make
     //       all columns into consistent length
+    // NOTE: If parallel is true and sel_functor can be called as const,
+    //       large DataFrames are scanned in parallel chunks. Then sel_functor
+    //       is called from several threads at once and not in row order, so
+    //       it must not modify shared state. A functor with a non-const
+    //       operator() (e.g. a mutable lambda) is always called on one thread
+    //       in row order. This applies to all get_data_by_sel(),
+    //       get_view_by_sel() and remove_data_by_sel() methods that take
+    //       parallel
     //
     // T:
     //   Type of the named column
@@ -2089,10 +2305,13 @@ public: // Read/access and slicing interfaces
     //   Name of the data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T, typename F, typename ... Ts>
     [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-    get_data_by_sel(const char *name, F &sel_functor) const;
+    get_data_by_sel(const char *name, F &sel_functor,
+                    bool parallel = false) const;
 
     // This is identical with above get_data_by_sel(), but:
     //   1) The result is a view
@@ -2110,14 +2329,18 @@ public: // Read/access and slicing interfaces
     //   Name of the data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T, typename F, typename ... Ts>
     [[nodiscard]] PtrView
-    get_view_by_sel(const char *name, F &sel_functor);
+    get_view_by_sel(const char *name, F &sel_functor,
+                    bool parallel = false);
 
     template<typename T, typename F, typename ... Ts>
     [[nodiscard]] ConstPtrView
-    get_view_by_sel(const char *name, F &sel_functor) const;
+    get_view_by_sel(const char *name, F &sel_functor,
+                    bool parallel = false) const;
 
     // This does the same function as above get_data_by_sel() but operating
     // on two columns.
@@ -2139,12 +2362,15 @@ public: // Read/access and slicing interfaces
     //   Name of the second data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename F, typename ... Ts>
     [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
     get_data_by_sel(const char *name1,
                     const char *name2,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     // This is identical with above get_data_by_sel(), but:
     //   1) The result is a view
@@ -2169,14 +2395,18 @@ public: // Read/access and slicing interfaces
     //   Name of the second data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename F, typename ... Ts>
     [[nodiscard]] PtrView
-    get_view_by_sel(const char *name1, const char *name2, F &sel_functor);
+    get_view_by_sel(const char *name1, const char *name2, F &sel_functor,
+                    bool parallel = false);
 
     template<typename T1, typename T2, typename F, typename ... Ts>
     [[nodiscard]] ConstPtrView
-    get_view_by_sel(const char *name1, const char *name2, F &sel_functor) const;
+    get_view_by_sel(const char *name1, const char *name2, F &sel_functor,
+                    bool parallel = false) const;
 
     // This does the same function as above get_data_by_sel() but operating
     // on three columns.
@@ -2202,6 +2432,8 @@ public: // Read/access and slicing interfaces
     //   Name of the third data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename T3, typename F,
              typename ... Ts>
@@ -2209,7 +2441,8 @@ public: // Read/access and slicing interfaces
     get_data_by_sel(const char *name1,
                     const char *name2,
                     const char *name3,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     // This is identical with above get_data_by_sel(), but:
     //   1) The result is a view
@@ -2238,6 +2471,8 @@ public: // Read/access and slicing interfaces
     //   Name of the third data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename T3, typename F,
              typename ... Ts>
@@ -2245,7 +2480,8 @@ public: // Read/access and slicing interfaces
     get_view_by_sel(const char *name1,
                     const char *name2,
                     const char *name3,
-                    F &sel_functor);
+                    F &sel_functor,
+                    bool parallel = false);
 
     template<typename T1, typename T2, typename T3, typename F,
              typename ... Ts>
@@ -2253,7 +2489,8 @@ public: // Read/access and slicing interfaces
     get_view_by_sel(const char *name1,
                     const char *name2,
                     const char *name3,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     // This does the same function as above get_data_by_sel() but operating
     // on four columns.
@@ -2284,6 +2521,8 @@ public: // Read/access and slicing interfaces
     //   Name of the fourth data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename T3, typename T4, typename F,
              typename ... Ts>
@@ -2292,7 +2531,8 @@ public: // Read/access and slicing interfaces
                     const char *name2,
                     const char *name3,
                     const char *name4,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     // This is identical with above get_data_by_sel(), but:
     //   1) The result is a view
@@ -2325,6 +2565,8 @@ public: // Read/access and slicing interfaces
     //   Name of the fourth data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename T3, typename T4, typename F,
              typename ... Ts>
@@ -2333,7 +2575,8 @@ public: // Read/access and slicing interfaces
                     const char *name2,
                     const char *name3,
                     const char *name4,
-                    F &sel_functor);
+                    F &sel_functor,
+                    bool parallel = false);
 
     template<typename T1, typename T2, typename T3, typename T4, typename F,
              typename ... Ts>
@@ -2342,7 +2585,8 @@ public: // Read/access and slicing interfaces
                     const char *name2,
                     const char *name3,
                     const char *name4,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     // This does the same function as above get_data_by_sel() but operating
     // on five columns.
@@ -2377,6 +2621,8 @@ public: // Read/access and slicing interfaces
     //   Name of the fifth data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename T3, typename T4, typename T5,
              typename F, typename ... Ts>
@@ -2386,7 +2632,8 @@ public: // Read/access and slicing interfaces
                     const char *name3,
                     const char *name4,
                     const char *name5,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     // This is identical with above get_data_by_sel(), but:
     //   1) The result is a view
@@ -2423,6 +2670,8 @@ public: // Read/access and slicing interfaces
     //   Name of the fifth data column
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename T1, typename T2, typename T3, typename T4, typename T5,
              typename F, typename ... Ts>
@@ -2432,7 +2681,8 @@ public: // Read/access and slicing interfaces
                     const char *name3,
                     const char *name4,
                     const char *name5,
-                    F &sel_functor);
+                    F &sel_functor,
+                    bool parallel = false);
 
     template<typename T1, typename T2, typename T3, typename T4, typename T5,
              typename F, typename ... Ts>
@@ -2442,7 +2692,8 @@ public: // Read/access and slicing interfaces
                     const char *name3,
                     const char *name4,
                     const char *name5,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     // Data by select for larger number of columns
     //
@@ -2462,7 +2713,8 @@ public: // Read/access and slicing interfaces
                     const char *name9,
                     const char *name10,
                     const char *name11,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     template<typename T1, typename T2, typename T3, typename T4, typename T5,
              typename T6, typename T7, typename T8, typename T9, typename T10,
@@ -2481,7 +2733,8 @@ public: // Read/access and slicing interfaces
                     const char *name10,
                     const char *name11,
                     const char *name12,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     template<typename T1, typename T2, typename T3, typename T4, typename T5,
              typename T6, typename T7, typename T8, typename T9, typename T10,
@@ -2501,7 +2754,8 @@ public: // Read/access and slicing interfaces
                     const char *name11,
                     const char *name12,
                     const char *name13,
-                    F &sel_functor) const;
+                    F &sel_functor,
+                    bool parallel = false) const;
 
     // This method does boolean filtering selection via the sel_functor
     // (e.g. a functor, function, or lambda). It returns a new DataFrame.
@@ -2535,10 +2789,12 @@ public: // Read/access and slicing interfaces
     //
     // sel_functor:
     //   A reference to the selecting functor
+    // parallel:
+    //   If true, the rows may be scanned in parallel (see get_data_by_sel())
     //
     template<typename Tuple, typename F, typename... FilterCols>
     [[nodiscard]] DataFrame
-    get_data_by_sel(F &sel_functor) const;
+    get_data_by_sel(F &sel_functor, bool parallel = false) const;
 
     // This method does boolean filtering selection via the sel_functor
     // (e.g. a functor, function, or lambda). It returns a new DataFrame.
@@ -2579,6 +2835,45 @@ public: // Read/access and slicing interfaces
     [[nodiscard]] DataFrame
     get_data_by_sel(F &sel_functor, FilterCols&&... filter_cols) const;
 
+    // Same as above get_data_by_sel(), but the rows may be scanned in
+    // parallel, if parallel is true (see get_data_by_sel())
+    //
+    template<typename Tuple, typename F, typename... FilterCols>
+    [[nodiscard]] DataFrame
+    get_data_by_sel(F &sel_functor,
+                    bool parallel,
+                    FilterCols&&... filter_cols) const;
+
+    // These select the rows that satisfy all the given column predicates,
+    // such as "price > 8.0 and volume >= 100". They return the same as the
+    // get_data_by_sel() and get_view_by_sel() methods above.
+    // Unlike a selecting functor, the predicates are evaluated a column at a
+    // time, 64 rows at a time, without branches, into a bitmask. The masks of
+    // multiple predicates are combined with and. The number of selected rows
+    // is known from the mask before anything is gathered.
+    // Rows past the end of a predicate column are not selected. A predicate
+    // can be on the index, by DF_INDEX_COL_NAME.
+    //
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // Ps:
+    //   Types of the predicate columns. They are deduced from preds
+    // preds:
+    //   One or more column predicates (See ColumnPred definition)
+    //
+    template<typename ... Ts, typename ... Ps>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
+    get_data_by_pred(const ColumnPred<Ps> & ... preds) const;
+
+    template<typename ... Ts, typename ... Ps>
+    [[nodiscard]] PtrView
+    get_view_by_pred(const ColumnPred<Ps> & ... preds);
+
+    template<typename ... Ts, typename ... Ps>
+    [[nodiscard]] ConstPtrView
+    get_view_by_pred(const ColumnPred<Ps> & ... preds) const;
+
     // This method does a basic Glob-like pattern matching (also similar to
     // SQL like clause) to filter data in the named column.
     // It returns a new DataFrame. Each element of the named column is checked
@@ -2804,10 +3099,24 @@ public: // Read/access and slicing interfaces
     get_index() const;
 
     // It returns a reference to the index container
+    // NOTE: Since the index could be modified through the returned
+    //       reference, the cached sortedness of the index is discarded.
+    //       Modifying the index through a reference that was retained
+    //       across other DataFrame calls is not tracked.
     //
     [[nodiscard]] IndexVecType &
     get_index();
 
+    // It returns true if the index is sorted in ascending order.
+    // The answer is computed once and cached. The cache is maintained by
+    // all DataFrame methods that modify the index (load, append, remove,
+    // sort, shuffle, ...). Selection by index range, joins by index,
+    // bucketizing, and groupby on the index use it to skip sorting or
+    // binary-search instead of scanning.
+    //
+    [[nodiscard]] bool
+    is_index_sorted() const;
+
     /*
     // It prints to stdout n rows of all columns either from the beginning
     // or end of the DataFrame. Print will be in csv2 format.
@@ -3268,6 +3577,12 @@ public:  // Visitors
     //
     // NOTE: The second member of pair is a _pointer_ to the function or
     //       functor object
+    // NOTE: Function objects on the same column are run together in one
+    //       pass over the column, a cache sized block of rows at a time.
+    //       To do the same with single_act_visit(), see FusedVisitor.
+    // NOTE: If the same function object is given more than once, it is only
+    //       run on the column of its last pair, as if the pairs were run one
+    //       after another.
     //
     template<typename ... Ts>
     void
@@ -3363,6 +3678,38 @@ public:  // Visitors
     visit_async(const char *name1, const char *name2, V &visitor,
                 bool in_reverse = false) const;
 
+    // These are similar to above visit(), but the rows are split into
+    // chunks that are visited in parallel, one chunk per thread. Each chunk
+    // is visited by a copy of the visitor. The partial states are merged
+    // pairwise, in row order, into visitor and then post() is called.
+    // The number of chunks is decided by the threading cost model. If it is
+    // not worth using threads, it is the same as visit().
+    // The visitor must be mergeable (see mergeable_visitor). Sum, Count,
+    // Mean, Min, Max, Var, Std, Cov, Corr (pearson) and DotProd visitors are
+    // mergeable. A visitor that cannot be merged in its configuration, e.g. a
+    // spearman CorrVisitor, throws NotFeasible for any number of rows.
+    // Var, Std, Cov and Corr merge the counts, means and centered moments of
+    // the chunks. So they match visit() even for near-constant data.
+    //
+    // T:
+    //   Type of the named column
+    // V:
+    //   Type of the visitor functor
+    // name:
+    //   Name of the data column
+    // visitor:
+    //   An instance of the visitor
+    //
+    template<typename T, mergeable_visitor V>
+    V &
+    parallel_visit(const char *name, V &visitor) const;
+
+    // Same as above parallel_visit(), but for visitors of two columns
+    //
+    template<typename T1, typename T2, mergeable_visitor V>
+    V &
+    parallel_visit(const char *name1, const char *name2, V &visitor) const;
+
     // It passes the values of each index and the three named columns to the
     // functor visitor sequentially from beginning to end
     //
@@ -4088,6 +4435,20 @@ public:  // Reading and writing
     //   1) Column “INDEX” must be the first column
     //   2) Fields in column dictionaries must be in N, T, D order
     //
+    // io_format::binary is a DataFrame specific columnar format. It has a
+    // column directory with the same type names as csv2, data blocks aligned
+    // to at least align_value and a heap for strings. It supports arithmetic,
+    // bool, DateTime and std::string columns. Other types throw
+    // NotImplemented. It is native-endian and is meant for fast reloading
+    // of large DataFrames, not for exchanging data. The stream must be opened
+    // in binary mode. precision is ignored.
+    //
+    // io_format::csv2 data is formatted one column at a time into a buffer
+    // with std::to_chars and written in large blocks. With a thread level
+    // above 2, large DataFrames are formatted in parallel. This applies when
+    // the stream has default format flags. Otherwise, the stream formats
+    // every cell. Both give the same output.
+    //
     // S:
     //   Output stream type
     // Ts:
@@ -4191,6 +4552,18 @@ public:  // Reading and writing
     //   1) Column “INDEX” must be the first column
     //   2) Fields in column dictionaries must be in N, T, D order
     //
+    // io_format::binary reads files written by write() in the same format.
+    // When reading from a file name, the file is memory mapped and
+    // fixed-width columns are bulk copied straight out of the mapping
+    // without any parsing. Reading in chunks is supported.
+    //
+    // When reading io_format::csv2 from a file name, the file is memory
+    // mapped and cells are parsed in place. Numbers are converted with
+    // std::from_chars without copying each cell into a string. With a
+    // thread level above 2, large files are also split on row boundaries
+    // and the rows are parsed in parallel by the thread pool. The result is
+    // the same as reading the file through a stream.
+    //
     // file_name:
     //   Complete path to the file
     // iof:
@@ -4283,6 +4656,11 @@ private:
     template<typename ALT_I, typename ALT_H>
     friend class DataFrame;
 
+    // The chunked reader uses the csv2 parsing internals
+    //
+    template<typename DF>
+    friend class DataFrameReader;
+
     // Maps column names to their vector index
     //
     using ColNameDict =
@@ -4302,6 +4680,13 @@ private:
     IndexVecType    indices_ { };    // Vector
     ColNameDict     column_tb_ { };  // Hash table of name -> vector index
 
+    // Cached ascending-order state of indices_. It is computed lazily by
+    // is_index_sorted() and maintained by the methods that change the index
+    //
+    enum class  IdxOrder : unsigned char  { unknown, sorted, not_sorted };
+
+    mutable std::atomic<IdxOrder>   idx_order_ { IdxOrder::unknown };
+
     // This is necessary to have a deterministic column order across all
     // implementations
     //
@@ -89,10 +89,14 @@ struct  ReturnVisitor  {
 
         result_type result(col_s);
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&result, &column_begin, &func]
@@ -163,9 +167,14 @@ private:
                   result.size() });
 
         col_to_short_term_.resize(col_s);
-        if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level_ > 2 && thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &prices_begin, this]
@@ -204,9 +213,14 @@ private:
                   result.size() });
 
         col_to_long_term_.resize(col_s);
-        if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level_ > 2 && thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &prices_begin, this]
@@ -277,9 +291,14 @@ public:
         const size_type col_s = std::min<size_type>(re_count1, re_count2);
 
         short_term_to_long_term_.resize(col_s);
-        if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level_ > 2 && thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [this]
@@ -394,9 +413,9 @@ public:
                 const H &prices_begin, const H &prices_end)  {
 
         const auto  thread_level =
-            (std::distance(prices_begin, prices_end) <
-                 ThreadPool::MUL_THR_THHOLD)
-                     ? 0L : ThreadGranularity::get_thread_level();
+            ThreadGranularity::get_thread_level(
+                std::distance(prices_begin, prices_end),
+                ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         if (thread_level > 2)  {
             std::future<void>   fut1 =
@@ -441,6 +460,7 @@ public:
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&prices_begin,
@@ -533,8 +553,9 @@ struct  MACDVisitor  {
             std::min<size_type>(
                 { size_t(std::distance(idx_begin, idx_end)),
                   size_t(std::distance(column_begin, column_end)) });
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         short_roller.pre();
         long_roller.pre();
@@ -575,6 +596,7 @@ struct  MACDVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [this,
@@ -608,6 +630,7 @@ struct  MACDVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [this,
@@ -1465,8 +1488,9 @@ private:
          const H &ts_begin, const H &ts_end,
          result_type &result, size_type col_s)  {
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         stdev_.pre();
         ret_v_.pre();
@@ -1505,6 +1529,7 @@ private:
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [this]
@@ -1557,6 +1582,7 @@ private:
             result.resize(col_s);
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, this]
@@ -1812,10 +1838,14 @@ struct  MassIndexVisitor  {
             else [[likely]]  break;
         }
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&fast_roller = std::as_const(fast_roller.get_result()),
@@ -1885,8 +1915,9 @@ struct  HullRollingMeanVisitor  {
 
         GET_COL_SIZE
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         wma_t   wma_half { WeightedMeanVisitor<T, I>(), roll_count_ / 2 };
         wma_t   wma_full { WeightedMeanVisitor<T, I>(), roll_count_ };
@@ -1926,6 +1957,7 @@ struct  HullRollingMeanVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s - 1,
                     [&wma_full = std::as_const(wma_full.get_result()),
@@ -2077,14 +2109,18 @@ struct  DrawdownVisitor  {
         const auto              &cm_result { cm_v.get_result() };
         constexpr value_type    one { 1 };
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             drawdown_.resize(col_s);
             pct_drawdown_.resize(col_s);
             log_drawdown_.resize(col_s);
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin,
@@ -2158,8 +2194,9 @@ struct  WilliamPrcRVisitor  {
                 const H &close_begin, const H &close_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(low_begin, low_end)) ||
@@ -2209,6 +2246,7 @@ struct  WilliamPrcRVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&min_v = std::as_const(min_v.get_result()),
@@ -2273,12 +2311,17 @@ struct  PSLVisitor  {
 
         const size_type col_s = std::distance(close_begin, close_end);
 
-        if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level_ > 2 && thread_level > 2)  {
             result_.resize(col_s);
             result_[0] = 0;
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&close_begin, this]
@@ -2319,9 +2362,14 @@ struct  PSLVisitor  {
 #endif // HMDF_SANITY_EXCEPTIONS
 
         result_.resize(col_s);
-        if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level_ > 2 && thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&close_begin, &open_begin, this]
@@ -2369,9 +2417,14 @@ private:
 
         const size_type col_s { result_.size() };
 
-        if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level_ > 2 && thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [this, &sum_r = std::as_const(sum_r.get_result())]
@@ -2415,8 +2468,9 @@ struct  CCIVisitor  {
                 const H &close_begin, const H &close_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(low_begin, low_end)) ||
@@ -2433,6 +2487,7 @@ struct  CCIVisitor  {
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result,
@@ -2474,6 +2529,7 @@ struct  CCIVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result,
@@ -2548,10 +2604,14 @@ struct  GarmanKlassVolVisitor  {
         result_type             result(
             col_s, std::numeric_limits<T>::quiet_NaN());
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     roll_count_,
                     col_s,
                     [this, &result,
@@ -2652,10 +2712,14 @@ struct  YangZhangVolVisitor  {
         const value_type    norm { T(1) / T(roll_count_ - 1) };
         result_type         result(col_s, std::numeric_limits<T>::quiet_NaN());
 
-        if (col_s >= (ThreadPool::MUL_THR_THHOLD / 2) &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     roll_count_,
                     col_s,
                     [this, &result,
@@ -2790,10 +2854,14 @@ struct  KamaVisitor  {
 
         result_type peer_diff (col_s, std::numeric_limits<T>::quiet_NaN());
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&peer_diff, &column_begin]
@@ -2878,8 +2946,9 @@ struct  FisherTransVisitor  {
                 const H &high_begin, const H &high_end)  {
 
         const size_type col_s = std::distance(low_begin, low_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(high_begin, high_end)) ||
@@ -2893,6 +2962,7 @@ struct  FisherTransVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&mid_hl, &low_begin, &high_begin]
@@ -2926,6 +2996,7 @@ struct  FisherTransVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&min_v = std::as_const(min_v.get_result()),
@@ -3026,10 +3097,14 @@ struct  PercentPriceOSCIVisitor  {
 
         result_type result { std::move(slow_roller.get_result()) };
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result,
@@ -3130,10 +3205,14 @@ struct  SlopeVisitor  {
         result_type             result { std::move(diff.get_result()) };
         constexpr value_type    pi_180 { T(180) / T(M_PI) };
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, this]
@@ -3210,8 +3289,9 @@ struct  UltimateOSCIVisitor  {
                 const H &close_begin, const H &close_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(low_begin, low_end)) ||
@@ -3226,6 +3306,7 @@ struct  UltimateOSCIVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&max_high, &min_low,
@@ -3257,6 +3338,7 @@ struct  UltimateOSCIVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&max_high, &min_low, &close_begin,
@@ -3320,6 +3402,7 @@ struct  UltimateOSCIVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [this, &result, total_weights,
@@ -3415,8 +3498,9 @@ struct  UlcerIndexVisitor  {
 
         GET_COL_SIZE2
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         SimpleRollAdopter<MaxVisitor<T, I>, T, I, A>    high {
             MaxVisitor<T, I> { true }, periods_ };
@@ -3430,6 +3514,7 @@ struct  UlcerIndexVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &column_begin]
@@ -3479,6 +3564,7 @@ struct  UlcerIndexVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &vec = std::as_const(vec), this]
@@ -3555,13 +3641,15 @@ struct  TTMTrendVisitor  {
                                  "equal sizes and bar period < column size");
 #endif // HMDF_SANITY_EXCEPTIONS
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
         avg_vec_t   trend_avg(col_s, std::numeric_limits<T>::quiet_NaN());
 
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     bar_periods_,
                     col_s,
                     [&trend_avg, &high_begin, &low_begin]
@@ -3590,6 +3678,7 @@ struct  TTMTrendVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&trend_avg, this]
@@ -3611,6 +3700,7 @@ struct  TTMTrendVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [this, &close_begin, &trend_avg = std::as_const(trend_avg)]
@@ -4032,8 +4122,9 @@ struct  VarIdxDynAvgVisitor  {
         diff (idx_begin, idx_end, column_begin, column_end);
         diff.post();
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
         result_type positive { std::move(diff.get_result()) };
 
         positive[0] = 0;
@@ -4043,6 +4134,7 @@ struct  VarIdxDynAvgVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&positive, &negative]
@@ -4081,6 +4173,7 @@ struct  VarIdxDynAvgVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     roll_period_,
                     col_s,
                     [&positive, &negative, &result]
@@ -4169,8 +4262,9 @@ struct  PivotPointSRVisitor  {
                                  "equal sizes and column size > 1");
 #endif // HMDF_SANITY_EXCEPTIONS
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         constexpr value_type two = 2;
 
@@ -4185,6 +4279,7 @@ struct  PivotPointSRVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&close_begin, &low_begin, &high_begin,
@@ -4310,8 +4405,9 @@ struct  AvgDirMovIdxVisitor  {
                                  "equal size and column size > 3");
 #endif // HMDF_SANITY_EXCEPTIONS
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
         result_type pos_di(col_s);
         result_type neg_di(col_s);
         result_type true_range(col_s);
@@ -4319,6 +4415,7 @@ struct  AvgDirMovIdxVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&close_begin, &low_begin, &high_begin,
@@ -4640,13 +4737,15 @@ struct  CenterOfGravityVisitor  {
                 "CenterOfGravityVisitor: 0 < roll count < column size");
 #endif // HMDF_SANITY_EXCEPTIONS
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
         result_type result (col_s, std::numeric_limits<T>::quiet_NaN());
 
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     roll_count_ - 1,
                     col_s,
                     [this, &column_begin, &result]
@@ -4688,6 +4787,7 @@ struct  CenterOfGravityVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&sum_v = std::as_const(sum_v.get_result()), &result]
@@ -4758,10 +4858,14 @@ struct  ArnaudLegouxMAVisitor  {
 
         result_type result (col_s, std::numeric_limits<T>::quiet_NaN());
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     roll_count_,
                     col_s,
                     [this, &column_begin, &result]
@@ -4862,10 +4966,14 @@ struct  RateOfChangeVisitor  {
 
         result_type result { std::move(diff.get_result()) };
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     period_,
                     col_s,
                     [this, &column_begin, &result]
@@ -4938,10 +5046,14 @@ struct  AccumDistVisitor  {
 
         result_type result (col_s, std::numeric_limits<T>::quiet_NaN());
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result,
@@ -5023,8 +5135,9 @@ struct  ChaikinMoneyFlowVisitor  {
                                  "column size");
 #endif // HMDF_SANITY_EXCEPTIONS
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
         result_type result (col_s, std::numeric_limits<T>::quiet_NaN());
 
         for (size_type i { 0 }; i < col_s; ++i) [[likely]]  {
@@ -5048,6 +5161,7 @@ struct  ChaikinMoneyFlowVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &sum = std::as_const(sum.get_result())]
@@ -5104,8 +5218,9 @@ struct  VertHorizFilterVisitor  {
                                  "column size");
 #endif // HMDF_SANITY_EXCEPTIONS
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         SimpleRollAdopter<MaxVisitor<T, I>, T, I, A>    mx
             { MaxVisitor<T, I>(), period_ };
@@ -5158,6 +5273,7 @@ struct  VertHorizFilterVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&diff = diff.get_result()]
@@ -5186,6 +5302,7 @@ struct  VertHorizFilterVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     period_,
                     col_s,
                     [&result,
@@ -5264,10 +5381,14 @@ struct  OnBalanceVolumeVisitor  {
         result_type result { std::move(ret.get_result()) };
 
         result[0] = T(1);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &volume_begin]
@@ -5321,14 +5442,16 @@ struct  TrueRangeVisitor  {
                 const H &close_begin, const H &close_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
         result_type     result (col_s);
 
         result[0] = *high_begin - *low_begin;
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&low_begin, &high_begin, &close_begin, &result]
@@ -5373,6 +5496,7 @@ struct  TrueRangeVisitor  {
                 if (thread_level > 2)  {
                     auto    futures =
                         ThreadGranularity::thr_pool_.parallel_loop(
+                            thread_level,
                             size_type(0),
                             col_s,
                             [&close_begin, &result]
@@ -5444,10 +5568,14 @@ struct  DecayVisitor  {
             expo_ ? std::exp(-T(period_)) : (T(1) / T(period_)) };
 
         result[0] = *column_begin;
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&result, &column_begin, decay]
@@ -5537,10 +5665,14 @@ struct  HodgesTompkinsVolVisitor  {
                     ((T(roll_count_ * roll_count_) -
                       T(1)) / (T(3) * n * n))) };
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result,annual, adj_factor]
@@ -5610,14 +5742,16 @@ struct  ParkinsonVolVisitor  {
                                  "equal sizes and roll count < column size");
 #endif // HMDF_SANITY_EXCEPTIONS
 
-        const auto          thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto          thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
         result_type         result (col_s);
         const value_type    factor { T(1) / (T(4) * std::log(T(2))) };
 
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &low_begin, &high_begin, factor]
@@ -5656,6 +5790,7 @@ struct  ParkinsonVolVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     roll_count_ - 1,
                     col_s,
                     [&result, this]
@@ -5712,8 +5847,9 @@ struct  CoppockCurveVisitor  {
 
         GET_COL_SIZE2
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         roc_v<T, I, A>  roc_l (roc_long_);
         roc_v<T, I, A>  roc_s (roc_short_);
@@ -5753,6 +5889,7 @@ struct  CoppockCurveVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&roc_s = std::as_const(roc_s.get_result()), &result]
@@ -5854,10 +5991,14 @@ struct  BalanceOfPowerVisitor  {
                     high_begin, high_end, low_begin, low_end);
         non_z_range.post();
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&non_z_range = std::as_const(non_z_range.get_result()),
@@ -5926,8 +6067,9 @@ struct  ChandeKrollStopVisitor  {
                 const H &close_begin, const H &close_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(low_begin, low_end)) ||
@@ -5984,6 +6126,7 @@ struct  ChandeKrollStopVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&atr = std::as_const(atr.get_result()),
@@ -6041,6 +6184,7 @@ struct  ChandeKrollStopVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&atr = std::as_const(atr.get_result()),
@@ -6147,12 +6291,14 @@ struct  VortexVisitor  {
         result_type plus_indicator(col_s, std::numeric_limits<T>::quiet_NaN());
         result_type minus_indicator(col_s,
                                     std::numeric_limits<T>::quiet_NaN());
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&high_begin, &low_begin,
@@ -6199,6 +6345,7 @@ struct  VortexVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&tr_sum = std::as_const(tr_sum.get_result()),
@@ -6270,8 +6417,9 @@ struct  KeltnerChannelsVisitor  {
                 const H &close_begin, const H &close_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(low_begin, low_end)) ||
@@ -6338,6 +6486,7 @@ struct  KeltnerChannelsVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&basis = std::as_const(basis.get_result()),
@@ -6361,6 +6510,7 @@ struct  KeltnerChannelsVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&band = std::as_const(band.get_result()),
@@ -6523,8 +6673,9 @@ struct  PrettyGoodOsciVisitor  {
                 const H &close_begin, const H &close_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(low_begin, low_end)) ||
@@ -6583,6 +6734,7 @@ struct  PrettyGoodOsciVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &close_begin]
@@ -6615,6 +6767,7 @@ struct  PrettyGoodOsciVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&ewm = std::as_const(ewm.get_result()),
@@ -6716,10 +6869,14 @@ struct  T3MovingMeanVisitor  {
                              1.0 };
         result_type     result { std::move(e6.get_result()) };
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&e5 = std::as_const(e5.get_result()),
@@ -6813,8 +6970,11 @@ struct  TreynorRatioVisitor  {
         BetaVisitor<T, I>   beta_vis { biased_ };
 
         beta_vis.pre();
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    fut1 =
                 ThreadGranularity::thr_pool_.dispatch(
                     false,
@@ -6828,6 +6988,7 @@ struct  TreynorRatioVisitor  {
                     });
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&asset_ret_begin, &benchmark_ret_begin]
@@ -7008,10 +7169,14 @@ struct  RelativeVigorIndexVisitor  {
 
         result_type result(col_s);  // rvgi
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&close_open_range = std::as_const(close_open_range),
@@ -7101,10 +7266,14 @@ struct  ElderRayIndexVisitor  {
         result_type bulls = ewm.get_result();
         result_type bears = std::move(ewm.get_result());
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&bulls, &bears, &low_begin, &high_begin]
@@ -7171,8 +7340,9 @@ struct  ChopIndexVisitor  {
                 const H &low_begin, const H &low_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(high_begin, high_end)) ||
@@ -7244,6 +7414,7 @@ struct  ChopIndexVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&minv = std::as_const(minv.get_result()), &diff]
@@ -7276,6 +7447,7 @@ struct  ChopIndexVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&atr_sum = std::as_const(atr_sum.get_result()), &diff,
@@ -7354,10 +7526,14 @@ struct  DetrendPriceOsciVisitor  {
         const size_type shift { roll_period_ / 2 + 1 };
         result_type     result(col_s, std::numeric_limits<T>::quiet_NaN());
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     shift,
                     col_s,
                     [&savg = std::as_const(savg.get_result()),
@@ -7439,10 +7615,14 @@ struct  AccelerationBandsVisitor  {
         result_type lower_band(col_s);
         result_type upper_band(col_s);
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&nzr = std::as_const(nzr.get_result()),
@@ -7542,8 +7722,9 @@ struct  PriceDistanceVisitor  {
                 const H &close_begin, const H &close_end)  {
 
         const size_type col_s = std::distance(close_begin, close_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(low_begin, low_end)) ||
@@ -7564,6 +7745,7 @@ struct  PriceDistanceVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&nzr = std::as_const(nzr.get_result()), &result]
@@ -7592,6 +7774,7 @@ struct  PriceDistanceVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&nzr = std::as_const(nzr.get_result()), &result]
@@ -7618,6 +7801,7 @@ struct  PriceDistanceVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&nzr = std::as_const(nzr.get_result()), &result]
@@ -7670,8 +7854,9 @@ struct  EldersThermometerVisitor  {
                 const H &high_begin, const H &high_end)  {
 
         const size_type col_s = std::distance(low_begin, low_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(high_begin, high_end)))
@@ -7684,6 +7869,7 @@ struct  EldersThermometerVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&result, &low_begin, &high_begin]
@@ -7725,6 +7911,7 @@ struct  EldersThermometerVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&ewm = std::as_const(ewm.get_result()),
@@ -7829,10 +8016,14 @@ struct  EldersForceIndexVisitor  {
 
         result_type result = std::move(diff.get_result());;
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &volume_begin]
@@ -7902,10 +8093,14 @@ struct  EaseOfMovementVisitor  {
 
         result_type result(col_s, std::numeric_limits<T>::quiet_NaN());
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(1),
                     col_s,
                     [&result, &low_begin, &high_begin, &volume_begin, this]
@@ -7999,10 +8194,14 @@ struct  PriceVolumeTrendVisitor  {
 
         result_type result { std::move(ret.get_result()) };
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &volume_begin]
@@ -8101,10 +8300,14 @@ struct  QuantQualEstimationVisitor  {
         result_type upperband(col_s);
         result_type lowerband(col_s);
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&ewm3 = std::as_const(ewm3.get_result()),
@@ -526,9 +526,14 @@ private:
 
         const real_t    col_s = real_t(xvec.size());
 
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     size_type(col_s),
                     [&xvec, &yvec](auto begin, auto end) -> void  {
@@ -547,9 +552,14 @@ private:
 
         transform_(xvec, true, thread_level);
 
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     size_type(col_s),
                     [&xvec, col_s](auto begin, auto end) -> void  {
@@ -597,9 +607,14 @@ private:
             { (reverse ? real_t(2) : -real_t(2)) * real_t(M_PI) };
         result_type     exp_table (half_col_s);
 
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     half_col_s,
                     [&exp_table, two_pi, col_s]
@@ -656,9 +671,14 @@ private:
         const size_type col_s_2 { col_s * 2 };
         const real_t    pi { reverse ? real_t(M_PI) : -real_t(M_PI) };
 
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     col_s,
                     [&exp_table, pi, col_s, col_s_2]
@@ -691,9 +711,14 @@ private:
         //
         result_type xvec (m, cplx_t(0, 0));
 
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     col_s,
                     [&exp_table, &xvec, &column]
@@ -712,9 +737,14 @@ private:
         result_type yvec(m, cplx_t(0, 0));
 
         yvec[0] = exp_table[0];
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(1),
                     col_s,
                     [&exp_table, &yvec, m]
@@ -738,9 +768,14 @@ private:
 
         // Postprocessing
         //
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     exp_table.size(),
                     [&exp_table, &conv, &column]
@@ -778,9 +813,14 @@ private:
 
         // Conjugate the complex numbers
         //
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     col_s,
                     [&column]
@@ -812,9 +852,14 @@ private:
         // Conjugate the complex numbers again
         // Then scale the numbers
         //
-        if (thread_level > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     col_s,
                     [&column]
@@ -829,6 +874,7 @@ private:
             for (auto &fut : futures)  fut.get();
             futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     size_type(0),
                     col_s,
                     [&column, col_s]
@@ -863,12 +909,17 @@ public:
 
         result_type result (col_s);
 
-        if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level_ > 2 && thr_lvl > 2)  {
             std::vector<std::future<void>>  futures;
 
             if constexpr (is_complex<T>::value)  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thr_lvl,
                         size_type(0),
                         col_s,
                         [&column_begin, &result]
@@ -880,6 +931,7 @@ public:
             else  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thr_lvl,
                         size_type(0),
                         col_s,
                         [&column_begin, &result]
@@ -934,11 +986,16 @@ public:
         if (magnitude_.empty())  {
             const size_type col_s = result_.size();
 
-            if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+            if (const auto thr_lvl =
+                    ThreadGranularity::get_thread_level(
+                            col_s, ThreadGranularity::VISIT_WORK,
+                            1, sizeof(value_type));
+                thread_level_ > 2 && thr_lvl > 2)  {
                 magnitude_.resize(col_s);
 
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thr_lvl,
                         size_type(0),
                         col_s,
                         [this]
@@ -970,11 +1027,16 @@ public:
         if (angle_.empty())  {
             const size_type col_s = result_.size();
 
-            if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+            if (const auto thr_lvl =
+                    ThreadGranularity::get_thread_level(
+                            col_s, ThreadGranularity::VISIT_WORK,
+                            1, sizeof(value_type));
+                thread_level_ > 2 && thr_lvl > 2)  {
                 angle_.resize(col_s);
 
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thr_lvl,
                         size_type(0),
                         col_s,
                         [this]
@@ -1034,10 +1096,14 @@ struct  EntropyVisitor  {
 
         result_type result = std::move(sum_v.get_result());
 
-        if (result.size() >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    result.size(), ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         result.size(),
                         [&column_begin, &result, this]
@@ -1233,6 +1299,7 @@ private:
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this]
@@ -1259,6 +1326,7 @@ private:
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this]
@@ -1288,6 +1356,7 @@ private:
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this]
@@ -1313,6 +1382,7 @@ private:
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this]
@@ -1338,6 +1408,7 @@ private:
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this]
@@ -1363,6 +1434,7 @@ private:
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this]
@@ -1389,6 +1461,7 @@ private:
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this]
@@ -1431,8 +1504,9 @@ public:
 
         GET_COL_SIZE2
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         result_.resize(std::distance(column_begin, column_end));
         if (sigmoid_type_ == sigmoid_type::logistic)
@@ -1491,14 +1565,18 @@ public:
 
         GET_COL_SIZE2
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             std::vector<std::future<void>>  futures;
 
             result_.resize(col_s);
             if (rtype_ == rectify_type::ReLU)  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, this]
@@ -1511,6 +1589,7 @@ public:
             else if (rtype_ == rectify_type::param_ReLU)  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, this]
@@ -1526,6 +1605,7 @@ public:
             else if (rtype_ == rectify_type::GeLU)  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, this]
@@ -1546,6 +1626,7 @@ public:
                 sigm.post();
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, &sigm = std::as_const(sigm), this]
@@ -1561,6 +1642,7 @@ public:
             else if (rtype_ == rectify_type::softplus)  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, this]
@@ -1575,6 +1657,7 @@ public:
             else if (rtype_ == rectify_type::elu)  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, this]
@@ -1593,6 +1676,7 @@ public:
             else if (rtype_ == rectify_type::mish)  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, this]
@@ -1608,6 +1692,7 @@ public:
             else if (rtype_ == rectify_type::metallic_mean)  {
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, this]
@@ -1758,11 +1843,15 @@ struct  PolicyLearningLossVisitor  {
         // Negative Log Likelihood
         //
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&action_prob_begin, &reward_begin, this]
@@ -1839,13 +1928,17 @@ public:
             return;
         }
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             std::vector<std::future<void>>  futures;
 
             if (lft_ == loss_function_type::kullback_leibler)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
@@ -1866,6 +1959,7 @@ public:
             else if (lft_ == loss_function_type::mean_abs_error)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
@@ -1887,6 +1981,7 @@ public:
             else if (lft_ == loss_function_type::mean_sqr_error)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
@@ -1908,6 +2003,7 @@ public:
             else if (lft_ == loss_function_type::mean_sqr_log_error)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
@@ -1930,6 +2026,7 @@ public:
             else if (lft_ == loss_function_type::cross_entropy)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
@@ -1951,6 +2048,7 @@ public:
             else if (lft_ == loss_function_type::binary_cross_entropy)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
@@ -1973,6 +2071,7 @@ public:
             else if (lft_ == loss_function_type::categorical_hinge)  {
                 auto        futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
@@ -1992,6 +2091,7 @@ public:
                 for (auto &fut : futures)  neg += fut.get();
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
@@ -2015,6 +2115,7 @@ public:
             else if (lft_ == loss_function_type::log_cosh)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&actual_begin, &model_begin]
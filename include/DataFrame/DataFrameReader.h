@@ -0,0 +1,248 @@
+// Hossein Moein
+// September 22, 2017
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <DataFrame/DataFrame.h>
+
+#include <algorithm>
+#include <any>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <string>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Reads a csv2 file or stream in successive chunks of up to chunk_rows rows.
+// The header is parsed once and the position in the stream is kept between
+// chunks. So a file is read in one pass, no matter how many chunks it has,
+// and memory is bounded by the chunk size. This is how you run visitors
+// over files that do not fit in memory.
+// Comment and empty lines do not count as rows. So every chunk, except the
+// last one, has chunk_rows rows. Note that read() counts empty lines toward
+// num_rows. The index must be the first column.
+//
+// DF: A StdDataFrame type
+//
+template<typename DF>
+class   DataFrameReader  {
+
+public:
+
+    using DataFrameType = DF;
+    using size_type = typename DF::size_type;
+
+    DataFrameReader() = delete;
+    DataFrameReader(const DataFrameReader &) = delete;
+    DataFrameReader &operator = (const DataFrameReader &) = delete;
+
+    // file_name:
+    //   Complete path to the file
+    // chunk_rows:
+    //   Maximum number of rows in each chunk
+    // iof:
+    //   Only io_format::csv2 is supported
+    //
+    DataFrameReader(const char *file_name,
+                    size_type chunk_rows,
+                    io_format iof = io_format::csv2)
+        : file_(file_name, std::ios_base::in | std::ios_base::binary),
+          stream_(file_),
+          chunk_rows_(chunk_rows)  {
+
+        if (file_.fail()) [[unlikely]]  {
+            String1K    err;
+
+            err.printf("DataFrameReader: ERROR: Unable to open file '%s'",
+                       file_name);
+            throw DataFrameError(err.c_str());
+        }
+        init_(iof);
+    }
+
+    // stream:
+    //   An input stream positioned at the csv2 header. It must outlive
+    //   the reader
+    // chunk_rows:
+    //   Maximum number of rows in each chunk
+    // iof:
+    //   Only io_format::csv2 is supported
+    //
+    DataFrameReader(std::istream &stream,
+                    size_type chunk_rows,
+                    io_format iof = io_format::csv2)
+        : stream_(stream), chunk_rows_(chunk_rows)  { init_(iof); }
+
+    // Replaces the content of df with the next chunk of rows.
+    // It returns false and leaves df alone, if there are no more rows.
+    //
+    bool next(DF &df)  {
+
+        const size_type         col_s = ops_.size();
+        StlVecType<std::any>    col_vecs (col_s);
+
+        // A chunk with no rows in it (e.g. only comments at the end of the
+        // stream) is skipped. Reading stops only when the stream is done.
+        //
+        while (true)  {
+            const char  *end = scan_chunk_();
+            const char  *begin = buffer_.data() + pos_;
+
+            if (begin == end)  return (false);
+
+            for (size_type i = 0; i < col_s; ++i)
+                ops_[i].make(col_vecs[i],
+                             std::min(chunk_rows_, size_type(end - begin)));
+            DF::parse_csv2_chunk_(begin, end, ops_, col_vecs);
+            pos_ = end - buffer_.data();
+            if (! std::any_cast<IndexVecType &>(col_vecs[0]).empty())
+                break;
+        }
+
+        auto    &index = std::any_cast<IndexVecType &>(col_vecs[0]);
+        DF      chunk;
+
+        rows_read_ += index.size();
+        chunk.load_index(std::move(index));
+        for (size_type i = 1; i < col_s; ++i)
+            ops_[i].load(chunk, col_names_[i].c_str(), col_vecs[i]);
+        df = std::move(chunk);
+        return (true);
+    }
+
+    // Number of rows read so far
+    //
+    size_type rows_read() const  { return (rows_read_); }
+
+private:
+
+    using IndexVecType = typename DF::IndexVecType;
+    using csv2_col_ops_ = typename DF::csv2_col_ops_;
+
+    template<typename T>
+    using StlVecType = typename DF::template StlVecType<T>;
+
+    static constexpr size_type  read_block_s { 64 * 1024 };
+
+    void init_(io_format iof)  {
+
+        static_assert(std::is_base_of<HeteroVector<DF::align_value>,
+                                      typename DF::DataVec>::value,
+                      "Only a StdDataFrame can be read in chunks");
+
+        if (iof != io_format::csv2)
+            throw NotImplemented("DataFrameReader: This io_format is not "
+                                 "implemented");
+        if (chunk_rows_ == 0)
+            throw DataFrameError("DataFrameReader: ERROR: chunk_rows must "
+                                 "be positive");
+
+        // The header is the first line that is not empty or a comment
+        //
+        std::string                 line;
+        StlVecType<size_type>       col_sizes;
+
+        while (std::getline(stream_, line))
+            if (! line.empty() &&
+                line[0] != '#' && line[0] != '\r' && line[0] != '\0')
+                break;
+        line += '\n';
+        DF::parse_csv2_header_(line.data(), line.data() + line.size(),
+                               col_names_, col_sizes, ops_);
+        if (ops_.empty() || col_names_[0] != DF_INDEX_COL_NAME) [[unlikely]]
+            throw DataFrameError("DataFrameReader: ERROR: Index column is "
+                                 "not the first column");
+        eof_ = ! stream_;
+    }
+
+    // It reads enough of the stream to hold the next chunk_rows_ rows from
+    // pos_ and returns the end of those rows in buffer_. Since filling the
+    // buffer may move it, begin must be taken from pos_ after this returns.
+    //
+    const char *scan_chunk_()  {
+
+        size_type   need = chunk_rows_;
+        size_type   scanned = pos_;  // Rows before this are counted
+
+        while (true)  {
+            const char  *scan_begin = buffer_.data() + scanned;
+            const char  *scan_end = buffer_.data() + buffer_.size();
+
+            // Unless the stream is done, only look at complete lines
+            //
+            if (! eof_)
+                while (scan_end > scan_begin && *(scan_end - 1) != '\n')
+                    scan_end -= 1;
+
+            scanned = _skip_csv2_rows_(scan_begin, scan_end, need, true) -
+                      buffer_.data();
+            if (need == 0 || eof_)  break;
+            scanned -= pos_;
+            fill_buffer_();
+        }
+        return (buffer_.data() + scanned);
+    }
+
+    void fill_buffer_()  {
+
+        buffer_.erase(0, pos_);
+        pos_ = 0;
+
+        const size_type size = buffer_.size();
+
+        buffer_.resize(size + read_block_s);
+        stream_.read(buffer_.data() + size, read_block_s);
+        buffer_.resize(size + size_type(stream_.gcount()));
+        eof_ = ! stream_;
+    }
+
+    std::ifstream               file_ { };
+    std::istream                &stream_;
+    const size_type             chunk_rows_;
+    std::string                 buffer_ { };
+    size_type                   pos_ { 0 };
+    bool                        eof_ { false };
+    size_type                   rows_read_ { 0 };
+    StlVecType<String64>        col_names_ { };
+    StlVecType<csv2_col_ops_>   ops_ { };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -35,6 +35,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/AlignedAllocator.h>
 #include <DataFrame/Utils/Concepts.h>
 #include <DataFrame/Utils/FixedSizePriorityQueue.h>
+#include <DataFrame/Utils/IndexableSkipList.h>
+#include <DataFrame/Utils/ReduceKernels.h>
 #include <DataFrame/Utils/Threads/ThreadGranularity.h>
 #include <DataFrame/Utils/Utils.h>
 
@@ -128,6 +130,7 @@ namespace hmdf
     bool        obo_data_ { false };  // one-by-one data passing
 
 #define OBO_PORT_OPT \
+    using obo_ported = void; \
     inline void \
     operator() (const index_type &, const value_type &val)  { \
         obo_data_ = true; \
@@ -135,6 +138,7 @@ namespace hmdf
     }
 
 #define OBO_PORT_OPT2 \
+    using obo_ported = void; \
     inline void \
     operator() (const index_type &idx, const value_type &val)  { \
         obo_data_ = true; \
@@ -162,7 +166,10 @@ struct  LastVisitor  {
     inline void
     operator() (const index_type &, const value_type &val)  {
 
-        if (! skip_nan_ || ! is_nan__(val)) [[likely]]  result_ = val;
+        if (! skip_nan_ || ! is_nan__(val)) [[likely]]  {
+            result_ = val;
+            started_ = true;
+        }
     }
     template <forward_iterator K, forward_iterator H>
     inline void
@@ -172,19 +179,28 @@ struct  LastVisitor  {
         for (auto citer = --column_end; citer >= column_begin; --citer)
             if (! skip_nan_ || ! is_nan__(*citer)) [[likely]]  {
                 result_ = *citer;
+                started_ = true;
                 break;
             }
     }
 
-    inline void pre ()  { result_ = result_type { }; }
+    inline void pre ()  { result_ = result_type { }; started_ = false; }
     inline void post ()  {  }
     inline result_type get_result () const  { return (result_); }
+    inline void merge (const LastVisitor &rhs)  {
+
+        if (rhs.started_)  {
+            result_ = rhs.result_;
+            started_ = true;
+        }
+    }
 
     DECL_CTOR(LastVisitor)
 
 private:
 
     result_type result_ {  };
+    bool        started_ { false };
     const bool  skip_nan_;
 };
 
@@ -213,6 +229,7 @@ struct  FirstVisitor  {
         for (auto citer = column_begin; citer < column_end; ++citer)
             if (! skip_nan_ || ! is_nan__(*citer)) [[likely]]  {
                 result_ = *citer;
+                started_ = true;
                 break;
             }
     }
@@ -220,6 +237,13 @@ struct  FirstVisitor  {
     inline void pre ()  { result_ = result_type { }; started_ = false; }
     inline void post ()  {  }
     inline result_type get_result () const  { return (result_); }
+    inline void merge (const FirstVisitor &rhs)  {
+
+        if (! started_ && rhs.started_)  {
+            result_ = rhs.result_;
+            started_ = true;
+        }
+    }
 
     DECL_CTOR(FirstVisitor)
 
@@ -253,6 +277,7 @@ struct  CountVisitor  {
     inline void pre ()  { result_ = 0; }
     inline void post ()  {  }
     inline result_type get_result () const  { return (result_); }
+    inline void merge (const CountVisitor &rhs)  { result_ += rhs.result_; }
 
     DECL_CTOR(CountVisitor)
 
@@ -280,31 +305,46 @@ struct  SumVisitor  {
     operator() (const K &/*idx_begin*/, const K &/*idx_end*/,
                 const H &column_begin, const H &column_end) {
 
-        if (std::distance(column_begin, column_end) >=
-                ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    std::distance(column_begin, column_end),
+                    ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
+            thread_level > 2)  {
             auto    lbd =
                 [this] (const auto &begin, const auto &end) -> value_type  {
-                    value_type  sum { };
-
-                    if (! this->skip_nan_)  {
-                        for (auto citer = begin; citer < end; ++citer)
-                            sum += *citer;
+                    if constexpr (contiguous_arithmetic<H, value_type>)  {
+                        return (reduce_sum(std::to_address(begin),
+                                           std::to_address(end),
+                                           this->skip_nan_).sum);
                     }
                     else  {
-                        for (auto citer = begin; citer < end; ++citer)
-                            if (! is_nan__(*citer))  sum += *citer;
-                    }
+                        value_type  sum { };
+
+                        if (! this->skip_nan_)  {
+                            for (auto citer = begin; citer < end; ++citer)
+                                sum += *citer;
+                        }
+                        else  {
+                            for (auto citer = begin; citer < end; ++citer)
+                                if (! is_nan__(*citer))  sum += *citer;
+                        }
 
-                    return (sum);
+                        return (sum);
+                    }
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop(column_begin,
+                ThreadGranularity::thr_pool_.parallel_loop(thread_level,
+                                                           column_begin,
                                                            column_end,
                                                            std::move(lbd));
 
             for (auto &fut : futures)  result_ += fut.get();
         }
+        else if constexpr (contiguous_arithmetic<H, value_type>)  {
+            result_ += reduce_sum(std::to_address(column_begin),
+                                  std::to_address(column_end),
+                                  skip_nan_).sum;
+        }
         else  {
             if (! skip_nan_)  {
                 for (auto citer = column_begin; citer < column_end; ++citer)
@@ -317,15 +357,113 @@ struct  SumVisitor  {
         }
     }
 
-    inline void pre ()  { result_ = value_type { }; }
+    // Rolling window updates. See SimpleRollAdopter
+    // Values that enter and leave the window are added with Neumaier's
+    // compensation. Otherwise, a large value leaving the window takes the
+    // small ones that were added while it was in there with it.
+    // Infinities are counted, like nans, and kept out of the sum. Otherwise,
+    // inf - inf would leave a nan behind after they leave the window.
+    //
+    inline void add (const index_type &, const value_type &val)  {
+
+        if (is_nan__(val)) [[unlikely]]  {
+            if (! skip_nan_)  nan_cnt_ += 1;
+            return;
+        }
+        if (is_inf__(val)) [[unlikely]]  {
+            if (val > 0)  pos_inf_cnt_ += 1;
+            else  neg_inf_cnt_ += 1;
+            return;
+        }
+        compensated_add_(val);
+    }
+    inline void remove (const index_type &, const value_type &val)  {
+
+        if (is_nan__(val)) [[unlikely]]  {
+            if (! skip_nan_)  nan_cnt_ -= 1;
+            return;
+        }
+        if (is_inf__(val)) [[unlikely]]  {
+            if (val > 0)  pos_inf_cnt_ -= 1;
+            else  neg_inf_cnt_ -= 1;
+            return;
+        }
+        compensated_add_(-val);
+    }
+
+    // True, if the finite values in the window overflowed the sum. Then the
+    // window must be rebuilt with pre() and add()
+    //
+    inline bool lost_precision () const  { return (! is_finite__(result_)); }
+
+    inline void pre ()  {
+
+        result_ = value_type { };
+        comp_ = value_type { };
+        nan_cnt_ = 0;
+        pos_inf_cnt_ = 0;
+        neg_inf_cnt_ = 0;
+    }
     inline void post ()  {  }
-    inline result_type get_result () const  { return (result_); }
+    inline result_type get_result () const  {
+
+        if constexpr (std::is_floating_point_v<value_type>)  {
+            if (nan_cnt_ > 0 || (pos_inf_cnt_ > 0 && neg_inf_cnt_ > 0))
+                return (std::numeric_limits<value_type>::quiet_NaN());
+            if (pos_inf_cnt_ > 0)
+                return (std::numeric_limits<value_type>::infinity());
+            if (neg_inf_cnt_ > 0)
+                return (-std::numeric_limits<value_type>::infinity());
+            return (std::isfinite(result_) ? result_ + comp_ : result_);
+        }
+        else  return (result_);
+    }
+
+    // Floating-point partial sums are added with Neumaier's compensation.
+    // If either partial sum is not finite, it is a plain add. So an infinite
+    // partial gives the same result as visit().
+    //
+    inline void merge (const SumVisitor &rhs)  {
+
+        compensated_add_(rhs.result_);
+        if constexpr (std::is_floating_point_v<value_type>)
+            if (std::isfinite(result_))  comp_ += rhs.comp_;
+        nan_cnt_ += rhs.nan_cnt_;
+        pos_inf_cnt_ += rhs.pos_inf_cnt_;
+        neg_inf_cnt_ += rhs.neg_inf_cnt_;
+    }
 
     DECL_CTOR(SumVisitor)
 
 private:
 
+    // Neumaier's compensated summation. The low order bits lost in result_
+    // are carried in comp_, which get_result() adds back.
+    //
+    // An infinite operand or sum has no low order bits to carry. So then it
+    // is a plain add.
+    //
+    inline void compensated_add_ (const value_type &val)  {
+
+        if constexpr (std::is_floating_point_v<value_type>)  {
+            const value_type    sum = result_ + val;
+
+            if (std::isfinite(sum) && std::isfinite(val)) [[likely]]  {
+                if (std::fabs(result_) >= std::fabs(val))
+                    comp_ += (result_ - sum) + val;
+                else
+                    comp_ += (val - sum) + result_;
+            }
+            result_ = sum;
+        }
+        else  result_ += val;
+    }
+
     value_type  result_ { 0 };
+    value_type  comp_ { 0 };         // Compensation
+    size_type   nan_cnt_ { 0 };      // Rolling nans, when not skipped
+    size_type   pos_inf_cnt_ { 0 };  // Rolling +infs
+    size_type   neg_inf_cnt_ { 0 };  // Rolling -infs
     const bool  skip_nan_;
 };
 
@@ -374,6 +512,10 @@ struct  MeanVisitor : public MeanBase<T, I>  {
         if (! BaseClass::skip_nan_)  {
             BaseClass::cnt_ = std::distance(column_begin, column_end);
         }
+        else if constexpr (contiguous_arithmetic<H, T>)  {
+            BaseClass::cnt_ += reduce_count(std::to_address(column_begin),
+                                            std::to_address(column_end));
+        }
         else  {
             for (auto citer = column_begin; citer < column_end; ++citer)
                 if (! is_nan__(*citer))
@@ -381,11 +523,40 @@ struct  MeanVisitor : public MeanBase<T, I>  {
         }
     }
 
+    // Rolling window updates. See SimpleRollAdopter
+    //
+    inline void add (const I &idx, const T &val)  {
+
+        SKIP_NAN_BASE
+
+        BaseClass::cnt_ += 1;
+        BaseClass::sum_.add(idx, val);
+    }
+    inline void remove (const I &idx, const T &val)  {
+
+        SKIP_NAN_BASE
+
+        BaseClass::cnt_ -= 1;
+        if (BaseClass::cnt_ == 0)
+            BaseClass::sum_.pre();  // Don't leave a rounding residue
+        else
+            BaseClass::sum_.remove(idx, val);
+    }
+    inline bool lost_precision () const  {
+
+        return (BaseClass::sum_.lost_precision());
+    }
+
     inline void post ()  {
 
         BaseClass::sum_.post();
         BaseClass::mean_ = BaseClass::sum_.get_result() / T(BaseClass::cnt_);
     }
+    inline void merge (const MeanVisitor &rhs)  {
+
+        BaseClass::cnt_ += rhs.cnt_;
+        BaseClass::sum_.merge(rhs.sum_);
+    }
 
     MeanVisitor(bool skipnan = false) : BaseClass(skipnan)  {   }
 };
@@ -552,9 +723,11 @@ struct  ProdVisitor  {
     operator() (const K &/*idx_begin*/, const K &/*idx_end*/,
                 const H &column_begin, const H &column_end) {
 
-        if (std::distance(column_begin, column_end) >=
-                ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    std::distance(column_begin, column_end),
+                    ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
+            thread_level > 2)  {
             auto    lbd =
                 [this] (const auto &begin, const auto &end) -> value_type  {
                     value_type  prod { 1 };
@@ -572,7 +745,8 @@ struct  ProdVisitor  {
                     return (prod);
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop(column_begin,
+                ThreadGranularity::thr_pool_.parallel_loop(thread_level,
+                                                           column_begin,
                                                            column_end,
                                                            std::move(lbd));
 
@@ -660,9 +834,11 @@ struct  ExtremumVisitor  {
 
         // NOTE: Currently in multi-threading mode, pos_ and index_ are not
         //       updated.
-        if (std::distance(column_begin, column_end) >=
-                ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    std::distance(column_begin, column_end),
+                    ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
+            thread_level > 2)  {
             auto    lbd =
                 [this] (const auto &begin, const auto &end) -> value_type  {
                     value_type  extremum { *begin };
@@ -684,19 +860,36 @@ struct  ExtremumVisitor  {
                     return (extremum);
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop(column_begin + index,
+                ThreadGranularity::thr_pool_.parallel_loop(thread_level,
+                                                           column_begin + index,
                                                            column_end,
                                                            std::move(lbd));
 
-            if (! futures.empty())  {
-                extremum_ = futures[0].get();
-                for (size_type i = 1; i < futures.size(); ++i)  {
-                    const auto  val = std::move(futures[i].get());
+            // extremum_ already holds the first value
+            //
+            for (auto &fut : futures)  {
+                const auto  val = fut.get();
 
-                    if (cmp_(extremum_, val))
-                        extremum_ = val;
-                }
+                if (cmp_(extremum_, val))
+                    extremum_ = val;
+            }
+        }
+        else if constexpr (contiguous_arithmetic<H, value_type> &&
+                           (std::same_as<Cmp, std::less<value_type>> ||
+                            std::same_as<Cmp, std::greater<value_type>>))  {
+            // Nans never beat the first value, skipped or not
+            //
+            const value_type    *data = std::to_address(column_begin) + index;
+            const size_type     at =
+                reduce_extremum<std::same_as<Cmp, std::less<value_type>>>
+                    (data, data + (col_s - index), extremum_);
+
+            if (at < col_s - index)  {
+                extremum_ = data[at];
+                index_ = *(idx_begin + (index + at));
+                pos_ = counter_ + at;
             }
+            counter_ += col_s - index;
         }
         else  {
             if (! skip_nan_)  {
@@ -724,27 +917,127 @@ struct  ExtremumVisitor  {
         }
     }
 
+    // Rolling window updates. See SimpleRollAdopter.
+    // The window is kept as a monotonic queue, so the extremum is always at
+    // its front. Values that can never become the extremum, because a newer
+    // value beats them, are dropped when the newer value is added.
+    // Like the scan above, a window that starts with a nan gives nan, if
+    // nans are not skipped.
+    //
+    inline void add (const index_type &idx, const value_type &val)  {
+
+        const size_type seq = roll_.added++;
+
+        roll_.active = true;
+        if (is_nan__(val)) [[unlikely]]  {
+            if (! skip_nan_)  roll_.nans.push_back(seq);
+            return;
+        }
+        while (roll_.q.size() > roll_.q_head &&
+               cmp_(std::get<2>(roll_.q.back()), val))
+            roll_.q.pop_back();
+        roll_.q.emplace_back(seq, idx, val);
+    }
+    inline void remove (const index_type &, const value_type &)  {
+
+        const size_type seq = roll_.removed++;
+
+        if (roll_.q.size() > roll_.q_head &&
+            std::get<0>(roll_.q[roll_.q_head]) == seq)
+            roll_.q_head += 1;
+        if (roll_.nans.size() > roll_.nans_head &&
+            roll_.nans[roll_.nans_head] == seq)
+            roll_.nans_head += 1;
+        roll_.compact();
+    }
+
     inline void pre ()  {
         is_first = true;
         pos_ = 0;
         counter_ = 0;
         extremum_ = value_type { };
+        roll_.clear();
+    }
+    inline void post ()  {
+
+        if (roll_.active)  {
+            if (roll_.nans.size() > roll_.nans_head &&
+                roll_.nans[roll_.nans_head] == roll_.removed)
+                extremum_ = std::numeric_limits<value_type>::quiet_NaN();
+            else if (roll_.q.size() > roll_.q_head)  {
+                const auto  &[seq, idx, val] = roll_.q[roll_.q_head];
+
+                extremum_ = val;
+                index_ = idx;
+                pos_ = seq - roll_.removed;
+            }
+            else  extremum_ = value_type { };
+        }
     }
-    inline void post ()  {  }
     inline result_type get_result () const  { return (extremum_); }
     inline index_type get_index () const  { return (index_); }
     inline size_type get_position () const  { return (pos_); }
+    inline void merge (const ExtremumVisitor &rhs)  {
+
+        if (! rhs.is_first)  {
+            if (is_first || cmp_(extremum_, rhs.extremum_))  {
+                extremum_ = rhs.extremum_;
+                index_ = rhs.index_;
+                pos_ = counter_ + rhs.pos_;
+                is_first = false;
+            }
+            else if (is_nan__(rhs.extremum_) && ! is_nan__(extremum_))
+                extremum_ = rhs.extremum_;  // A nan, once seen, sticks
+        }
+        counter_ += rhs.counter_;
+    }
 
     DECL_CTOR(ExtremumVisitor)
 
 private:
 
+    // The queues are vectors with a moving head, so a visitor that is never
+    // rolled doesn't allocate
+    //
+    struct  RollState  {
+
+        using entry_t = std::tuple<size_type, index_type, value_type>;
+
+        std::vector<entry_t>    q { };  // Monotonic queue of seq, idx, val
+        std::vector<size_type>  nans { };  // Seqs of nans in the window
+        size_type               q_head { 0 };
+        size_type               nans_head { 0 };
+        size_type               added { 0 };
+        size_type               removed { 0 };
+        bool                    active { false };
+
+        inline void clear()  {
+
+            q.clear();
+            nans.clear();
+            q_head = nans_head = added = removed = 0;
+            active = false;
+        }
+        inline void compact()  {
+
+            if (q_head > 64 && q_head * 2 > q.size())  {
+                q.erase(q.begin(), q.begin() + q_head);
+                q_head = 0;
+            }
+            if (nans_head > 64 && nans_head * 2 > nans.size())  {
+                nans.erase(nans.begin(), nans.begin() + nans_head);
+                nans_head = 0;
+            }
+        }
+    };
+
     value_type      extremum_ { };
     index_type      index_ { };
     bool            is_first { true };
     size_type       pos_ { 0 };
     size_type       counter_ { 0 };
     compare_type    cmp_ {  };
+    RollState       roll_ { };
     const bool      skip_nan_;
 };
 
@@ -850,12 +1143,7 @@ struct  CovVisitor  {
         if (skip_nan_ && (is_nan__(val1) || is_nan__(val2))) [[unlikely]]
             return;
 
-        inter_result_.total1 += val1;
-        inter_result_.total2 += val2;
-        inter_result_.dot_prod += (val1 * val2);
-        inter_result_.dot_prod1 += (val1 * val1);
-        inter_result_.dot_prod2 += (val2 * val2);
-        inter_result_.cnt += 1;
+        add_cov_moments(inter_result_, moment_type(val1), moment_type(val2));
     }
     template <forward_iterator K, forward_iterator H>
     inline void
@@ -863,166 +1151,131 @@ struct  CovVisitor  {
                 const H &column_begin1, const H &column_end1,
                 const H &column_begin2, const H &column_end2)  {
 
-        if (std::distance(column_begin1, column_end1) >=
-                ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    std::distance(column_begin1, column_end1),
+                    ThreadGranularity::VISIT_WORK, 2, sizeof(value_type));
+            thread_level > 2)  {
             auto    lbd =
                 [this]
                 (const auto &begin1, const auto &end1,
                  const auto &begin2) -> InterResults  {
-                    InterResults    result { };
-                    auto            iter2 = begin2;
-
-                    if (! this->skip_nan_)  {
-                        for (auto iter1 = begin1;
-                             iter1 < end1; ++iter1, ++iter2) {
-                            const value_type    &val1 = *iter1;
-                            const value_type    &val2 = *iter2;
-
-                            result.total1 += val1;
-                            result.total2 += val2;
-                            result.dot_prod += (val1 * val2);
-                            result.dot_prod1 += (val1 * val1);
-                            result.dot_prod2 += (val2 * val2);
-                            result.cnt += 1;
-                        }
+                    if constexpr (contiguous_arithmetic<H, value_type>)  {
+                        return (reduce_cov(std::to_address(begin1),
+                                           std::to_address(end1),
+                                           std::to_address(begin2),
+                                           this->skip_nan_));
                     }
                     else  {
+                        InterResults    result { };
+                        auto            iter2 = begin2;
+
                         for (auto iter1 = begin1;
                              iter1 < end1; ++iter1, ++iter2) {
                             const value_type    &val1 = *iter1;
                             const value_type    &val2 = *iter2;
 
-                            if (! is_nan__(val1) && ! is_nan__(val2))  {
-                                result.total1 += val1;
-                                result.total2 += val2;
-                                result.dot_prod += (val1 * val2);
-                                result.dot_prod1 += (val1 * val1);
-                                result.dot_prod2 += (val2 * val2);
-                                result.cnt += 1;
-                            }
+                            if (! this->skip_nan_ ||
+                                (! is_nan__(val1) && ! is_nan__(val2)))
+                                add_cov_moments(result,
+                                                moment_type(val1),
+                                                moment_type(val2));
                         }
-                    }
 
-                    return (result);
+                        return (result);
+                    }
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop2(column_begin1,
+                ThreadGranularity::thr_pool_.parallel_loop2(thread_level,
+                                                            column_begin1,
                                                             column_end1,
                                                             column_begin2,
                                                             column_end2,
                                                             std::move(lbd));
 
-            for (auto &fut : futures)  {
-                const auto  &result = fut.get();
+            for (auto &fut : futures)
+                merge_cov_moments(inter_result_, fut.get());
+        }
+        else if constexpr (contiguous_arithmetic<H, value_type>)  {
+            const size_type     col_s =
+                std::min(std::distance(column_begin1, column_end1),
+                         std::distance(column_begin2, column_end2));
+            const value_type    *data1 = std::to_address(column_begin1);
 
-                inter_result_.total1 += result.total1;
-                inter_result_.total2 += result.total2;
-                inter_result_.dot_prod += result.dot_prod;
-                inter_result_.dot_prod1 += result.dot_prod1;
-                inter_result_.dot_prod2 += result.dot_prod2;
-                inter_result_.cnt += result.cnt;
-            }
+            merge_cov_moments(inter_result_,
+                              reduce_cov(data1, data1 + col_s,
+                                         std::to_address(column_begin2),
+                                         skip_nan_));
         }
         else  {
             const size_type col_s1 = std::distance(column_begin1, column_end1);
             const size_type col_s2 = std::distance(column_begin2, column_end2);
 
-            if (! skip_nan_)  {
-                for (size_type i = 0; i < col_s1 && i < col_s2; ++i)  {
-                    const value_type    &val1 = *(column_begin1 + i);
-                    const value_type    &val2 = *(column_begin2 + i);
-
-                    inter_result_.total1 += val1;
-                    inter_result_.total2 += val2;
-                    inter_result_.dot_prod += (val1 * val2);
-                    inter_result_.dot_prod1 += (val1 * val1);
-                    inter_result_.dot_prod2 += (val2 * val2);
-                    inter_result_.cnt += 1;
-                }
-            }
-            else  {
-                for (size_type i = 0; i < col_s1 && i < col_s2; ++i)  {
-                    const value_type    &val1 = *(column_begin1 + i);
-                    const value_type    &val2 = *(column_begin2 + i);
-
-                    if (! is_nan__(val1) && ! is_nan__(val2))  {
-                        inter_result_.total1 += val1;
-                        inter_result_.total2 += val2;
-                        inter_result_.dot_prod += (val1 * val2);
-                        inter_result_.dot_prod1 += (val1 * val1);
-                        inter_result_.dot_prod2 += (val2 * val2);
-                        inter_result_.cnt += 1;
-                    }
-                }
+            for (size_type i = 0; i < col_s1 && i < col_s2; ++i)  {
+                const value_type    &val1 = *(column_begin1 + i);
+                const value_type    &val2 = *(column_begin2 + i);
+
+                if (! skip_nan_ || (! is_nan__(val1) && ! is_nan__(val2)))
+                    add_cov_moments(inter_result_,
+                                    moment_type(val1), moment_type(val2));
             }
         }
     }
 
     inline void pre ()  {
 
-        inter_result_.clear();
+        inter_result_ = { };
         result_ = 0;
     }
-    inline void post ()  {
-
-        const value_type    d = value_type(inter_result_.cnt) - b_;
-
-        if (d != 0) [[likely]]
-            result_ = (inter_result_.dot_prod -
-                       (inter_result_.total1 * inter_result_.total2) /
-                       value_type(inter_result_.cnt)) /
-                      d;
-        else  result_ = std::numeric_limits<value_type>::quiet_NaN();
-    }
+    inline void post ()  { result_ = moment_(inter_result_.c12); }
 
     inline result_type get_result () const  { return (result_); }
     inline value_type get_var1 () const  {
 
-        const value_type    d = value_type(inter_result_.cnt) - b_;
-
-        if (d != 0) [[likely]]
-            return ((inter_result_.dot_prod1 -
-                     (inter_result_.total1 * inter_result_.total1) /
-                     value_type(inter_result_.cnt)) /
-                    d);
-        else  return (std::numeric_limits<value_type>::quiet_NaN());
+        return (moment_(inter_result_.m2_1));
     }
     inline value_type get_var2 () const  {
 
-        const value_type    d = value_type(inter_result_.cnt) - b_;
-
-        if (d != 0) [[likely]]
-            return ((inter_result_.dot_prod2 -
-                     (inter_result_.total2 * inter_result_.total2) /
-                     value_type(inter_result_.cnt)) /
-                    d);
-        else  return (std::numeric_limits<value_type>::quiet_NaN());
+        return (moment_(inter_result_.m2_2));
     }
     inline size_type get_count() const  { return (inter_result_.cnt); }
 
+    // The partial moments are merged with Chan's parallel formula. So the
+    // result does not shift with the number of chunks.
+    //
+    inline void merge (const CovVisitor &rhs)  {
+
+        merge_cov_moments(inter_result_, rhs.inter_result_);
+    }
+
     explicit CovVisitor (bool biased = false, bool skipnan = false)
         : b_ (biased ? 0 : 1), skip_nan_(skipnan)  {  }
 
 private:
 
-    struct  InterResults  {
-        value_type  total1 { 0 };
-        value_type  total2 { 0 };
-        value_type  dot_prod { 0 };
-        value_type  dot_prod1 { 0 };
-        value_type  dot_prod2 { 0 };
-        size_type   cnt { 0 };
+    using moment_type = reduce_moment_t<value_type>;
+    using InterResults = CovMoments<moment_type>;
 
-        inline void clear()  {
-            total1 = total2 = dot_prod = dot_prod1 = dot_prod2 = 0;
-            cnt = 0;
+    // A sum of deviation products divided by the degrees of freedom.
+    // Integer results go through long long, so a negative covariance wraps
+    // around in an unsigned type, instead of being undefined.
+    //
+    inline value_type moment_ (const moment_type &sum) const  {
+
+        const moment_type   d = moment_type(inter_result_.cnt) - b_;
+
+        if (d > 0) [[likely]]  {
+            if constexpr (std::is_floating_point_v<value_type>)
+                return (sum / d);
+            else
+                return (value_type(static_cast<long long>(sum / d)));
         }
-    };
+        return (std::numeric_limits<value_type>::quiet_NaN());
+    }
 
     InterResults        inter_result_ { };
     result_type         result_ { 0 };
-    const value_type    b_;
+    const moment_type   b_;
     const bool          skip_nan_;
 };
 
@@ -1046,17 +1299,125 @@ struct  VarVisitor  {
               column_begin, column_end, column_begin, column_end);
     }
 
-    inline void pre ()  { cov_.pre(); }
-    inline void post ()  { cov_.post(); }
-    inline result_type get_result () const  { return (cov_.get_result()); }
-    inline size_type get_count() const  { return (cov_.get_count()); }
+    // Rolling window updates, with Welford's algorithm. See
+    // SimpleRollAdopter
+    // Only floating-point columns are rolled this way. The integer mean and
+    // m2 would wrap around or truncate, and the result would not match
+    // what visit() gives for the same window. Those are rerun per window.
+    //
+    inline void add (const index_type &, const value_type &val)
+        requires std::is_floating_point_v<value_type>  {
+
+        roll_.active = true;
+        if (is_nan__(val)) [[unlikely]]  {
+            if (! skip_nan_)  roll_.nan_cnt += 1;
+            return;
+        }
+        if (is_inf__(val)) [[unlikely]]  {  // Kept out, like nans
+            roll_.inf_cnt += 1;
+            return;
+        }
+
+        roll_.cnt += 1;
+
+        const value_type    delta = val - roll_.mean;
+
+        roll_.mean += delta / value_type(roll_.cnt);
+        roll_.m2 += delta * (val - roll_.mean);
+        roll_.lost = roll_.lost || ! is_finite__(roll_.m2);  // Overflow
+    }
+    inline void remove (const index_type &, const value_type &val)
+        requires std::is_floating_point_v<value_type>  {
+
+        if (is_nan__(val)) [[unlikely]]  {
+            if (! skip_nan_)  roll_.nan_cnt -= 1;
+            return;
+        }
+        if (is_inf__(val)) [[unlikely]]  {
+            roll_.inf_cnt -= 1;
+            return;
+        }
+
+        roll_.cnt -= 1;
+        if (roll_.cnt == 0)  {
+            roll_.mean = roll_.m2 = 0;
+            return;
+        }
+
+        const value_type    delta = val - roll_.mean;
+
+        roll_.mean -= delta / value_type(roll_.cnt);
+        roll_.m2 -= delta * (val - roll_.mean);
+        if (roll_.cnt == 1 || roll_.m2 < 0)  roll_.m2 = 0;  // Rounding
+
+        // Taking out a value far from the rest cancels most of m2, and the
+        // rounding error of the subtraction is left. E.g. after 1e20 leaves
+        // [1e20, 1], the mean is 0. Then the window must be rebuilt.
+        //
+        if constexpr (std::is_floating_point_v<value_type>)
+            roll_.lost =
+                roll_.lost ||
+                ! std::isfinite(roll_.m2) ||
+                delta * delta *
+                    std::sqrt(std::numeric_limits<value_type>::epsilon()) >
+                roll_.m2;
+    }
+
+    // True, if add()/remove() have cost so much precision that the window
+    // must be rebuilt with pre() and add()
+    //
+    inline bool lost_precision () const
+        requires std::is_floating_point_v<value_type>  {
+
+        return (roll_.lost);
+    }
+
+    inline void pre ()  { cov_.pre(); roll_ = { }; }
+    inline void post ()  {
+
+        if (roll_.active)  {
+            const value_type    d = value_type(roll_.cnt) - b_;
+
+            roll_.result =
+                (d != 0 && roll_.cnt > 0 &&
+                 roll_.nan_cnt == 0 && roll_.inf_cnt == 0)
+                    ? roll_.m2 / d
+                    : std::numeric_limits<value_type>::quiet_NaN();
+        }
+        else  cov_.post();
+    }
+    inline result_type get_result () const  {
+
+        return (roll_.active ? roll_.result : cov_.get_result());
+    }
+    inline size_type get_count() const  {
+
+        return (roll_.active ? roll_.cnt + roll_.inf_cnt : cov_.get_count());
+    }
+    inline void merge (const VarVisitor &rhs)  { cov_.merge(rhs.cov_); }
 
     explicit VarVisitor (bool biased = false, bool skip_nan = false)
-        : cov_ (biased, skip_nan)  {   }
+        : cov_ (biased, skip_nan),
+          b_ (biased ? 0 : 1),
+          skip_nan_(skip_nan)  {   }
 
 private:
 
+    struct  RollState  {
+        value_type  mean { 0 };
+        value_type  m2 { 0 };
+        result_type result { 0 };
+        size_type   cnt { 0 };
+        size_type   nan_cnt { 0 };
+        size_type   inf_cnt { 0 };
+        bool        active { false };
+        bool        lost { false };
+    };
+
     CovVisitor<value_type, index_type>  cov_;
+    RollState                           roll_ { };
+    const value_type                    b_;
+    const bool                          skip_nan_;
 };
 
 // ----------------------------------------------------------------------------
@@ -1122,10 +1483,29 @@ struct  StdVisitor   {
         var_ (idx_begin, idx_end, column_begin, column_end);
     }
 
+    // Rolling window updates, for floating-point columns. See VarVisitor
+    //
+    inline void add (const index_type &idx, const value_type &val)
+        requires std::is_floating_point_v<value_type>  {
+
+        var_.add(idx, val);
+    }
+    inline void remove (const index_type &idx, const value_type &val)
+        requires std::is_floating_point_v<value_type>  {
+
+        var_.remove(idx, val);
+    }
+    inline bool lost_precision () const
+        requires std::is_floating_point_v<value_type>  {
+
+        return (var_.lost_precision());
+    }
+
     inline void pre ()  { var_.pre(); result_ = 0; }
     inline void post ()  { var_.post(); result_ = ::sqrt(var_.get_result()); }
     inline result_type get_result () const  { return (result_); }
     inline size_type get_count() const  { return (var_.get_count()); }
+    inline void merge (const StdVisitor &rhs)  { var_.merge(rhs.var_); }
 
     explicit StdVisitor (bool biased = false, bool skip_nan = false)
         : var_ (biased, skip_nan)  {   }
@@ -1349,8 +1729,11 @@ public:
                                  (value_type(col_s * (col_s * col_s - 1))));
             };
 
-            if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-                ThreadGranularity::get_thread_level() > 2)  {
+            if (const auto thread_level =
+                    ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+                thread_level > 2)  {
                 auto    lbd =
                     [](const K &ib, const K &ie,
                        const H &cb, const H &ce) -> RankVisitor<T, I>  {
@@ -1409,6 +1792,22 @@ public:
     }
     inline result_type get_result () const  { return (result_); }
 
+    // Only the pearson correlation can be merged. The spearman correlation
+    // ranks the whole columns at once
+    //
+    inline bool can_merge () const  {
+
+        return (type_ == correlation_type::pearson);
+    }
+    inline void merge (const CorrVisitor &rhs)  {
+
+        if (type_ != correlation_type::pearson ||
+            rhs.type_ != correlation_type::pearson)
+            throw NotFeasible("CorrVisitor::merge(): "
+                              "Only pearson correlation can be merged");
+        cov_.merge(rhs.cov_);
+    }
+
     explicit CorrVisitor (correlation_type t = correlation_type::pearson,
                           bool biased = false) : cov_ (biased), type_(t)  {  }
 
@@ -1444,9 +1843,11 @@ struct  DotProdVisitor  {
                 const H &column_begin1, const H &column_end1,
                 const H &column_begin2, const H &column_end2)  {
 
-        if (std::distance(column_begin1, column_end1) >=
-                ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    std::distance(column_begin1, column_end1),
+                    ThreadGranularity::VISIT_WORK, 2, sizeof(value_type));
+            thread_level > 2)  {
             auto    lbd =
                 []
                 (const auto &begin1, const auto &end1,
@@ -1455,31 +1856,46 @@ struct  DotProdVisitor  {
                                                    result_type,
                                                    result_type,
                                                    result_type>  {
-                    value_type  result { 0 };
-                    value_type  mag1 { 0 };
-                    value_type  mag2 { 0 };
-                    value_type  euc_dist { 0 };
-                    value_type  man_dist { 0 };
-                    auto        iter2 = begin2;
+                    if constexpr (contiguous_arithmetic<H, value_type>)  {
+                        const auto  sums =
+                            reduce_dot(std::to_address(begin1),
+                                       std::to_address(end1),
+                                       std::to_address(begin2));
+
+                        return (std::make_tuple(sums.dot_prod,
+                                                sums.mag1,
+                                                sums.mag2,
+                                                sums.euc_dist,
+                                                sums.man_dist));
+                    }
+                    else  {
+                        value_type  result { 0 };
+                        value_type  mag1 { 0 };
+                        value_type  mag2 { 0 };
+                        value_type  euc_dist { 0 };
+                        value_type  man_dist { 0 };
+                        auto        iter2 = begin2;
 
-                    for (auto iter1 = begin1; iter1 < end1; ++iter1, ++iter2) {
-                        const auto  val1 = *iter1;
-                        const auto  val2 = *iter2;
+                        for (auto iter1 = begin1; iter1 < end1; ++iter1, ++iter2) {
+                            const auto  val1 = *iter1;
+                            const auto  val2 = *iter2;
 
-                        result += val1 * val2;
-                        mag1 += val1 * val1;
-                        mag2 += val2 * val2;
+                            result += val1 * val2;
+                            mag1 += val1 * val1;
+                            mag2 += val2 * val2;
 
-                        const value_type    diff = val1 - val2;
+                            const value_type    diff = val1 - val2;
 
-                        euc_dist += diff * diff;
-                        man_dist += std::fabs(diff);
+                            euc_dist += diff * diff;
+                            man_dist += std::fabs(diff);
+                        }
+                        return (std::make_tuple(result, mag1, mag2,
+                                                euc_dist, man_dist));
                     }
-                    return (std::make_tuple(result, mag1, mag2,
-                                            euc_dist, man_dist));
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop2(column_begin1,
+                ThreadGranularity::thr_pool_.parallel_loop2(thread_level,
+                                                            column_begin1,
                                                             column_end1,
                                                             column_begin2,
                                                             column_end2,
@@ -1495,6 +1911,21 @@ struct  DotProdVisitor  {
                 man_dist_ += std::get<4>(ret);
             }
         }
+        else if constexpr (contiguous_arithmetic<H, value_type>)  {
+            const size_type     col_s =
+                std::min(std::distance(column_begin1, column_end1),
+                         std::distance(column_begin2, column_end2));
+            const value_type    *data1 = std::to_address(column_begin1);
+            const auto          sums =
+                reduce_dot(data1, data1 + col_s,
+                           std::to_address(column_begin2));
+
+            result_ += sums.dot_prod;
+            mag1_ += sums.mag1;
+            mag2_ += sums.mag2;
+            euc_dist_ += sums.euc_dist;
+            man_dist_ += sums.man_dist;
+        }
         else  {
             const size_type col_s =
                 std::min(std::distance(column_begin1, column_end1),
@@ -1528,6 +1959,14 @@ struct  DotProdVisitor  {
     inline result_type get_magnitude2 () const  { return (mag2_); }
     inline result_type get_euclidean_dist () const  { return (euc_dist_); }
     inline result_type get_manhattan_dist () const  { return (man_dist_); }
+    inline void merge (const DotProdVisitor &rhs)  {
+
+        result_ += rhs.result_;
+        mag1_ += rhs.mag1_;
+        mag2_ += rhs.mag2_;
+        euc_dist_ += rhs.euc_dist_;
+        man_dist_ += rhs.man_dist_;
+    }
 
 private:
 
@@ -1709,6 +2148,12 @@ using NMinSubArrayVisitor =
 // ----------------------------------------------------------------------------
 
 // Simple rolling adoptor for visitors
+// If the visitor is rolling_updatable, i.e. it has add() and remove(), each
+// window is derived from the previous one by adding the value that enters
+// and removing the value that leaves. So the whole roll is O(n), instead of
+// rerunning the visitor over every window in O(n * roll_count).
+// If the visitor is also rolling_rebuildable and a remove() costs it too
+// much precision, the window is rebuilt from its values.
 //
 template<typename F, typename T, typename I = unsigned long, std::size_t A = 0>
 struct  SimpleRollAdopter  {
@@ -1741,6 +2186,32 @@ public:
         result_.reserve(col_s);
         for (size_type i = 0; i < roll_count_ - 1 && i < col_s; ++i) [[likely]]
             result_.push_back(std::numeric_limits<f_result_type>::quiet_NaN());
+
+        if constexpr (rolling_updatable<visitor_type>)  {
+            if (roll_count_ > 0 && roll_count_ <= col_s)  {
+                visitor_.pre();
+                for (size_type i = 0; i < roll_count_ - 1; ++i) [[likely]]
+                    visitor_.add(*(idx_begin + i), *(column_begin + i));
+                for (size_type i = roll_count_ - 1; i < col_s; ++i) [[likely]] {
+                    const size_type out = i + 1 - roll_count_;
+
+                    visitor_.add(*(idx_begin + i), *(column_begin + i));
+                    visitor_.post();
+                    result_.push_back(visitor_.get_result());
+                    visitor_.remove(*(idx_begin + out), *(column_begin + out));
+                    if constexpr (rolling_rebuildable<visitor_type>)  {
+                        if (visitor_.lost_precision()) [[unlikely]]  {
+                            visitor_.pre();
+                            for (size_type j = out + 1; j <= i; ++j)
+                                visitor_.add(*(idx_begin + j),
+                                             *(column_begin + j));
+                        }
+                    }
+                }
+                return;
+            }
+        }
+
         for (size_type i = 0; i < col_s; ++i) [[likely]]  {
             if (i + roll_count_ <= col_s)  {
                 visitor_.pre();
@@ -1770,6 +2241,121 @@ private:
 
 // ----------------------------------------------------------------------------
 
+// It runs all the given visitors over the same column in one pass.
+// Visitors that take one data item at a time are fed one block of rows at a
+// time, each visitor in turn, while the block is still in cache. Visitors
+// that need the whole column, e.g. MedianVisitor, are passed the whole
+// column once.
+// The visitors are held by reference, so the results are read from the
+// visitors themselves after the visit. They must all have the same
+// value_type and index_type.
+//
+template<typename V, typename ... Vs>
+struct  FusedVisitor  {
+
+    using value_type = typename V::value_type;
+    using index_type = typename V::index_type;
+    using size_type = std::size_t;
+
+    static_assert((std::is_same_v<value_type, typename Vs::value_type> && ...),
+                  "FusedVisitor: visitors must have the same value_type");
+    static_assert((std::is_same_v<index_type, typename Vs::index_type> && ...),
+                  "FusedVisitor: visitors must have the same index_type");
+
+    // So a block of values and indices stays in L1 cache
+    //
+    static constexpr size_type  block_rows =
+        std::max<size_type>(
+            (16 * 1024) / (sizeof(value_type) + sizeof(index_type)), 1);
+
+    inline void
+    operator() (const index_type &idx, const value_type &val)  {
+
+        std::apply([&idx, &val](auto & ... vs) -> void  {
+                       (vs(idx, val), ...);
+                   },
+                   visitors_);
+    }
+    template <forward_iterator K, forward_iterator H>
+    inline void
+    operator() (const K &idx_begin, const K &idx_end,
+                const H &column_begin, const H &column_end)  {
+
+        GET_COL_SIZE
+
+        for (size_type b = 0; b < col_s; b += block_rows)  {
+            const size_type e = std::min(b + block_rows, col_s);
+
+            std::apply([&idx_begin, &column_begin, b, e]
+                       (auto & ... vs) -> void  {
+                           (feed_block_(vs, idx_begin, column_begin, b, e),
+                            ...);
+                       },
+                       visitors_);
+        }
+        std::apply([&](auto & ... vs) -> void  {
+                       (feed_column_(vs, idx_begin, idx_end,
+                                     column_begin, column_end), ...);
+                   },
+                   visitors_);
+    }
+
+    inline void pre ()  {
+
+        std::apply([](auto & ... vs) -> void  { (vs.pre(), ...); },
+                   visitors_);
+    }
+    inline void post ()  {
+
+        std::apply([](auto & ... vs) -> void  { (vs.post(), ...); },
+                   visitors_);
+    }
+
+    // N-th visitor, in the order given to the constructor
+    //
+    template<std::size_t N>
+    inline auto &get_visitor ()  { return (std::get<N>(visitors_)); }
+
+    explicit
+    FusedVisitor (V &visitor, Vs & ... visitors)
+        : visitors_(visitor, visitors ...)  {   }
+
+private:
+
+    template<typename W>
+    static constexpr bool   by_block_ =
+        one_by_one_visitor<W> && ! obo_ported_visitor<W>;
+
+    template<typename W, typename K, typename H>
+    inline static void
+    feed_block_(W &visitor,
+                const K &idx_begin, const H &column_begin,
+                size_type b, size_type e)  {
+
+        if constexpr (by_block_<W>)  {
+            K   idx_iter = idx_begin + b;
+            H   col_iter = column_begin + b;
+
+            for (size_type i = b; i < e; ++i, ++idx_iter, ++col_iter)
+                visitor(*idx_iter, *col_iter);
+        }
+    }
+
+    template<typename W, typename K, typename H>
+    inline static void
+    feed_column_(W &visitor,
+                 const K &idx_begin, const K &idx_end,
+                 const H &column_begin, const H &column_end)  {
+
+        if constexpr (! by_block_<W>)
+            visitor(idx_begin, idx_end, column_begin, column_end);
+    }
+
+    std::tuple<V &, Vs & ...>   visitors_;
+};
+
+// ----------------------------------------------------------------------------
+
 // This can only work with visitors that accept one data item at a time
 //
 template<typename F, typename T, typename I = unsigned long>
@@ -1992,8 +2578,11 @@ public:
                         std::distance(x_begin, x_end),
                         std::distance(y_begin, y_end) });
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             std::vector<std::future<void>>  futures;
 
             if (! related_ts_)  {
@@ -2417,8 +3006,11 @@ struct  FactorizeVisitor  {
         const size_type col_s = std::distance(column_begin, column_end);
         result_type     result;
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             result.resize(col_s);
 
             auto    lbd =
@@ -2428,7 +3020,8 @@ struct  FactorizeVisitor  {
                         result[begin] = this->ffunc_(*(column_begin + begin));
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop(size_type(0),
+                ThreadGranularity::thr_pool_.parallel_loop(thread_level,
+                                                           size_type(0),
                                                            col_s,
                                                            std::move(lbd));
 
@@ -2479,8 +3072,11 @@ public:
         size_type               lag = 1;
 
         tmp_result[0] = 1.0;
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             vec_type<std::future<CorrResult>>   futures;
 
             futures.reserve((col_s - 4) - lag);
@@ -3048,8 +3644,11 @@ struct  ZeroLagMovingMeanVisitor  {
 
         const size_type lag = size_type (0.5 * double(roll_period_ - 1));
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    lbd =
                 [lag, &column_begin, this]
                 (auto begin, auto end) mutable -> void  {
@@ -3058,7 +3657,8 @@ struct  ZeroLagMovingMeanVisitor  {
                                            *(column_begin + (i - lag));
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop(starting + lag,
+                ThreadGranularity::thr_pool_.parallel_loop(thread_level,
+                                                           starting + lag,
                                                            col_s,
                                                            std::move(lbd));
 
@@ -3126,8 +3726,9 @@ struct  LinregMovingMeanVisitor  {
         const value_type    divisor = T(roll_period_) * sum_x2 - sum_x * sum_x;
         result_type         result (col_s,
                                     std::numeric_limits<T>::quiet_NaN());
-        const auto          thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto          thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         if (thread_level > 2)  {
             auto    lbd =
@@ -3141,7 +3742,8 @@ struct  LinregMovingMeanVisitor  {
                                     this->type_, this->roll_period_);
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop(roll_period_,
+                ThreadGranularity::thr_pool_.parallel_loop(thread_level,
+                                                           roll_period_,
                                                            col_s,
                                                            std::move(lbd));
 
@@ -3178,8 +3780,11 @@ private:
         value_type      sum_y { 0 };
         value_type      sum_xy { 0 };
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    lbd =
                 [&column_begin]
                 (auto begin, auto end) mutable -> std::pair<T, T>  {
@@ -3195,7 +3800,8 @@ private:
                     return (std::make_pair(sum_y, sum_xy));
                 };
             auto    futures =
-                ThreadGranularity::thr_pool_.parallel_loop(size_type(0),
+                ThreadGranularity::thr_pool_.parallel_loop(thread_level,
+                                                           size_type(0),
                                                            col_s,
                                                            std::move(lbd));
 
@@ -3669,8 +4275,11 @@ public:
                           val_vec.push_back(map_pair.second);
                       });
 
-        if (val_vec.size() >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    val_vec.size(), ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             ThreadGranularity::thr_pool_.parallel_sort(
                 val_vec.begin(), val_vec.end(),
                 [](const DataItem &lhs, const DataItem &rhs) -> bool  {
@@ -3702,8 +4311,11 @@ public:
 
     inline void sort_by_repeat_count()  {
 
-        if (result_.size() >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    result_.size(), ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)
             ThreadGranularity::thr_pool_.parallel_sort(
                 result_.begin(), result_.end(),
                 [](const DataItem &lhs, const DataItem &rhs) -> bool  {
@@ -3717,8 +4329,11 @@ public:
     }
     inline void sort_by_value()  {
 
-        if (result_.size() >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    result_.size(), ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)
             ThreadGranularity::thr_pool_.parallel_sort(
                 result_.begin(), result_.end(),
                 [](const DataItem &lhs, const DataItem &rhs) -> bool  {
@@ -3953,6 +4568,382 @@ using mad_v = MADVisitor<T, I, A>;
 
 // ----------------------------------------------------------------------------
 
+// Base for the rolling order statistics visitors below.
+// The window is kept sorted across the roll, so moving it by one item is
+// O(log roll_count) in an IndexableSkipList, instead of copying and
+// reselecting every window, like SimpleRollAdopter<MedianVisitor> does.
+// Windows up to flat_roll_count are kept in a SortedVector, which is faster
+// at those sizes.
+// Like SimpleRollAdopter, the first roll_count - 1 items in the result are
+// nan. If skip_nan is false, a window with a nan in it gives nan. Otherwise,
+// the statistic is over the non-nan values in the window.
+//
+template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
+struct  RollingOrderStatBase  {
+
+    DEFINE_VISIT_BASIC_TYPES_3
+
+    DEFINE_PRE_POST
+    DEFINE_RESULT
+
+    static constexpr size_type  flat_roll_count = 1024;
+
+protected:
+
+    // stat(window, value) gives the result for every full window. value is
+    // the newest item in the window
+    //
+    template <forward_iterator H, typename F>
+    inline void
+    roll_(const H &column_begin, const H &column_end, F &&stat)  {
+
+#ifdef HMDF_SANITY_EXCEPTIONS
+        if (roll_count_ == 0)
+            throw DataFrameError("RollingOrderStatBase: "
+                                 "roll count must be > 0");
+#endif // HMDF_SANITY_EXCEPTIONS
+
+        if (roll_count_ <= flat_roll_count)
+            roll_window_<SortedVector<value_type>>(column_begin,
+                                                   column_end,
+                                                   stat);
+        else
+            roll_window_<IndexableSkipList<value_type>>(column_begin,
+                                                        column_end,
+                                                        stat);
+    }
+
+    template <typename W, forward_iterator H, typename F>
+    inline void
+    roll_window_(const H &column_begin, const H &column_end, F &stat)  {
+
+        GET_COL_SIZE2
+
+        result_type result (col_s, std::numeric_limits<T>::quiet_NaN());
+        W           window (roll_count_);
+        size_type   nan_cnt { 0 };
+
+        for (size_type i = 0; i < col_s && roll_count_ > 0; ++i) [[likely]] {
+            const value_type    &val = *(column_begin + i);
+
+            if (is_nan__(val)) [[unlikely]]  nan_cnt += 1;
+            else  window.insert(val);
+
+            if (i + 1 >= roll_count_)  {
+                if (! window.empty() && (skip_nan_ || nan_cnt == 0))
+                    result[i] = stat(window, val);
+
+                const value_type    &out =
+                    *(column_begin + (i + 1 - roll_count_));
+
+                if (is_nan__(out)) [[unlikely]]  nan_cnt -= 1;
+                else  window.erase(out);
+            }
+        }
+        result_.swap(result);
+    }
+
+    template<typename W>
+    inline static value_type median_(const W &window)  {
+
+        const size_type half = window.size() >> 1;
+
+        if (window.size() & 0x01)  return (window[half]);
+        return ((window[half - 1] + window[half]) / value_type(2));
+    }
+
+    RollingOrderStatBase(size_type roll_count, bool skip_nan)
+        : roll_count_(roll_count), skip_nan_(skip_nan)  {   }
+
+    result_type     result_ {  };
+    const size_type roll_count_;
+    const bool      skip_nan_;
+};
+
+// ----------------------------------------------------------------------------
+
+template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
+struct  RollingMedianVisitor : public RollingOrderStatBase<T, I, A>  {
+
+    using BaseClass = RollingOrderStatBase<T, I, A>;
+
+    template <forward_iterator K, forward_iterator H>
+    inline void
+    operator() (const K &, const K &,
+                const H &column_begin, const H &column_end)  {
+
+        BaseClass::roll_(column_begin, column_end,
+                         [](const auto &window, const T &) -> T  {
+                             return (BaseClass::median_(window));
+                         });
+    }
+
+    explicit
+    RollingMedianVisitor(std::size_t roll_count, bool skip_nan = false)
+        : BaseClass(roll_count, skip_nan)  {   }
+};
+
+template<typename T, typename I = unsigned long, std::size_t A = 0>
+using rmed_v = RollingMedianVisitor<T, I, A>;
+
+// ----------------------------------------------------------------------------
+
+// The quantile of each window is selected the same way QuantileVisitor
+// selects it over a column
+//
+template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
+struct  RollingQuantileVisitor : public RollingOrderStatBase<T, I, A>  {
+
+    using BaseClass = RollingOrderStatBase<T, I, A>;
+    using size_type = typename BaseClass::size_type;
+
+    template <forward_iterator K, forward_iterator H>
+    inline void
+    operator() (const K &, const K &,
+                const H &column_begin, const H &column_end)  {
+
+#ifdef HMDF_SANITY_EXCEPTIONS
+        if (qt_ < 0.0 || qt_ > 1.0)
+            throw DataFrameError("RollingQuantileVisitor: qt must >= 0 and "
+                                 "<= 1");
+#endif // HMDF_SANITY_EXCEPTIONS
+
+        BaseClass::roll_(column_begin, column_end,
+                         [this](const auto &window, const T &) -> T  {
+                             return (quantile_(window));
+                         });
+    }
+
+    explicit
+    RollingQuantileVisitor(
+        std::size_t roll_count,
+        double quantile = 0.5,
+        quantile_policy q_policy = quantile_policy::mid_point,
+        bool skip_nan = false)
+        : BaseClass(roll_count, skip_nan),
+          qt_(quantile),
+          policy_(q_policy)  {   }
+
+private:
+
+    template<typename W>
+    inline T quantile_(const W &window) const  {
+
+        const size_type n = window.size();
+        const double    vec_len_frac = qt_ * n;
+        const size_type int_idx =
+            static_cast<size_type>(std::round(vec_len_frac));
+        const bool      need_two =
+            ! (n & 0x01) || double(int_idx) < vec_len_frac;
+        const auto      kth =  // k starts from 1, like KthValueVisitor
+            [&window, n](size_type k) -> T  {
+                return (window[std::clamp<size_type>(k, 1, n) - 1]);
+            };
+
+        if (qt_ == 0.0 || qt_ == 1.0)
+            return (kth(qt_ == 0.0 ? 1 : n));
+        if (policy_ == quantile_policy::mid_point ||
+            policy_ == quantile_policy::linear)  {
+            T   result = kth(int_idx);
+
+            if (need_two && int_idx + 1 < n)  {
+                if (policy_ == quantile_policy::mid_point)
+                    result = (result + kth(int_idx + 1)) / T(2);
+                else // linear
+                    result = result + (kth(int_idx + 1) - result) *
+                             (1.0 - qt_);
+            }
+            return (result);
+        }
+        return (kth(policy_ == quantile_policy::lower_value
+                    ? int_idx
+                    : (int_idx + 1 < n && need_two ? int_idx + 1 : int_idx)));
+    }
+
+    const double            qt_;
+    const quantile_policy   policy_;
+};
+
+template<typename T, typename I = unsigned long, std::size_t A = 0>
+using rqt_v = RollingQuantileVisitor<T, I, A>;
+
+// ----------------------------------------------------------------------------
+
+// All 4 mad_type's are supported.
+// The mean absolute deviations come from the window prefix sums. The median
+// absolute deviations select from the distances below and above the center,
+// which are two sorted sequences, so no window is copied.
+//
+template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
+struct  RollingMADVisitor : public RollingOrderStatBase<T, I, A>  {
+
+    using BaseClass = RollingOrderStatBase<T, I, A>;
+    using size_type = typename BaseClass::size_type;
+
+    template <forward_iterator K, forward_iterator H>
+    inline void
+    operator() (const K &, const K &,
+                const H &column_begin, const H &column_end)  {
+
+        BaseClass::roll_(column_begin, column_end,
+                         [this](const auto &window, const T &) -> T  {
+                             return (mad_(window));
+                         });
+    }
+
+    explicit
+    RollingMADVisitor(std::size_t roll_count,
+                      mad_type mt,
+                      bool skip_nan = false)
+        : BaseClass(roll_count, skip_nan), mad_type_(mt)  {   }
+
+private:
+
+    template<typename W>
+    inline T mad_(const W &window) const  {
+
+        const size_type n = window.size();
+
+        switch (mad_type_)  {
+            case mad_type::mean_abs_dev_around_mean:
+                return (mean_abs_dev_(window,
+                                      window.sum_smallest(n) / T(n)));
+            case mad_type::mean_abs_dev_around_median:
+                return (mean_abs_dev_(window, BaseClass::median_(window)));
+            case mad_type::median_abs_dev_around_mean:
+                return (median_abs_dev_(window,
+                                        window.sum_smallest(n) / T(n)));
+            case mad_type::median_abs_dev_around_median:
+                return (median_abs_dev_(window, BaseClass::median_(window)));
+            default:
+                return (std::numeric_limits<T>::quiet_NaN());
+        }
+    }
+
+    template<typename W>
+    inline static T mean_abs_dev_(const W &window, T center)  {
+
+        const size_type n = window.size();
+        const size_type below_cnt = window.count_less(center);
+        const T         below_sum = window.sum_smallest(below_cnt);
+        const T         above_sum = window.sum_smallest(n) - below_sum;
+
+        return ((center * T(below_cnt) - below_sum +
+                 above_sum - center * T(n - below_cnt)) / T(n));
+    }
+
+    template<typename W>
+    inline static T median_abs_dev_(const W &window, T center)  {
+
+        const size_type n = window.size();
+        const size_type below_cnt = window.count_less(center);
+        const size_type above_cnt = n - below_cnt;
+
+        // Distances of the items below and above center, both ascending
+        //
+        const auto  below =
+            [&window, center, below_cnt](size_type i) -> T  {
+                return (center - window[below_cnt - 1 - i]);
+            };
+        const auto  above =
+            [&window, center, below_cnt](size_type i) -> T  {
+                return (window[below_cnt + i] - center);
+            };
+
+        // k-th (from 0) smallest distance. Find how many of the k + 1
+        // smallest come from below
+        //
+        const auto  kth =
+            [&below, &above, below_cnt, above_cnt](size_type k) -> T  {
+                size_type   lo = k + 1 > above_cnt ? k + 1 - above_cnt : 0;
+                size_type   hi = std::min(k + 1, below_cnt);
+
+                while (lo < hi)  {
+                    const size_type mid = (lo + hi) >> 1;
+
+                    if (below(mid) < above(k - mid))  lo = mid + 1;
+                    else  hi = mid;
+                }
+
+                T   result = std::numeric_limits<T>::lowest();
+
+                if (lo > 0)  result = below(lo - 1);
+                if (k + 1 - lo > 0)  result = std::max(result, above(k - lo));
+                return (result);
+            };
+
+        const size_type half = n >> 1;
+
+        if (n & 0x01)  return (kth(half));
+        return ((kth(half - 1) + kth(half)) / T(2));
+    }
+
+    const mad_type  mad_type_;
+};
+
+template<typename T, typename I = unsigned long, std::size_t A = 0>
+using rmad_v = RollingMADVisitor<T, I, A>;
+
+// ----------------------------------------------------------------------------
+
+// Percentile rank of the newest item in each window, among the items in the
+// window. It is (rank + 1) / window size, where rank starts from 0 and
+// repeated values are ranked based on rank policy. The newest item is the
+// last of its repeats, so rank_policy::actual is the same as last.
+//
+template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
+struct  RollingPercentRankVisitor : public RollingOrderStatBase<T, I, A>  {
+
+    using BaseClass = RollingOrderStatBase<T, I, A>;
+    using size_type = typename BaseClass::size_type;
+
+    template <forward_iterator K, forward_iterator H>
+    inline void
+    operator() (const K &, const K &,
+                const H &column_begin, const H &column_end)  {
+
+        BaseClass::roll_(
+            column_begin, column_end,
+            [this](const auto &window, const T &val) -> T  {
+                if (is_nan__(val)) [[unlikely]]
+                    return (std::numeric_limits<T>::quiet_NaN());
+
+                const size_type less = window.count_less(val);
+                const size_type repeats =
+                    window.count_less_equal(val) - less;
+                T               rank;
+
+                switch (policy_)  {
+                    case rank_policy::average:
+                        rank = T(less) + T(repeats - 1) / T(2);
+                        break;
+                    case rank_policy::first:
+                        rank = T(less);
+                        break;
+                    default:  // last and actual
+                        rank = T(less + repeats - 1);
+                        break;
+                }
+                return ((rank + T(1)) / T(window.size()));
+            });
+    }
+
+    explicit
+    RollingPercentRankVisitor(std::size_t roll_count,
+                              rank_policy p = rank_policy::average,
+                              bool skip_nan = false)
+        : BaseClass(roll_count, skip_nan), policy_(p)  {   }
+
+private:
+
+    const rank_policy   policy_;
+};
+
+template<typename T, typename I = unsigned long, std::size_t A = 0>
+using rprank_v = RollingPercentRankVisitor<T, I, A>;
+
+// ----------------------------------------------------------------------------
+
 template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
 struct  DiffVisitor  {
 
@@ -4082,8 +5073,9 @@ struct  ZScoreVisitor  {
 
         MeanVisitor<T, I>   mvisit { skip_nan_ };
         StdVisitor<T, I>    svisit;
-        const auto          thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto          thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         mvisit.pre();
         svisit.pre();
@@ -4123,6 +5115,7 @@ struct  ZScoreVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [m, s, &result, &column_begin]
@@ -4189,8 +5182,11 @@ struct  SampleZScoreVisitor  {
         p_mvisit.pre();
         p_svisit.pre();
         s_mvisit.pre();
-        if (s_col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 3)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    s_col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 3)  {
             auto    fut1 =
                 ThreadGranularity::thr_pool_.dispatch(
                       false,
@@ -4269,6 +5265,7 @@ private:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [this, &column_begin]
@@ -4306,6 +5303,7 @@ private:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [this, &column_begin]
@@ -4344,6 +5342,7 @@ private:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [this, &column_begin]
@@ -4373,6 +5372,7 @@ private:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [this, &column_begin]
@@ -4406,6 +5406,7 @@ private:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [this, shift, &column_begin]
@@ -4435,6 +5436,7 @@ private:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [this, shift, &column_begin]
@@ -4478,6 +5480,7 @@ private:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [this, shift, gm = gm.get_result(), &column_begin]
@@ -4518,6 +5521,7 @@ private:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [this, shift, gm = gm.get_result(), &column_begin]
@@ -4564,8 +5568,9 @@ public:
         }
 
         const size_type col_s = std::distance(column_begin, column_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         if (box_cox_type_ == box_cox_type::original)
             original_(column_begin, column_end, shift, col_s, thread_level);
@@ -4614,13 +5619,16 @@ struct  ProbabilityDistVisitor  {
         result_type result;
         value_type  sum { 0 };
 
-        if (std::distance(column_begin, column_end) >=
-                ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    std::distance(column_begin, column_end),
+                    ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
+            thread_level > 2)  {
             result.resize(col_s);
             if (pdtype_ == prob_dist_type::arithmetic)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         column_begin,
                         column_end,
                         []
@@ -4635,6 +5643,7 @@ struct  ProbabilityDistVisitor  {
                 for (auto &fut : futures)  sum += fut.get();
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, &result, sum]
@@ -4648,6 +5657,7 @@ struct  ProbabilityDistVisitor  {
             else if (pdtype_ == prob_dist_type::log)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         column_begin,
                         column_end,
                         []
@@ -4662,6 +5672,7 @@ struct  ProbabilityDistVisitor  {
                 for (auto &fut : futures)  sum += fut.get();
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, &result, sum]
@@ -4676,6 +5687,7 @@ struct  ProbabilityDistVisitor  {
             else if (pdtype_ == prob_dist_type::softmax)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         column_begin,
                         column_end,
                         []
@@ -4690,6 +5702,7 @@ struct  ProbabilityDistVisitor  {
                 for (auto &fut : futures)  sum += fut.get();
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, &result, sum]
@@ -4704,6 +5717,7 @@ struct  ProbabilityDistVisitor  {
             else if (pdtype_ == prob_dist_type::pow2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         column_begin,
                         column_end,
                         []
@@ -4718,6 +5732,7 @@ struct  ProbabilityDistVisitor  {
                 for (auto &fut : futures)  sum += fut.get();
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, &result, sum]
@@ -4732,6 +5747,7 @@ struct  ProbabilityDistVisitor  {
             else if (pdtype_ == prob_dist_type::pow10)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         column_begin,
                         column_end,
                         []
@@ -4746,6 +5762,7 @@ struct  ProbabilityDistVisitor  {
                 for (auto &fut : futures)  sum += fut.get();
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&column_begin, &result, sum]
@@ -4886,10 +5903,14 @@ private:
         const size_type     col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [minv = minv.get_result(), &column_begin, diff, this]
@@ -4924,10 +5945,14 @@ private:
         const size_type col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [sumv = sumv.get_result(), &column_begin, this]
@@ -4961,10 +5986,14 @@ private:
         const size_type col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [eucli = eucliv.get_euclidean_norm(), &column_begin, this]
@@ -4998,10 +6027,14 @@ private:
         const size_type col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [maxv = maxv.get_result(), &column_begin, this]
@@ -5039,10 +6072,14 @@ private:
         const size_type col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [meanv = meanv.get_result(), stdv = stdv.get_result(),
@@ -5083,10 +6120,14 @@ private:
         const size_type     col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [scale, &column_begin, this]
@@ -5112,10 +6153,14 @@ private:
         const size_type col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this](auto begin, auto end) -> void  {
@@ -5140,10 +6185,14 @@ private:
         const size_type col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this](auto begin, auto end) -> void  {
@@ -5194,10 +6243,14 @@ struct  StandardizeVisitor  {
         const size_type col_s = std::distance(column_begin, column_end);
 
         result_.resize(col_s);
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [mv = mv.get_result(), sv = sv.get_result(),
@@ -5257,8 +6310,9 @@ public:
                 const Hy &y_begin, const Hy &y_end)  {
 
         const size_type col_s = std::distance(x_begin, x_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(y_begin, y_end)))
@@ -5283,6 +6337,7 @@ public:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&x_begin, &idx_begin, i, this]
@@ -5335,6 +6390,7 @@ public:
             if (thread_level > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&x_begin, &y_begin, &idx_begin, i, this]
@@ -5490,14 +6546,16 @@ struct  LogFitVisitor  {
                 const H &y_begin, const H &y_end)  {
 
         const size_type col_s = std::distance(x_begin, x_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
         result_type logx (x_begin, x_end);
 
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&logx](auto begin, auto end) -> void  {
@@ -5520,6 +6578,7 @@ struct  LogFitVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&x_begin, &y_begin, &idx_begin, this]
@@ -5601,8 +6660,9 @@ struct  ExponentialFitVisitor  {
                 const H &y_begin, const H &y_end)  {
 
         const size_type col_s = std::distance(x_begin, x_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(y_begin, y_end)))
@@ -5621,6 +6681,7 @@ struct  ExponentialFitVisitor  {
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&x_begin, &y_begin](auto begin, auto end) -> sum_t  {
@@ -5678,6 +6739,7 @@ struct  ExponentialFitVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&x_begin, &y_begin, prefactor, this]
@@ -5759,8 +6821,9 @@ struct  LinearFitVisitor  {
                 const H &y_begin, const H &y_end)  {
 
         const size_type col_s = std::distance(x_begin, x_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(y_begin, y_end)))
@@ -5779,6 +6842,7 @@ struct  LinearFitVisitor  {
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&x_begin, &y_begin](auto begin, auto end) -> sum_t  {
@@ -5834,6 +6898,7 @@ struct  LinearFitVisitor  {
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&x_begin, &y_begin, this]
@@ -5919,8 +6984,9 @@ struct  CubicSplineFitVisitor  {
                 const H &y_begin, const H &y_end)  {
 
         const size_type col_s = std::distance(x_begin, x_end);
-        const auto      thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto      thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
 
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (col_s != size_type(std::distance(y_begin, y_end)) || col_s <= 3)
@@ -5935,6 +7001,7 @@ struct  CubicSplineFitVisitor  {
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s - 1,
                     [&x_begin, &h](auto begin, auto end) -> void  {
@@ -6054,10 +7121,14 @@ private:
     inline static
     void bi_square_(X x_begin, X x_end, long thread_level)  {
 
-        if (thread_level > 2 &&
-            std::distance(x_begin, x_end) >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        std::distance(x_begin, x_end),
+                        ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     x_begin,
                     x_end,
                     [](const auto &begin, const auto &end) -> void  {
@@ -6088,10 +7159,14 @@ private:
     inline static
     void tri_cube_(X x_begin, X x_end, long thread_level)  {
 
-        if (thread_level > 2 &&
-            std::distance(x_begin, x_end) >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        std::distance(x_begin, x_end),
+                        ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
+            thread_level > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thr_lvl,
                     x_begin,
                     x_end,
                     [](const auto &begin, const auto &end) -> void  {
@@ -6125,9 +7200,14 @@ private:
 
         const size_type col_s = std::distance(y_begin, y_end);
 
-        if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+        if (const auto thr_lvl =
+                ThreadGranularity::get_thread_level(
+                        col_s, ThreadGranularity::VISIT_WORK,
+                        1, sizeof(value_type));
+            thread_level_ > 2 && thr_lvl > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop2(
+                    thr_lvl,
                     size_type(0),
                     col_s,
                     size_type(0),
@@ -6167,9 +7247,14 @@ private:
         else  {
             const value_type    val = T(6) * median_v.get_result();
 
-            if (thread_level_ > 2 && col_s >= ThreadPool::MUL_THR_THHOLD)  {
+            if (const auto thr_lvl =
+                    ThreadGranularity::get_thread_level(
+                            col_s, ThreadGranularity::VISIT_WORK,
+                            1, sizeof(value_type));
+                thread_level_ > 2 && thr_lvl > 2)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thr_lvl,
                         resid_weights_.begin(),
                         resid_weights_.end(),
                         [val](const auto &begin, const auto &end) -> void  {
@@ -6724,13 +7809,17 @@ private:
         // What is left is residual
         //
         residual_.resize(col_s, 0);
-        if (detrended.size() >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    detrended.size(), ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             std::vector<std::future<void>>  futures;
 
             if (type_ == decompose_type::additive)
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop2(
+                        thread_level,
                         size_type(0),
                         detrended.size(),
                         size_type(0),
@@ -6744,6 +7833,7 @@ private:
             else
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop2(
+                        thread_level,
                         size_type(0),
                         detrended.size(),
                         size_type(0),
@@ -6797,13 +7887,17 @@ public:
 
         // Remove trend from observations in y
         //
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             std::vector<std::future<void>>  futures;
 
             if (type_ == decompose_type::additive)
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop2(
+                        thread_level,
                         size_type(0),
                         col_s,
                         size_type(0),
@@ -6817,6 +7911,7 @@ public:
             else
                 futures =
                     ThreadGranularity::thr_pool_.parallel_loop2(
+                        thread_level,
                         size_type(0),
                         col_s,
                         size_type(0),
@@ -7051,10 +8146,14 @@ struct  BiasVisitor  {
         avger.post();
 
         result_ = std::move(avger.get_result());
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop2(
+                    thread_level,
                     roll_period_ - 1,
                     col_s,
                     roll_period_ - 1,
@@ -7119,12 +8218,16 @@ struct  NonZeroRangeVisitor  {
         bool        there_is_zero = false;
         result_type result;
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             result.resize(col_s);
 
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&result, &column1_begin, &column2_begin]
@@ -7145,6 +8248,7 @@ struct  NonZeroRangeVisitor  {
             if (there_is_zero)  {
                 auto    futures =
                     ThreadGranularity::thr_pool_.parallel_loop(
+                        thread_level,
                         size_type(0),
                         col_s,
                         [&result]
@@ -76,10 +76,14 @@ struct  ClipVisitor  {
 
         GET_COL_SIZE
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, this]
@@ -155,10 +159,14 @@ struct  AbsVisitor  {
 
         GET_COL_SIZE
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (const auto thread_level =
+                ThreadGranularity::get_thread_level(
+                    col_s, ThreadGranularity::VISIT_WORK,
+                    1, sizeof(value_type));
+            thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin]
@@ -226,20 +234,23 @@ private:
 
         GET_COL_SIZE
 
-        const auto  thread_level = (col_s < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        const auto  thread_level =
+            ThreadGranularity::get_thread_level(
+                col_s, ThreadGranularity::VISIT_WORK, 1, sizeof(value_type));
         vec_t       diff(col_s);
 
         if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&aggr = std::as_const(aggr.get_result()), &diff,
                      &column_begin]
                     (auto begin, auto end) -> void  {
                         for (size_type i = begin; i < end; ++i)
-                            diff[i] = aggr[i] - *(column_begin + i);
+                            diff[i] =
+                                std::fabs(aggr[i] - *(column_begin + i));
                     });
 
             for (auto &fut : futures)  fut.get();
@@ -261,10 +272,10 @@ private:
 
         const value_type    factor = num_of_std_ * unbiased_factor_;
 
-        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
-            ThreadGranularity::get_thread_level() > 2)  {
+        if (thread_level > 2)  {
             auto    futures =
                 ThreadGranularity::thr_pool_.parallel_loop(
+                    thread_level,
                     size_type(0),
                     col_s,
                     [&column_begin, &diff = std::as_const(diff), factor,
@@ -140,6 +140,17 @@ enum class  join_policy : unsigned char  {
 
 // ----------------------------------------------------------------------------
 
+// Which rhs row each lhs row is matched with in join_asof()
+//
+enum class  asof_policy : unsigned char  {
+
+    backward = 1,  // Last rhs row with index <= lhs index
+    forward = 2,   // First rhs row with index >= lhs index
+    nearest = 3,   // The closer of the above two. Ties go backward
+};
+
+// ----------------------------------------------------------------------------
+
 enum class  concat_policy : unsigned char  {
 
     common_columns = 1,
@@ -149,6 +160,28 @@ enum class  concat_policy : unsigned char  {
 
 // ----------------------------------------------------------------------------
 
+// How groupby1/2/3 find the rows that belong to the same group
+//
+enum class  groupby_policy : unsigned char  {
+
+    // Sort the rows by the groupby column(s).
+    // Groups come out in ascending order of their keys
+    //
+    sort = 1,
+
+    // Hash the groupby column(s) to give each row a group id in one pass.
+    // Groups come out in ascending order of their keys, same as sort
+    //
+    hash_sorted = 2,
+
+    // Hash the groupby column(s) to give each row a group id in one pass.
+    // Groups come out in the order their keys first appear in the data
+    //
+    hash_unsorted = 3,
+};
+
+// ----------------------------------------------------------------------------
+
 // This policy is relative to a tabular data structure
 //
 enum class  shift_policy : unsigned char  {
@@ -296,7 +329,7 @@ enum class  io_format : unsigned char  {
     csv2 = 2,  // Regular csv format (similar to Pandas)
     json = 3,
     hdf5 = 4,
-    binary = 5,
+    binary = 5,  // DataFrame specific columnar binary format
 };
 
 // ----------------------------------------------------------------------------
@@ -644,6 +677,35 @@ struct  Index2D  {
 
 // ----------------------------------------------------------------------------
 
+// Comparison of a ColumnPred
+//
+enum class  compare_op : unsigned char  {
+
+    eq = 1,  // ==
+    ne = 2,  // !=
+    lt = 3,  // <
+    le = 4,  // <=
+    gt = 5,  // >
+    ge = 6,  // >=
+};
+
+// ----------------------------------------------------------------------------
+
+// A simple predicate on a column, for example { "price", compare_op::gt, 8.0 }
+// It is what get_data_by_pred() and friends evaluate in bulk
+//
+template<typename T>
+struct  ColumnPred  {
+
+    using type = T;
+
+    const char  *col_name { nullptr };
+    compare_op  op { compare_op::eq };
+    T           value { };
+};
+
+// ----------------------------------------------------------------------------
+
 template<typename V>
 using GroupBySpec = std::tuple<const char *, const char *, V>;
 
@@ -726,6 +788,9 @@ struct  supports_arithmetic<
 template<typename I, typename H>
 class   DataFrame;
 
+template<typename DF>
+class   DataFrameReader;
+
 template<typename I>
 using StdDataFrame = DataFrame<I, HeteroVector<0>>;
 
@@ -58,6 +58,8 @@ DataFrame<I, H>::operator= (const DataFrame &that)  {
 
     if (this != &that)  {
         indices_ = that.indices_;
+        idx_order_.store(that.idx_order_.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
         column_tb_ = that.column_tb_;
         column_list_ = that.column_list_;
 
@@ -76,6 +78,10 @@ DataFrame<I, H>::operator= (DataFrame &&that)  {
 
     if (this != &that)  {
         indices_ = std::exchange(that.indices_, IndexVecType { });
+        idx_order_.store(
+            that.idx_order_.exchange(IdxOrder::unknown,
+                                     std::memory_order_relaxed),
+            std::memory_order_relaxed);
         column_tb_ = std::exchange(that.column_tb_, ColNameDict { });
         column_list_ = std::exchange(that.column_list_, ColNameList { });
 
@@ -134,9 +140,12 @@ DataFrame<I, H>::shuffle(const StlVecType<const char *> &col_names,
     std::random_device  rd;
     std::mt19937        g ((seed != seed_t(-1)) ? seed : rd());
     std::future<void>   idx_future;
-    const auto          thread_level =
-        (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+    size_type           row_bytes = also_shuffle_index ? sizeof(IndexType) : 0;
+
+    for (const auto &name : col_names)  row_bytes += col_bytes_<Ts ...>(name);
+
+    const auto  thread_level =
+        get_thread_level(indices_.size(), GATHER_WORK, 1, row_bytes);
 
     if (also_shuffle_index)  {
         if (thread_level > 2)  {
@@ -148,6 +157,7 @@ DataFrame<I, H>::shuffle(const StlVecType<const char *> &col_names,
         }
         else
             std::shuffle(indices_.begin(), indices_.end(), g);
+        index_changed_();
     }
 
     shuffle_functor_<Ts ...>    functor (g);
@@ -197,8 +207,7 @@ fill_missing(const StlVecType<const char *> &col_names,
 
     const size_type                 count = col_names.size();
     const auto                      thread_level =
-        (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(indices_.size(), COPY_WORK, count, sizeof(T));
     StlVecType<std::future<void>>   futures;
 
     if (thread_level > 2)
@@ -293,8 +302,8 @@ drop_missing(drop_policy policy, size_type threshold)  {
     DropRowMap                      missing_row_map;
     const size_type                 num_cols = data_.size();
     const auto                      thread_level =
-        (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(indices_.size(), COPY_WORK,
+                         1, row_bytes_<Ts ...>() + sizeof(IndexType));
     std::vector<std::future<void>>  futures;
 
     if (thread_level > 2)  futures.reserve(num_cols + 1);
@@ -322,6 +331,7 @@ drop_missing(drop_policy policy, size_type threshold)  {
                            policy,
                            threshold,
                            num_cols);
+    index_erased_();
 
     drop_missing_rows_functor_<Ts ...>  functor2 (missing_row_map,
                                                   policy,
@@ -368,6 +378,7 @@ replace_index(const StlVecType<IndexType> &old_values,
 
     replace_vector_vals_<IndexVecType, IndexType>
         (indices_, old_values, new_values, count, limit);
+    if (count > 0)  index_changed_();
 
     return (count);
 }
@@ -448,8 +459,7 @@ void DataFrame<I, H>::shrink_to_fit ()  {
 
     shrink_to_fit_functor_<Ts ...>  functor;
     const auto                      thread_level =
-        (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(indices_.size(), COPY_WORK, 1, row_bytes_<Ts ...>());
     const SpinGuard                 guard(lock_);
 
     if (thread_level > 2)  {
@@ -459,7 +469,8 @@ void DataFrame<I, H>::shrink_to_fit ()  {
                     citer->change(functor);
             };
             auto    futures =
-                thr_pool_.parallel_loop(data_.begin(), data_.end(),
+                thr_pool_.parallel_loop(thread_level,
+                                        data_.begin(), data_.end(),
                                         std::move(lbd));
 
             for (auto &fut : futures)  fut.get();
@@ -510,9 +521,13 @@ sort(const char *name, sort_spec dir, bool ignore_index)  {
     auto        zip = std::ranges::views::zip(*vec, sorting_idxs);
     auto        zip_idx = std::ranges::views::zip(*vec, indices_, sorting_idxs);
     const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level(idx_s, SORT_WORK, 1, sizeof(T));
 
-    if (dir == sort_spec::ascen)  {
+    if (radix_sort_common_(sorting_idxs, ignore_index,
+                           std::make_pair(vec, dir)))  {
+        ;  // Keys and index are already reordered
+    }
+    else if (dir == sort_spec::ascen)  {
         if (thread_level > 2)  {
             if (! ignore_index)
                 thr_pool_.parallel_sort(zip_idx.begin(), zip_idx.end(), a);
@@ -569,7 +584,9 @@ sort(const char *name, sort_spec dir, bool ignore_index)  {
         }
     }
 
-    if (((column_list_.size() - 1) > 1) && get_thread_level() > 2)  {
+    if (const auto thr_lvl =
+            get_thread_level(idx_s, GATHER_WORK, 1, row_bytes_<Ts ...>(name));
+        ((column_list_.size() - 1) > 1) && thr_lvl > 2)  {
         auto    lbd = [name,
                        &sorting_idxs = std::as_const(sorting_idxs),
                        idx_s, this]
@@ -581,7 +598,8 @@ sort(const char *name, sort_spec dir, bool ignore_index)  {
                     this->data_[citer->second].change(functor);
         };
         auto    futures =
-            thr_pool_.parallel_loop(column_list_.begin(), column_list_.end(),
+            thr_pool_.parallel_loop(thr_lvl,
+                                    column_list_.begin(), column_list_.end(),
                                     std::move(lbd));
 
         for (auto &fut : futures)  fut.get();
@@ -593,6 +611,7 @@ sort(const char *name, sort_spec dir, bool ignore_index)  {
             if (citer.first != name)
                 data_[citer.second].change(functor);
     }
+    index_sorted_by_(ignore_index, dir, { name });
     return;
 }
 
@@ -763,9 +782,14 @@ sort(const char *name1, sort_spec dir1,
     auto        zip_idx =
         std::ranges::views::zip(*vec1, *vec2, indices_, sorting_idxs);
     const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level(idx_s, SORT_WORK, 1, sizeof(T1) + sizeof(T2));
 
-    if (dir1 == sort_spec::ascen && dir2 == sort_spec::ascen)  {
+    if (radix_sort_common_(sorting_idxs, ignore_index,
+                           std::make_pair(vec1, dir1),
+                           std::make_pair(vec2, dir2)))  {
+        ;  // Keys and index are already reordered
+    }
+    else if (dir1 == sort_spec::ascen && dir2 == sort_spec::ascen)  {
         if (thread_level > 2)  {
             if (! ignore_index)
                 thr_pool_.parallel_sort(zip_idx.begin(), zip_idx.end(), a_a);
@@ -990,7 +1014,10 @@ sort(const char *name1, sort_spec dir1,
         }
     }
 
-    if (((column_list_.size() - 2) > 1) && get_thread_level() > 2)  {
+    if (const auto thr_lvl =
+            get_thread_level(idx_s, GATHER_WORK,
+                             1, row_bytes_<Ts ...>(name1, name2));
+        ((column_list_.size() - 2) > 1) && thr_lvl > 2)  {
         auto    lbd = [name1, name2,
                        &sorting_idxs = std::as_const(sorting_idxs),
                        idx_s, this]
@@ -1002,7 +1029,8 @@ sort(const char *name1, sort_spec dir1,
                     this->data_[citer->second].change(functor);
         };
         auto    futures =
-            thr_pool_.parallel_loop(column_list_.begin(), column_list_.end(),
+            thr_pool_.parallel_loop(thr_lvl,
+                                    column_list_.begin(), column_list_.end(),
                                     std::move(lbd));
 
         for (auto &fut : futures)  fut.get();
@@ -1014,6 +1042,7 @@ sort(const char *name1, sort_spec dir1,
             if (citer.first != name1 && citer.first != name2)
                 data_[citer.second].change(functor);
     }
+    index_sorted_by_(ignore_index, dir1, { name1, name2 });
     return;
 }
 
@@ -1127,9 +1156,16 @@ sort(const char *name1, sort_spec dir1,
     auto        zip_idx =
         std::ranges::views::zip(*vec1, *vec2, *vec3, indices_, sorting_idxs);
     const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level(idx_s, SORT_WORK,
+                         1, sizeof(T1) + sizeof(T2) + sizeof(T3));
 
-    if (thread_level > 2)  {
+    if (radix_sort_common_(sorting_idxs, ignore_index,
+                           std::make_pair(vec1, dir1),
+                           std::make_pair(vec2, dir2),
+                           std::make_pair(vec3, dir3)))  {
+        ;  // Keys and index are already reordered
+    }
+    else if (thread_level > 2)  {
         if (! ignore_index)
             thr_pool_.parallel_sort(zip_idx.begin(), zip_idx.end(), cf);
         else
@@ -1142,7 +1178,10 @@ sort(const char *name1, sort_spec dir1,
             std::ranges::sort(zip, cf);
     }
 
-    if (((column_list_.size() - 3) > 1) && get_thread_level() > 2)  {
+    if (const auto thr_lvl =
+            get_thread_level(idx_s, GATHER_WORK,
+                             1, row_bytes_<Ts ...>(name1, name2, name3));
+        ((column_list_.size() - 3) > 1) && thr_lvl > 2)  {
         auto    lbd = [name1, name2, name3,
                        &sorting_idxs = std::as_const(sorting_idxs),
                        idx_s, this]
@@ -1156,7 +1195,8 @@ sort(const char *name1, sort_spec dir1,
                     this->data_[citer->second].change(functor);
         };
         auto    futures =
-            thr_pool_.parallel_loop(column_list_.begin(), column_list_.end(),
+            thr_pool_.parallel_loop(thr_lvl,
+                                    column_list_.begin(), column_list_.end(),
                                     std::move(lbd));
 
         for (auto &fut : futures)  fut.get();
@@ -1170,6 +1210,7 @@ sort(const char *name1, sort_spec dir1,
                 citer.first != name3)
                 data_[citer.second].change(functor);
     }
+    index_sorted_by_(ignore_index, dir1, { name1, name2, name3 });
     return;
 }
 
@@ -1318,9 +1359,17 @@ sort(const char *name1, sort_spec dir1,
         std::ranges::views::zip(*vec1, *vec2, *vec3, *vec4,
                                 indices_, sorting_idxs);
     const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level(idx_s, SORT_WORK, 1,
+                         sizeof(T1) + sizeof(T2) + sizeof(T3) + sizeof(T4));
 
-    if (thread_level > 2)  {
+    if (radix_sort_common_(sorting_idxs, ignore_index,
+                           std::make_pair(vec1, dir1),
+                           std::make_pair(vec2, dir2),
+                           std::make_pair(vec3, dir3),
+                           std::make_pair(vec4, dir4)))  {
+        ;  // Keys and index are already reordered
+    }
+    else if (thread_level > 2)  {
         if (! ignore_index)
             thr_pool_.parallel_sort(zip_idx.begin(), zip_idx.end(), cf);
         else
@@ -1333,7 +1382,10 @@ sort(const char *name1, sort_spec dir1,
             std::ranges::sort(zip, cf);
     }
 
-    if (((column_list_.size() - 4) > 1) && get_thread_level() > 2)  {
+    if (const auto thr_lvl =
+            get_thread_level(idx_s, GATHER_WORK, 1,
+                             row_bytes_<Ts ...>(name1, name2, name3, name4));
+        ((column_list_.size() - 4) > 1) && thr_lvl > 2)  {
         auto    lbd = [name1, name2, name3, name4,
                        &sorting_idxs = std::as_const(sorting_idxs),
                        idx_s, this]
@@ -1348,7 +1400,8 @@ sort(const char *name1, sort_spec dir1,
                     this->data_[citer->second].change(functor);
         };
         auto    futures =
-            thr_pool_.parallel_loop(column_list_.begin(), column_list_.end(),
+            thr_pool_.parallel_loop(thr_lvl,
+                                    column_list_.begin(), column_list_.end(),
                                     std::move(lbd));
 
         for (auto &fut : futures)  fut.get();
@@ -1363,6 +1416,8 @@ sort(const char *name1, sort_spec dir1,
                 citer.first != name4)
                 data_[citer.second].change(functor);
     }
+    index_sorted_by_(ignore_index, dir1,
+                     { name1, name2, name3, name4 });
     return;
 }
 
@@ -1548,9 +1603,19 @@ sort(const char *name1, sort_spec dir1,
         std::ranges::views::zip(*vec1, *vec2, *vec3, *vec4, *vec5,
                                 indices_, sorting_idxs);
     const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
-
-    if (thread_level > 2)  {
+        get_thread_level(idx_s, SORT_WORK, 1,
+                         sizeof(T1) + sizeof(T2) + sizeof(T3) +
+                         sizeof(T4) + sizeof(T5));
+
+    if (radix_sort_common_(sorting_idxs, ignore_index,
+                           std::make_pair(vec1, dir1),
+                           std::make_pair(vec2, dir2),
+                           std::make_pair(vec3, dir3),
+                           std::make_pair(vec4, dir4),
+                           std::make_pair(vec5, dir5)))  {
+        ;  // Keys and index are already reordered
+    }
+    else if (thread_level > 2)  {
         if (! ignore_index)
             thr_pool_.parallel_sort(zip_idx.begin(), zip_idx.end(), cf);
         else
@@ -1563,7 +1628,11 @@ sort(const char *name1, sort_spec dir1,
             std::ranges::sort(zip, cf);
     }
 
-    if (((column_list_.size() - 5) > 1) && get_thread_level() > 2)  {
+    if (const auto thr_lvl =
+            get_thread_level(idx_s, GATHER_WORK, 1,
+                             row_bytes_<Ts ...>(name1, name2, name3,
+                                                name4, name5));
+        ((column_list_.size() - 5) > 1) && thr_lvl > 2)  {
         auto    lbd = [name1, name2, name3, name4, name5,
                        &sorting_idxs = std::as_const(sorting_idxs),
                        idx_s, this]
@@ -1579,7 +1648,8 @@ sort(const char *name1, sort_spec dir1,
                     this->data_[citer->second].change(functor);
         };
         auto    futures =
-            thr_pool_.parallel_loop(column_list_.begin(), column_list_.end(),
+            thr_pool_.parallel_loop(thr_lvl,
+                                    column_list_.begin(), column_list_.end(),
                                     std::move(lbd));
 
         for (auto &fut : futures)  fut.get();
@@ -1595,6 +1665,8 @@ sort(const char *name1, sort_spec dir1,
                 citer.first != name5)
                 data_[citer.second].change(functor);
     }
+    index_sorted_by_(ignore_index, dir1,
+                     { name1, name2, name3, name4, name5 });
     return;
 }
 
@@ -1714,42 +1786,33 @@ template<comparable T, typename I_V, typename ... Ts>
 DataFrame<I, H> DataFrame<I, H>::
 groupby1(const char *col_name, I_V &&idx_visitor, Ts&& ... args) const  {
 
-    const ColumnVecType<T>  *gb_vec { nullptr };
+    return (groupby1<T, I_V, Ts ...>(groupby_policy::sort,
+                                     col_name,
+                                     std::forward<I_V>(idx_visitor),
+                                     std::forward<Ts>(args) ...));
+}
+
+// ----------------------------------------------------------------------------
 
-    if (! ::strcmp(col_name, DF_INDEX_COL_NAME))
-        gb_vec = (const ColumnVecType<T> *) &(get_index());
-    else
-        gb_vec = (const ColumnVecType<T> *) &(get_column<T>(col_name));
-
-    StlVecType<std::size_t> sort_v (gb_vec->size(), 0);
-
-    std::iota(sort_v.begin(), sort_v.end(), 0);
-    std::ranges::sort(sort_v,
-                      [gb_vec](std::size_t i, std::size_t j) -> bool  {
-                          return (gb_vec->at(i) < gb_vec->at(j));
-                      });
-
-    DataFrame   res;
-    auto        args_tuple = std::tuple<Ts ...>(args ...);
-    auto        func =
-        [this,
-         &res,
-         gb_vec,
-         &sort_v = std::as_const(sort_v),
-         idx_visitor = std::forward<I_V>(idx_visitor),
-         col_name](auto &triple) mutable -> void {
-            _load_groupby_data_1_(*this,
-                                  res,
-                                  triple,
-                                  idx_visitor,
-                                  *gb_vec,
-                                  sort_v,
-                                  col_name);
-        };
+template<typename I, typename H>
+template<comparable T, typename I_V, typename ... Ts>
+DataFrame<I, H> DataFrame<I, H>::
+groupby1(groupby_policy policy,
+         const char *col_name,
+         I_V &&idx_visitor,
+         Ts&& ... args) const  {
 
     const SpinGuard guard(lock_);
-
-    for_each_in_tuple (args_tuple, func);
+    const auto      &gb_vec = groupby_col_<T>(col_name);
+    const Grouping  grouping = make_grouping_(policy, gb_vec);
+    DataFrame       res;
+    auto            args_tuple = std::tuple<Ts ...>(args ...);
+
+    groupby_common_(res,
+                    grouping,
+                    idx_visitor,
+                    args_tuple,
+                    std::make_pair(col_name, &gb_vec));
     return (res);
 }
 
@@ -1763,64 +1826,37 @@ groupby2(const char *col_name1,
          I_V &&idx_visitor,
          Ts&& ... args) const  {
 
-    const ColumnVecType<T1> *gb_vec1 { nullptr };
-    const ColumnVecType<T2> *gb_vec2 { nullptr };
-    const SpinGuard         guard (lock_);
+    return (groupby2<T1, T2, I_V, Ts ...>(groupby_policy::sort,
+                                          col_name1,
+                                          col_name2,
+                                          std::forward<I_V>(idx_visitor),
+                                          std::forward<Ts>(args) ...));
+}
 
-    if (! ::strcmp(col_name1, DF_INDEX_COL_NAME))  {
-        gb_vec1 = (const ColumnVecType<T1> *) &(get_index());
-        gb_vec2 =
-            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
-    }
-    else if (! ::strcmp(col_name2, DF_INDEX_COL_NAME))  {
-        gb_vec1 =
-            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
-        gb_vec2 = (const ColumnVecType<T2> *) &(get_index());
-    }
-    else  {
-        gb_vec1 =
-            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
-        gb_vec2 =
-            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
-    }
-
-    StlVecType<std::size_t> sort_v(
-        std::min(gb_vec1->size(), gb_vec2->size()), 0);
-
-    std::iota(sort_v.begin(), sort_v.end(), 0);
-    std::ranges::sort(sort_v,
-                      [gb_vec1, gb_vec2]
-                      (std::size_t i, std::size_t j) -> bool  {
-                          if (gb_vec1->at(i) < gb_vec1->at(j))
-                              return (true);
-                          else if (gb_vec1->at(i) > gb_vec1->at(j))
-                              return (false);
-                          return (gb_vec2->at(i) < gb_vec2->at(j));
-                      });
-
-    DataFrame   res;
-    auto        args_tuple = std::tuple<Ts ...>(args ...);
-    auto        func =
-        [*this,
-         &res,
-         gb_vec1,
-         gb_vec2,
-         &sort_v = std::as_const(sort_v),
-         idx_visitor = std::forward<I_V>(idx_visitor),
-         col_name1,
-         col_name2](auto &triple) mutable -> void {
-            _load_groupby_data_2_(*this,
-                                  res,
-                                  triple,
-                                  idx_visitor,
-                                  *gb_vec1,
-                                  *gb_vec2,
-                                  sort_v,
-                                  col_name1,
-                                  col_name2);
-        };
+// ----------------------------------------------------------------------------
 
-    for_each_in_tuple (args_tuple, func);
+template<typename I, typename H>
+template<comparable T1, comparable T2, typename I_V, typename ... Ts>
+DataFrame<I, H> DataFrame<I, H>::
+groupby2(groupby_policy policy,
+         const char *col_name1,
+         const char *col_name2,
+         I_V &&idx_visitor,
+         Ts&& ... args) const  {
+
+    const SpinGuard guard(lock_);
+    const auto      &gb_vec1 = groupby_col_<T1>(col_name1);
+    const auto      &gb_vec2 = groupby_col_<T2>(col_name2);
+    const Grouping  grouping = make_grouping_(policy, gb_vec1, gb_vec2);
+    DataFrame       res;
+    auto            args_tuple = std::tuple<Ts ...>(args ...);
+
+    groupby_common_(res,
+                    grouping,
+                    idx_visitor,
+                    args_tuple,
+                    std::make_pair(col_name1, &gb_vec1),
+                    std::make_pair(col_name2, &gb_vec2));
     return (res);
 }
 
@@ -1836,87 +1872,104 @@ groupby3(const char *col_name1,
          I_V &&idx_visitor,
          Ts&& ... args) const  {
 
-    const ColumnVecType<T1> *gb_vec1 { nullptr };
-    const ColumnVecType<T2> *gb_vec2 { nullptr };
-    const ColumnVecType<T3> *gb_vec3 { nullptr };
-    const SpinGuard         guard (lock_);
+    return (groupby3<T1, T2, T3, I_V, Ts ...>(groupby_policy::sort,
+                                              col_name1,
+                                              col_name2,
+                                              col_name3,
+                                              std::forward<I_V>(idx_visitor),
+                                              std::forward<Ts>(args) ...));
+}
 
-    if (! ::strcmp(col_name1, DF_INDEX_COL_NAME))  {
-        gb_vec1 = (const ColumnVecType<T1> *) &(get_index());
-        gb_vec2 =
-            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
-        gb_vec3 =
-            (const ColumnVecType<T3> *) &(get_column<T3>(col_name3, false));
-    }
-    else if (! ::strcmp(col_name2, DF_INDEX_COL_NAME))  {
-        gb_vec1 =
-            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
-        gb_vec2 =
-            (const ColumnVecType<T2> *) &(get_index());
-        gb_vec3 =
-            (const ColumnVecType<T3> *) &(get_column<T3>(col_name3, false));
-    }
-    else if (! ::strcmp(col_name3, DF_INDEX_COL_NAME))  {
-        gb_vec1 =
-            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
-        gb_vec2 =
-            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
-        gb_vec3 = (const ColumnVecType<T3> *) &(get_index());
-    }
-    else  {
-        gb_vec1 =
-            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
-        gb_vec2 =
-            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
-        gb_vec3 =
-            (const ColumnVecType<T3> *) &(get_column<T3>(col_name3, false));
-    }
-
-    StlVecType<std::size_t> sort_v(
-        std::min({ gb_vec1->size(), gb_vec2->size(), gb_vec3->size() }), 0);
-
-    std::iota(sort_v.begin(), sort_v.end(), 0);
-    std::ranges::sort(sort_v,
-                      [gb_vec1, gb_vec2, gb_vec3]
-                      (std::size_t i, std::size_t j) -> bool  {
-                          if (gb_vec1->at(i) < gb_vec1->at(j))
-                              return (true);
-                          else if (gb_vec1->at(i) > gb_vec1->at(j))
-                              return (false);
-                          else if (gb_vec2->at(i) < gb_vec2->at(j))
-                              return (true);
-                          else if (gb_vec2->at(i) > gb_vec2->at(j))
-                              return (false);
-                          return (gb_vec3->at(i) < gb_vec3->at(j));
-                      });
-
-    DataFrame   res;
-    auto        args_tuple = std::tuple<Ts ...>(args ...);
-    auto        func =
-        [*this,
-         &res,
-         gb_vec1,
-         gb_vec2,
-         gb_vec3,
-         &sort_v = std::as_const(sort_v),
-         idx_visitor = std::forward<I_V>(idx_visitor),
-         col_name1,
-         col_name2,
-         col_name3](auto &triple) mutable -> void {
-            _load_groupby_data_3_(*this,
-                                  res,
-                                  triple,
-                                  idx_visitor,
-                                  *gb_vec1,
-                                  *gb_vec2,
-                                  *gb_vec3,
-                                  sort_v,
-                                  col_name1,
-                                  col_name2,
-                                  col_name3);
-        };
+// ----------------------------------------------------------------------------
 
-    for_each_in_tuple (args_tuple, func);
+template<typename I, typename H>
+template<comparable T1, comparable T2, comparable T3,
+         typename I_V, typename ... Ts>
+DataFrame<I, H> DataFrame<I, H>::
+groupby3(groupby_policy policy,
+         const char *col_name1,
+         const char *col_name2,
+         const char *col_name3,
+         I_V &&idx_visitor,
+         Ts&& ... args) const  {
+
+    const SpinGuard guard(lock_);
+    const auto      &gb_vec1 = groupby_col_<T1>(col_name1);
+    const auto      &gb_vec2 = groupby_col_<T2>(col_name2);
+    const auto      &gb_vec3 = groupby_col_<T3>(col_name3);
+    const Grouping  grouping =
+        make_grouping_(policy, gb_vec1, gb_vec2, gb_vec3);
+    DataFrame       res;
+    auto            args_tuple = std::tuple<Ts ...>(args ...);
+
+    groupby_common_(res,
+                    grouping,
+                    idx_visitor,
+                    args_tuple,
+                    std::make_pair(col_name1, &gb_vec1),
+                    std::make_pair(col_name2, &gb_vec2),
+                    std::make_pair(col_name3, &gb_vec3));
+    return (res);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<comparable T>
+typename DataFrame<I, H>::Grouping DataFrame<I, H>::
+get_grouping1(const char *col_name, groupby_policy policy) const  {
+
+    const SpinGuard guard(lock_);
+
+    return (make_grouping_(policy, groupby_col_<T>(col_name)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<comparable T1, comparable T2>
+typename DataFrame<I, H>::Grouping DataFrame<I, H>::
+get_grouping2(const char *col_name1,
+              const char *col_name2,
+              groupby_policy policy) const  {
+
+    const SpinGuard guard(lock_);
+
+    return (make_grouping_(policy,
+                           groupby_col_<T1>(col_name1),
+                           groupby_col_<T2>(col_name2)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<comparable T1, comparable T2, comparable T3>
+typename DataFrame<I, H>::Grouping DataFrame<I, H>::
+get_grouping3(const char *col_name1,
+              const char *col_name2,
+              const char *col_name3,
+              groupby_policy policy) const  {
+
+    const SpinGuard guard(lock_);
+
+    return (make_grouping_(policy,
+                           groupby_col_<T1>(col_name1),
+                           groupby_col_<T2>(col_name2),
+                           groupby_col_<T3>(col_name3)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename I_V, typename ... Ts>
+DataFrame<I, H> DataFrame<I, H>::
+groupby(const Grouping &grouping, I_V &&idx_visitor, Ts&& ... args) const  {
+
+    const SpinGuard guard(lock_);
+    DataFrame       res;
+    auto            args_tuple = std::tuple<Ts ...>(args ...);
+
+    groupby_common_(res, grouping, idx_visitor, args_tuple);
     return (res);
 }
 
@@ -2077,20 +2130,40 @@ bucketize(bucket_type bt,
     const auto      &src_idx = get_index();
     const size_type idx_s = src_idx.size();
 
-    _bucketize_core_(dst_idx, src_idx, src_idx, value, idx_visitor, idx_s, bt);
+    // On a sorted index, by_distance bucket boundaries are found once by
+    // binary search and shared by all columns. A zero distance must not
+    // close a bucket, as it would in the scan.
+    //
+    std::vector<std::size_t>    starts;
+    const bool                  use_starts =
+        bt == bucket_type::by_distance && idx_s > 0 &&
+        ! (src_idx[0] - src_idx[0] >= IndexType(value)) &&
+        is_index_sorted();
+
+    if (use_starts)  starts = _bucket_starts_(src_idx, value);
+
+    const std::vector<std::size_t>  *starts_ptr =
+        use_starts ? &starts : nullptr;
+
+    _bucketize_core_(dst_idx, src_idx, src_idx, value, idx_visitor,
+                     idx_s, bt, starts_ptr);
 
     std::vector<std::future<void>>  futures;
     const auto                      thread_level =
-        (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(
+            indices_.size(), VISIT_WORK, 1,
+            (sizeof(typename std::tuple_element<
+                        2, std::decay_t<Ts>>::type::value_type) + ... + 0));
 
     if (thread_level > 2)  futures.reserve(column_list_.size());
 
     auto    args_tuple = std::tuple<Ts ...>(args ...);
     auto    func =
-        [this, &result, &value = std::as_const(value), &futures, bt]
+        [this, &result, &value = std::as_const(value), &futures, bt,
+         starts_ptr]
         (auto &triple) mutable -> void {
-            _load_bucket_data_(*this, result, value, bt, triple, futures);
+            _load_bucket_data_(*this, result, value, bt, starts_ptr,
+                               triple, futures);
         };
 
     const SpinGuard guard(lock_);
@@ -284,6 +284,46 @@ struct print_csv2_data_functor_ : DataVec::template visitor_base<Ts ...>  {
 
 // ----------------------------------------------------------------------------
 
+template<typename ... Ts>
+struct csv2_col_writer_functor_ : DataVec::template visitor_base<Ts ...>  {
+
+    inline csv2_col_writer_functor_ (csv2_col_writer_ &w) : writer(w)  {  }
+
+    csv2_col_writer_    &writer;
+
+    template<typename T>
+    void operator() (const T &vec);
+};
+
+// ----------------------------------------------------------------------------
+
+template<typename S, typename ... Ts>
+struct print_binary_functor_ : DataVec::template visitor_base<Ts ...>  {
+
+    inline print_binary_functor_ (const char *n,
+                                  S &o,
+                                  std::size_t sr,
+                                  std::size_t er,
+                                  std::size_t a,
+                                  std::size_t &p,
+                                  std::vector<_bin_col_desc_> &d)
+        : name(n), os(o), start_row(sr), end_row(er), alignment(a),
+          pos(p), dir(d)  {   }
+
+    const char                  *name;
+    S                           &os;
+    const std::size_t           start_row;
+    const std::size_t           end_row;
+    const std::size_t           alignment;
+    std::size_t                 &pos;
+    std::vector<_bin_col_desc_> &dir;
+
+    template<typename T>
+    void operator() (const T &vec);
+};
+
+// ----------------------------------------------------------------------------
+
 template<typename ... Ts>
 struct equal_functor_ : DataVec::template visitor_base<Ts ...>  {
 
@@ -661,6 +701,19 @@ struct columns_info_functor_ : DataVec::template visitor_base<Ts ...>  {
 
 // ----------------------------------------------------------------------------
 
+template<typename ... Ts>
+struct col_bytes_functor_ : DataVec::template visitor_base<Ts ...>  {
+
+    inline col_bytes_functor_ (size_type &b) : bytes(b)  {   }
+
+    size_type   &bytes;
+
+    template<typename T>
+    void operator() (const T &vec);
+};
+
+// ----------------------------------------------------------------------------
+
 template<typename ... Ts>
 struct copy_remove_functor_ : DataVec::template visitor_base<Ts ...>  {
 
@@ -208,7 +208,26 @@ DataFrame<I, H>::get_index() const  { return (indices_); }
 
 template<typename I, typename H>
 typename DataFrame<I, H>::IndexVecType &
-DataFrame<I, H>::get_index()  { return (indices_); }
+DataFrame<I, H>::get_index()  {
+
+    index_changed_();
+    return (indices_);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+bool DataFrame<I, H>::is_index_sorted() const  {
+
+    IdxOrder    order = idx_order_.load(std::memory_order_relaxed);
+
+    if (order == IdxOrder::unknown)  {
+        order = std::ranges::is_sorted(indices_)
+                    ? IdxOrder::sorted : IdxOrder::not_sorted;
+        idx_order_.store(order, std::memory_order_relaxed);
+    }
+    return (order == IdxOrder::sorted);
+}
 
 // ----------------------------------------------------------------------------
 
@@ -342,6 +361,10 @@ template<typename ... Ts>
 DataFrame<I, H>
 DataFrame<I, H>::get_data_by_idx (Index2D<IndexType> range) const  {
 
+    if (! is_index_sorted())
+        return (data_by_sel_common_<Ts ...>(idx_range_rows_(range),
+                                            indices_.size()));
+
     const auto  &lower =
         std::lower_bound (indices_.begin(), indices_.end(), range.begin);
     const auto  &upper =
@@ -364,8 +387,8 @@ DataFrame<I, H>::get_data_by_idx (Index2D<IndexType> range) const  {
         }
 
         const auto  thread_level =
-            (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-                ? 0L : get_thread_level();
+            get_thread_level(e_dist - b_dist, COPY_WORK,
+                             1, row_bytes_<Ts ...>());
 
         if (thread_level > 2)  {
             auto    lbd =
@@ -380,7 +403,8 @@ DataFrame<I, H>::get_data_by_idx (Index2D<IndexType> range) const  {
                 };
 
             auto    futuers =
-                thr_pool_.parallel_loop(column_list_.begin(),
+                thr_pool_.parallel_loop(thread_level,
+                                        column_list_.begin(),
                                         column_list_.end(),
                                         std::move(lbd));
 
@@ -437,7 +461,8 @@ get_data_by_idx(const StlVecType<IndexType> &values) const  {
     }
 
     const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level(locations.size(), GATHER_WORK,
+                         1, row_bytes_<Ts ...>());
 
     if (thread_level > 2)  {
         auto    lbd =
@@ -455,7 +480,8 @@ get_data_by_idx(const StlVecType<IndexType> &values) const  {
             };
 
         auto    futuers =
-            thr_pool_.parallel_loop(column_list_.begin(),
+            thr_pool_.parallel_loop(thread_level,
+                                    column_list_.begin(),
                                     column_list_.end(),
                                     std::move(lbd));
 
@@ -486,6 +512,10 @@ DataFrame<I, H>::get_view_by_idx (Index2D<IndexType> range)  {
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_idx()");
 
+    if (! is_index_sorted())
+        throw NotFeasible("get_view_by_idx(): ERROR: A view by index range "
+                          "needs the index to be sorted");
+
     const auto  lower =
         std::lower_bound (indices_.begin(), indices_.end(), range.begin);
     const auto  upper =
@@ -529,6 +559,10 @@ DataFrame<I, H>::get_view_by_idx (Index2D<IndexType> range) const  {
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_idx()");
 
+    if (! is_index_sorted())
+        throw NotFeasible("get_view_by_idx(): ERROR: A view by index range "
+                          "needs the index to be sorted");
+
     const auto  lower =
         std::lower_bound (indices_.begin(), indices_.end(), range.begin);
     const auto  upper =
@@ -684,8 +718,8 @@ DataFrame<I, H>::get_data_by_loc (Index2D<long> range) const  {
         }
 
         const auto  thread_level =
-            (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-                ? 0L : get_thread_level();
+            get_thread_level(df.get_index().size(), COPY_WORK,
+                             1, row_bytes_<Ts ...>());
 
         if (thread_level > 2)  {
             auto    lbd =
@@ -703,7 +737,8 @@ DataFrame<I, H>::get_data_by_loc (Index2D<long> range) const  {
                 };
 
             auto    futuers =
-                thr_pool_.parallel_loop(column_list_.begin(),
+                thr_pool_.parallel_loop(thread_level,
+                                        column_list_.begin(),
                                         column_list_.end(),
                                         std::move(lbd));
 
@@ -762,7 +797,8 @@ get_data_by_loc (const StlVecType<long> &locations) const  {
     }
 
     const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level(locations.size(), GATHER_WORK,
+                         1, row_bytes_<Ts ...>());
 
     if (thread_level > 2)  {
         auto    lbd =
@@ -780,7 +816,8 @@ get_data_by_loc (const StlVecType<long> &locations) const  {
             };
 
         auto    futuers =
-            thr_pool_.parallel_loop(column_list_.begin(),
+            thr_pool_.parallel_loop(thread_level,
+                                    column_list_.begin(),
                                     column_list_.end(),
                                     std::move(lbd));
 
@@ -986,17 +1023,13 @@ get_view_by_loc (const StlVecType<long> &locations) const  {
 template<typename I, typename H>
 template<typename T, typename F, typename ... Ts>
 DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-get_data_by_sel (const char *name, F &sel_functor) const  {
+get_data_by_sel (const char *name, F &sel_functor,
+                 bool parallel) const  {
 
     const ColumnVecType<T>  &vec = get_column<T>(name);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s = vec.size();
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < col_s; ++i)
-        if (sel_functor (indices_[i], vec[i]))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, vec.size(), vec);
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1006,20 +1039,16 @@ get_data_by_sel (const char *name, F &sel_functor) const  {
 template<typename I, typename H>
 template<typename T, typename F, typename ... Ts>
 typename DataFrame<I, H>::PtrView DataFrame<I, H>::
-get_view_by_sel (const char *name, F &sel_functor)  {
+get_view_by_sel (const char *name, F &sel_functor,
+                 bool parallel)  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
 
     const ColumnVecType<T>  &vec = get_column<T>(name);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s = vec.size();
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]
-        if (sel_functor (indices_[i], vec[i])) [[unlikely]]
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, vec.size(), vec);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1029,20 +1058,16 @@ get_view_by_sel (const char *name, F &sel_functor)  {
 template<typename I, typename H>
 template<typename T, typename F, typename ... Ts>
 typename DataFrame<I, H>::ConstPtrView DataFrame<I, H>::
-get_view_by_sel (const char *name, F &sel_functor) const  {
+get_view_by_sel (const char *name, F &sel_functor,
+                 bool parallel) const  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
 
     const ColumnVecType<T>  &vec = get_column<T>(name);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s = vec.size();
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]
-        if (sel_functor (indices_[i], vec[i])) [[unlikely]]
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, vec.size(), vec);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1052,26 +1077,15 @@ get_view_by_sel (const char *name, F &sel_functor) const  {
 template<typename I, typename H>
 template<typename T1, typename T2, typename F, typename ... Ts>
 DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-get_data_by_sel (const char *name1, const char *name2, F &sel_functor) const  {
+get_data_by_sel (const char *name1, const char *name2, F &sel_functor,
+                 bool parallel) const  {
 
     const size_type         idx_s = indices_.size();
     const SpinGuard         guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         min_col_s = std::min(col_s1, col_s2);
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor (indices_[i],
-                         i < col_s1 ? vec1[i] : get_nan<T1>(),
-                         i < col_s2 ? vec2[i] : get_nan<T2>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2);
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1081,7 +1095,8 @@ get_data_by_sel (const char *name1, const char *name2, F &sel_functor) const  {
 template<typename I, typename H>
 template<typename T1, typename T2, typename F, typename ... Ts>
 typename DataFrame<I, H>::PtrView DataFrame<I, H>::
-get_view_by_sel (const char *name1, const char *name2, F &sel_functor)  {
+get_view_by_sel (const char *name1, const char *name2, F &sel_functor,
+                 bool parallel)  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
@@ -1090,20 +1105,8 @@ get_view_by_sel (const char *name1, const char *name2, F &sel_functor)  {
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         min_col_s = std::min(col_s1, col_s2);
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor (indices_[i],
-                         i < col_s1 ? vec1[i] : get_nan<T1>(),
-                         i < col_s2 ? vec2[i] : get_nan<T2>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1114,7 +1117,8 @@ template<typename I, typename H>
 template<typename T1, typename T2, typename F, typename ... Ts>
 typename DataFrame<I, H>::ConstPtrView
 DataFrame<I, H>::
-get_view_by_sel (const char *name1, const char *name2, F &sel_functor) const  {
+get_view_by_sel (const char *name1, const char *name2, F &sel_functor,
+                 bool parallel) const  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
@@ -1123,20 +1127,8 @@ get_view_by_sel (const char *name1, const char *name2, F &sel_functor) const  {
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         min_col_s = std::min(col_s1, col_s2);
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor (indices_[i],
-                         i < col_s1 ? vec1[i] : get_nan<T1>(),
-                         i < col_s2 ? vec2[i] : get_nan<T2>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1149,29 +1141,16 @@ DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
 get_data_by_sel (const char *name1,
                  const char *name2,
                  const char *name3,
-                 F &sel_functor) const  {
+                 F &sel_functor,
+                 bool parallel) const  {
 
     const size_type         idx_s = indices_.size();
     const SpinGuard         guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
     const ColumnVecType<T3> &vec3 = get_column<T3>(name3, false);
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         min_col_s = std::min({ col_s1, col_s2, col_s3 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor (indices_[i],
-                         i < col_s1 ? vec1[i] : get_nan<T1>(),
-                         i < col_s2 ? vec2[i] : get_nan<T2>(),
-                         i < col_s3 ? vec3[i] : get_nan<T3>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2, vec3);
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1181,7 +1160,7 @@ get_data_by_sel (const char *name1,
 template<typename I, typename H>
 template<typename Tuple, typename F, typename... FilterCols>
 DataFrame<I, H> DataFrame<I, H>::
-get_data_by_sel (F &sel_functor) const  {
+get_data_by_sel (F &sel_functor, bool parallel) const  {
 
     const size_type idx_s = indices_.size();
     // Get columns to std::tuple
@@ -1199,21 +1178,12 @@ get_data_by_sel (F &sel_functor) const  {
                cols_for_filter);
 
     // Get the index of all records that meet the filters
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < col_s; ++i)  {
-        std::apply(
-            [&](auto && ... col)  {
-                if (sel_functor(
-            indices_[i],
-            (i < col.size()
-                ? col[i]
-                : get_nan<typename std::decay<decltype(col)>::
-                      type::value_type>())...))  { col_indices.push_back(i); }
-            },
-            cols_for_filter);
-    }
+    const auto  col_indices =
+        std::apply([&](const auto & ... col)  {
+                       return (get_sel_indices_(sel_functor, parallel,
+                                                col_s, col ...));
+                   },
+                   cols_for_filter);
 
     // Get the records based on indices
     DataFrame       df;
@@ -1233,8 +1203,8 @@ get_data_by_sel (F &sel_functor) const  {
     }
 
     const auto  thread_level =
-        (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(col_indices.size(), GATHER_WORK,
+                         1, row_bytes_<Tuple>());
 
     if (thread_level > 2)  {
         auto    lbd =
@@ -1252,7 +1222,8 @@ get_data_by_sel (F &sel_functor) const  {
             };
 
         auto    futuers =
-            thr_pool_.parallel_loop(column_list_.begin(),
+            thr_pool_.parallel_loop(thread_level,
+                                    column_list_.begin(),
                                     column_list_.end(),
                                     std::move(lbd));
 
@@ -1280,6 +1251,20 @@ template<typename Tuple, typename F, typename... FilterCols>
 DataFrame<I, H> DataFrame<I, H>::
 get_data_by_sel (F &sel_functor, FilterCols && ... filter_cols) const  {
 
+    return (get_data_by_sel<Tuple>(sel_functor,
+                                   false,
+                                   std::forward<FilterCols>(filter_cols) ...));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename Tuple, typename F, typename... FilterCols>
+DataFrame<I, H> DataFrame<I, H>::
+get_data_by_sel (F &sel_functor,
+                 bool parallel,
+                 FilterCols && ... filter_cols) const  {
+
     const size_type idx_s = indices_.size();
     // Get columns to std::tuple
     std::tuple      cols_for_filter(
@@ -1296,21 +1281,12 @@ get_data_by_sel (F &sel_functor, FilterCols && ... filter_cols) const  {
                cols_for_filter);
 
     // Get the index of all records that meet the filters
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < col_s; ++i)  {
-        std::apply(
-            [&](auto&&... col) {
-                if (sel_functor(indices_[i],
-                                (i < col.size() ?
-                                 col[i] :
-                                 get_nan<typename std::decay<decltype(col)>
-                                 ::type::value_type>())...))
-                    col_indices.push_back(i);
-            },
-            cols_for_filter);
-    }
+    const auto  col_indices =
+        std::apply([&](const auto & ... col)  {
+                       return (get_sel_indices_(sel_functor, parallel,
+                                                col_s, col ...));
+                   },
+                   cols_for_filter);
 
     DataFrame       df;
     IndexVecType    new_index;
@@ -1330,8 +1306,8 @@ get_data_by_sel (F &sel_functor, FilterCols && ... filter_cols) const  {
     }
 
     const auto  thread_level =
-        (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(col_indices.size(), GATHER_WORK,
+                         1, row_bytes_<Tuple>());
 
     if (thread_level > 2)  {
         auto    lbd =
@@ -1349,7 +1325,8 @@ get_data_by_sel (F &sel_functor, FilterCols && ... filter_cols) const  {
             };
 
         auto    futuers =
-            thr_pool_.parallel_loop(column_list_.begin(),
+            thr_pool_.parallel_loop(thread_level,
+                                    column_list_.begin(),
                                     column_list_.end(),
                                     std::move(lbd));
 
@@ -1372,13 +1349,53 @@ get_data_by_sel (F &sel_functor, FilterCols && ... filter_cols) const  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename ... Ts, typename ... Ps>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
+get_data_by_pred (const ColumnPred<Ps> & ... preds) const  {
+
+    return (data_by_sel_common_<Ts ...>(get_pred_rows_(preds ...),
+                                        indices_.size()));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts, typename ... Ps>
+typename DataFrame<I, H>::PtrView DataFrame<I, H>::
+get_view_by_pred (const ColumnPred<Ps> & ... preds)  {
+
+    static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
+                  "Only a StdDataFrame can call get_view_by_pred()");
+
+    return (view_by_sel_common_<Ts ...>(get_pred_rows_(preds ...),
+                                        indices_.size()));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts, typename ... Ps>
+typename DataFrame<I, H>::ConstPtrView DataFrame<I, H>::
+get_view_by_pred (const ColumnPred<Ps> & ... preds) const  {
+
+    static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
+                  "Only a StdDataFrame can call get_view_by_pred()");
+
+    return (view_by_sel_common_<Ts ...>(get_pred_rows_(preds ...),
+                                        indices_.size()));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T1, typename T2, typename T3, typename F, typename ... Ts>
 typename DataFrame<I, H>::PtrView DataFrame<I, H>::
 get_view_by_sel (const char *name1,
                  const char *name2,
                  const char *name3,
-                 F &sel_functor)  {
+                 F &sel_functor,
+                 bool parallel)  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
@@ -1388,22 +1405,8 @@ get_view_by_sel (const char *name1,
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
     const ColumnVecType<T3> &vec3 = get_column<T3>(name3, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         min_col_s = std::min({ col_s1, col_s2, col_s3 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor (indices_[i],
-                         i < col_s1 ? vec1[i] : get_nan<T1>(),
-                         i < col_s2 ? vec2[i] : get_nan<T2>(),
-                         i < col_s3 ? vec3[i] : get_nan<T3>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2, vec3);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1417,7 +1420,8 @@ DataFrame<I, H>::
 get_view_by_sel (const char *name1,
                  const char *name2,
                  const char *name3,
-                 F &sel_functor) const  {
+                 F &sel_functor,
+                 bool parallel) const  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
@@ -1427,22 +1431,8 @@ get_view_by_sel (const char *name1,
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
     const ColumnVecType<T3> &vec3 = get_column<T3>(name3, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         min_col_s = std::min({ col_s1, col_s2, col_s3 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor (indices_[i],
-                         i < col_s1 ? vec1[i] : get_nan<T1>(),
-                         i < col_s2 ? vec2[i] : get_nan<T2>(),
-                         i < col_s3 ? vec3[i] : get_nan<T3>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2, vec3);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1457,7 +1447,8 @@ get_data_by_sel(const char *name1,
                 const char *name2,
                 const char *name3,
                 const char *name4,
-                F &sel_functor) const  {
+                F &sel_functor,
+                bool parallel) const  {
 
     const SpinGuard         guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
@@ -1465,26 +1456,8 @@ get_data_by_sel(const char *name1,
     const ColumnVecType<T3> &vec3 = get_column<T3>(name3, false);
     const ColumnVecType<T4> &vec4 = get_column<T4>(name4, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         col_s4 = vec4.size();
-    const size_type         min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2, vec3, vec4);
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1499,7 +1472,8 @@ get_view_by_sel(const char *name1,
                 const char *name2,
                 const char *name3,
                 const char *name4,
-                F &sel_functor)  {
+                F &sel_functor,
+                bool parallel)  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
@@ -1510,26 +1484,8 @@ get_view_by_sel(const char *name1,
     const ColumnVecType<T3> &vec3 = get_column<T3>(name3, false);
     const ColumnVecType<T4> &vec4 = get_column<T4>(name4, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         col_s4 = vec4.size();
-    const size_type         min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2, vec3, vec4);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1545,7 +1501,8 @@ get_view_by_sel(const char *name1,
                 const char *name2,
                 const char *name3,
                 const char *name4,
-                F &sel_functor) const  {
+                F &sel_functor,
+                bool parallel) const  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
@@ -1556,26 +1513,8 @@ get_view_by_sel(const char *name1,
     const ColumnVecType<T3> &vec3 = get_column<T3>(name3, false);
     const ColumnVecType<T4> &vec4 = get_column<T4>(name4, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         col_s4 = vec4.size();
-    const size_type         min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2, vec3, vec4);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1591,7 +1530,8 @@ get_data_by_sel(const char *name1,
                 const char *name3,
                 const char *name4,
                 const char *name5,
-                F &sel_functor) const  {
+                F &sel_functor,
+                bool parallel) const  {
 
     const SpinGuard         guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
@@ -1600,29 +1540,9 @@ get_data_by_sel(const char *name1,
     const ColumnVecType<T4> &vec4 = get_column<T4>(name4, false);
     const ColumnVecType<T5> &vec5 = get_column<T5>(name5, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         col_s4 = vec4.size();
-    const size_type         col_s5 = vec5.size();
-    const size_type         min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4, col_s5 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i],
-                        vec4[i], vec5[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>(),
-                        i < col_s5 ? vec5[i] : get_nan<T5>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel,
+                         idx_s, vec1, vec2, vec3, vec4, vec5);
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1646,7 +1566,8 @@ get_data_by_sel(const char *name1,
                 const char *name9,
                 const char *name10,
                 const char *name11,
-                F &sel_functor) const  {
+                F &sel_functor,
+                bool parallel) const  {
 
     const SpinGuard          guard (lock_);
     const ColumnVecType<T1>  &vec1 = get_column<T1>(name1, false);
@@ -1661,44 +1582,10 @@ get_data_by_sel(const char *name1,
     const ColumnVecType<T10> &vec10 = get_column<T10>(name10, false);
     const ColumnVecType<T11> &vec11 = get_column<T11>(name11, false);
     const size_type          idx_s = indices_.size();
-    const size_type          col_s1 = vec1.size();
-    const size_type          col_s2 = vec2.size();
-    const size_type          col_s3 = vec3.size();
-    const size_type          col_s4 = vec4.size();
-    const size_type          col_s5 = vec5.size();
-    const size_type          col_s6 = vec6.size();
-    const size_type          col_s7 = vec7.size();
-    const size_type          col_s8 = vec8.size();
-    const size_type          col_s9 = vec9.size();
-    const size_type          col_s10 = vec10.size();
-    const size_type          col_s11 = vec11.size();
-    const size_type          min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4, col_s5,
-                   col_s6, col_s7, col_s8, col_s9, col_s10,
-                   col_s11 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i],
-                        vec6[i], vec7[i], vec8[i], vec9[i], vec10[i],
-                        vec11[i])) [[unlikely]]
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>(),
-                        i < col_s5 ? vec5[i] : get_nan<T5>(),
-                        i < col_s6 ? vec6[i] : get_nan<T6>(),
-                        i < col_s7 ? vec7[i] : get_nan<T7>(),
-                        i < col_s8 ? vec8[i] : get_nan<T8>(),
-                        i < col_s9 ? vec9[i] : get_nan<T9>(),
-                        i < col_s10 ? vec10[i] : get_nan<T10>(),
-                        i < col_s11 ? vec11[i] : get_nan<T11>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s,
+                         vec1, vec2, vec3, vec4, vec5, vec6, vec7, vec8, vec9,
+                         vec10, vec11);
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1723,7 +1610,8 @@ get_data_by_sel(const char *name1,
                 const char *name10,
                 const char *name11,
                 const char *name12,
-                F &sel_functor) const  {
+                F &sel_functor,
+                bool parallel) const  {
 
     const SpinGuard          guard (lock_);
     const ColumnVecType<T1>  &vec1 = get_column<T1>(name1, false);
@@ -1739,46 +1627,10 @@ get_data_by_sel(const char *name1,
     const ColumnVecType<T11> &vec11 = get_column<T11>(name11, false);
     const ColumnVecType<T12> &vec12 = get_column<T12>(name12, false);
     const size_type          idx_s = indices_.size();
-    const size_type          col_s1 = vec1.size();
-    const size_type          col_s2 = vec2.size();
-    const size_type          col_s3 = vec3.size();
-    const size_type          col_s4 = vec4.size();
-    const size_type          col_s5 = vec5.size();
-    const size_type          col_s6 = vec6.size();
-    const size_type          col_s7 = vec7.size();
-    const size_type          col_s8 = vec8.size();
-    const size_type          col_s9 = vec9.size();
-    const size_type          col_s10 = vec10.size();
-    const size_type          col_s11 = vec11.size();
-    const size_type          col_s12 = vec12.size();
-    const size_type          min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4, col_s5,
-                   col_s6, col_s7, col_s8, col_s9, col_s10,
-                   col_s11, col_s12 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i],
-                        vec6[i], vec7[i], vec8[i], vec9[i], vec10[i],
-                        vec11[i], vec12[i]))
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i)
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>(),
-                        i < col_s5 ? vec5[i] : get_nan<T5>(),
-                        i < col_s6 ? vec6[i] : get_nan<T6>(),
-                        i < col_s7 ? vec7[i] : get_nan<T7>(),
-                        i < col_s8 ? vec8[i] : get_nan<T8>(),
-                        i < col_s9 ? vec9[i] : get_nan<T9>(),
-                        i < col_s10 ? vec10[i] : get_nan<T10>(),
-                        i < col_s11 ? vec11[i] : get_nan<T11>(),
-                        i < col_s12 ? vec12[i] : get_nan<T12>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s,
+                         vec1, vec2, vec3, vec4, vec5, vec6, vec7, vec8, vec9,
+                         vec10, vec11, vec12);
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1804,7 +1656,8 @@ get_data_by_sel(const char *name1,
                 const char *name11,
                 const char *name12,
                 const char *name13,
-                F &sel_functor) const  {
+                F &sel_functor,
+                bool parallel) const  {
 
     const SpinGuard          guard (lock_);
     const ColumnVecType<T1>  &vec1 = get_column<T1>(name1, false);
@@ -1821,48 +1674,10 @@ get_data_by_sel(const char *name1,
     const ColumnVecType<T12> &vec12 = get_column<T12>(name12, false);
     const ColumnVecType<T13> &vec13 = get_column<T13>(name13, false);
     const size_type          idx_s = indices_.size();
-    const size_type          col_s1 = vec1.size();
-    const size_type          col_s2 = vec2.size();
-    const size_type          col_s3 = vec3.size();
-    const size_type          col_s4 = vec4.size();
-    const size_type          col_s5 = vec5.size();
-    const size_type          col_s6 = vec6.size();
-    const size_type          col_s7 = vec7.size();
-    const size_type          col_s8 = vec8.size();
-    const size_type          col_s9 = vec9.size();
-    const size_type          col_s10 = vec10.size();
-    const size_type          col_s11 = vec11.size();
-    const size_type          col_s12 = vec12.size();
-    const size_type          col_s13 = vec13.size();
-    const size_type          min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4, col_s5,
-                   col_s6, col_s7, col_s8, col_s9, col_s10,
-                   col_s11, col_s12, col_s13 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i],
-                        vec6[i], vec7[i], vec8[i], vec9[i], vec10[i],
-                        vec11[i], vec12[i], vec13[i]))
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i)
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>(),
-                        i < col_s5 ? vec5[i] : get_nan<T5>(),
-                        i < col_s6 ? vec6[i] : get_nan<T6>(),
-                        i < col_s7 ? vec7[i] : get_nan<T7>(),
-                        i < col_s8 ? vec8[i] : get_nan<T8>(),
-                        i < col_s9 ? vec9[i] : get_nan<T9>(),
-                        i < col_s10 ? vec10[i] : get_nan<T10>(),
-                        i < col_s11 ? vec11[i] : get_nan<T11>(),
-                        i < col_s12 ? vec12[i] : get_nan<T12>(),
-                        i < col_s13 ? vec13[i] : get_nan<T13>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s,
+                         vec1, vec2, vec3, vec4, vec5, vec6, vec7, vec8, vec9,
+                         vec10, vec11, vec12, vec13);
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1878,7 +1693,8 @@ get_view_by_sel(const char *name1,
                 const char *name3,
                 const char *name4,
                 const char *name5,
-                F &sel_functor)  {
+                F &sel_functor,
+                bool parallel)  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
@@ -1890,28 +1706,9 @@ get_view_by_sel(const char *name1,
     const ColumnVecType<T4> &vec4 = get_column<T4>(name4, false);
     const ColumnVecType<T5> &vec5 = get_column<T5>(name5, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         col_s4 = vec4.size();
-    const size_type         col_s5 = vec5.size();
-    const size_type         min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4, col_s5 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i]))
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i)
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>(),
-                        i < col_s5 ? vec5[i] : get_nan<T5>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel,
+                         idx_s, vec1, vec2, vec3, vec4, vec5);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -1928,7 +1725,8 @@ get_view_by_sel(const char *name1,
                 const char *name3,
                 const char *name4,
                 const char *name5,
-                F &sel_functor) const  {
+                F &sel_functor,
+                bool parallel) const  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call get_view_by_sel()");
@@ -1940,28 +1738,9 @@ get_view_by_sel(const char *name1,
     const ColumnVecType<T4> &vec4 = get_column<T4>(name4, false);
     const ColumnVecType<T5> &vec5 = get_column<T5>(name5, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         col_s4 = vec4.size();
-    const size_type         col_s5 = vec5.size();
-    const size_type         min_col_s =
-        std::min({ col_s1, col_s2, col_s3, col_s4, col_s5 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i]))
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i)
-        if (sel_functor(indices_[i],
-                        i < col_s1 ? vec1[i] : get_nan<T1>(),
-                        i < col_s2 ? vec2[i] : get_nan<T2>(),
-                        i < col_s3 ? vec3[i] : get_nan<T3>(),
-                        i < col_s4 ? vec4[i] : get_nan<T4>(),
-                        i < col_s5 ? vec5[i] : get_nan<T5>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel,
+                         idx_s, vec1, vec2, vec3, vec4, vec5);
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -2289,8 +2068,8 @@ get_data_by_rand(random_policy spec, double n, seed_t seed) const  {
         }
 
         const auto  thread_level =
-            (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-                ? 0L : get_thread_level();
+            get_thread_level(df.get_index().size(), GATHER_WORK,
+                             1, row_bytes_<Ts ...>());
 
         if (thread_level > 2)  {
             auto    lbd =
@@ -2307,7 +2086,8 @@ get_data_by_rand(random_policy spec, double n, seed_t seed) const  {
                 };
 
             auto    futuers =
-                thr_pool_.parallel_loop(column_list_.begin(),
+                thr_pool_.parallel_loop(thread_level,
+                                        column_list_.begin(),
                                         column_list_.end(),
                                         std::move(lbd));
 
@@ -2637,7 +2417,8 @@ get_reindexed(const char *col_to_be_index, const char *old_index_name) const  {
     }
 
     const auto  thread_level =
-        (new_idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level(new_idx_s, COPY_WORK,
+                         1, row_bytes_<Ts ...>(col_to_be_index));
 
     if (thread_level > 2)  {
         auto    lbd =
@@ -2659,7 +2440,8 @@ get_reindexed(const char *col_to_be_index, const char *old_index_name) const  {
             };
 
         auto    futuers =
-            thr_pool_.parallel_loop(column_list_.begin(),
+            thr_pool_.parallel_loop(thread_level,
+                                    column_list_.begin(),
                                     column_list_.end(),
                                     std::move(lbd));
 
@@ -3021,7 +2803,8 @@ DataFrame<I, H>::inversion_count(const char *col_name) const  {
     StlVecType<T>   temp(col_s);
 
     return (_inv_merge_sort_(original, temp, 0, col_s - 1, C { },
-                             get_thread_level()));
+                             get_thread_level(col_s, SORT_WORK,
+                                              1, sizeof(T))));
 }
 
 } // namespace hmdf
@@ -29,8 +29,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <DataFrame/DataFrame.h>
 
+#include <algorithm>
 #include <cstdio>
+#include <numeric>
 #include <ranges>
+#include <unordered_map>
 
 // ----------------------------------------------------------------------------
 
@@ -41,94 +44,291 @@ template<typename I, typename H>
 template<typename RHS_T, typename ... Ts>
 DataFrame<I, H>
 DataFrame<I, H>::
-join_by_index (const RHS_T &rhs, join_policy mp) const  {
+join_by_index (const RHS_T &rhs,
+               join_policy mp,
+               sort_state already_sorted) const  {
 
     static_assert(comparable<I>, "Index type must have comparison operators");
 
-    using pair_vec_t = StlVecType<JoinSortingPair<IndexType>>;
-    using pair_vec_iter =
-        typename StlVecType<JoinSortingPair<IndexType>>::iterator;
+    const bool  presorted = already_sorted == sort_state::sorted;
+
+    return (index_join_helper_<DataFrame, RHS_T, Ts ...>
+                (*this, rhs,
+                 get_joined_index_idx_(get_index(), rhs.get_index(), mp,
+                                       presorted || is_index_sorted(),
+                                       presorted || rhs.is_index_sorted())));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, comparable T, typename ... Ts>
+DataFrame<unsigned int, H>
+DataFrame<I, H>::
+join_by_column (const RHS_T &rhs,
+                const char *name,
+                join_policy mp,
+                sort_state already_sorted) const  {
+
+    const auto  &lhs_vec = get_column<T>(name);
+    const auto  &rhs_vec = rhs.template get_column<T>(name);
+    const bool  presorted = already_sorted == sort_state::sorted;
+    const bool  lhs_sorted = presorted || std::ranges::is_sorted(lhs_vec);
+    const bool  rhs_sorted = presorted || std::ranges::is_sorted(rhs_vec);
+
+    return (column_join_helper_<DataFrame, RHS_T, T, Ts ...>
+                (*this, rhs, name,
+                 get_joined_index_idx_(lhs_vec, rhs_vec, mp,
+                                       lhs_sorted, rhs_sorted)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename ... Ts>
+DataFrame<I, H>
+DataFrame<I, H>::
+join_asof(const RHS_T &rhs,
+          asof_policy ap,
+          std::optional<double> tolerance) const  {
+
+    static_assert(comparable<I>, "Index type must have comparison operators");
 
     const auto      &lhs_idx = get_index();
     const auto      &rhs_idx = rhs.get_index();
-    const size_type lhs_idx_s = lhs_idx.size();
-    const size_type rhs_idx_s = rhs_idx.size();
-    pair_vec_t      idx_vec_lhs;
-    pair_vec_t      idx_vec_rhs;
-
-    idx_vec_lhs.reserve(lhs_idx_s);
-    for (size_type i = 0; i < lhs_idx_s; ++i) [[likely]]
-        idx_vec_lhs.push_back(std::make_pair(&(lhs_idx[i]), i));
-    idx_vec_rhs.reserve(rhs_idx_s);
-    for (size_type i = 0; i < rhs_idx_s; ++i) [[likely]]
-        idx_vec_rhs.push_back(std::make_pair(&(rhs_idx[i]), i));
+    const size_type lhs_s = lhs_idx.size();
+    IndexIdxVector  joined_index_idx(lhs_s);
+
+    if (! is_index_sorted() || ! rhs.is_index_sorted())
+        throw NotFeasible("join_asof(): Both indices must be sorted");
+
+    asof_match_(lhs_idx, rhs_idx,
+                lhs_s, std::identity { },
+                rhs_idx.size(), std::identity { },
+                ap, tolerance, joined_index_idx);
+    return (index_join_helper_<DataFrame, RHS_T, Ts ...>
+                (*this, rhs, joined_index_idx));
+}
 
-    auto        cf = [] (const JoinSortingPair<IndexType> &l,
-                         const JoinSortingPair<IndexType> &r) -> bool  {
-                         return (*(l.first) < *(r.first));
-                     };
-    const auto  thread_level =
-        (lhs_idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+// ----------------------------------------------------------------------------
 
-    if (thread_level > 3)  {
-        std::future<void>   futures[2];
+template<typename I, typename H>
+template<typename RHS_T, comparable T, typename ... Ts>
+DataFrame<I, H>
+DataFrame<I, H>::
+join_asof(const RHS_T &rhs,
+          const char *by_name,
+          asof_policy ap,
+          std::optional<double> tolerance) const  {
 
-        futures[0] = thr_pool_.dispatch(
-            false,
-            &ThreadPool::parallel_sort<pair_vec_iter, decltype(cf)>,
-                &thr_pool_,
-                idx_vec_lhs.begin(),
-                idx_vec_lhs.end(),
-                std::move(cf));
-        futures[1] = thr_pool_.dispatch(
-            false,
-            &ThreadPool::parallel_sort<pair_vec_iter, decltype(cf)>,
-                &thr_pool_,
-                idx_vec_rhs.begin(),
-                idx_vec_rhs.end(),
-                std::move(cf));
-        futures[0].get();
-        futures[1].get();
+    static_assert(comparable<I>, "Index type must have comparison operators");
+
+    using map_t = std::conditional_t<hashable<T>,
+                                     std::unordered_map<T, size_type>,
+                                     std::map<T, size_type>>;
+
+    constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+    const auto      &lhs_idx = get_index();
+    const auto      &rhs_idx = rhs.get_index();
+    const auto      &lhs_by = get_column<T>(by_name);
+    const auto      &rhs_by = rhs.template get_column<T>(by_name);
+    const size_type lhs_s = std::min(lhs_idx.size(), lhs_by.size());
+    const size_type rhs_s = std::min(rhs_idx.size(), rhs_by.size());
+    IndexIdxVector  joined_index_idx(lhs_idx.size());
+
+    if (! is_index_sorted() || ! rhs.is_index_sorted())
+        throw NotFeasible("join_asof(): Both indices must be sorted");
+
+    // Rows of each by-key, in index order. Only rhs keys make groups.
+    //
+    map_t                   key_grps;
+    StlVecType<size_type>   lhs_grps(lhs_s);
+    StlVecType<size_type>   rhs_grps(rhs_s);
+
+    for (size_type i = 0; i < rhs_s; ++i) [[likely]]
+        rhs_grps[i] =
+            key_grps.try_emplace(rhs_by[i], key_grps.size()).first->second;
+    for (size_type i = 0; i < lhs_s; ++i) [[likely]]  {
+        const auto  iter = key_grps.find(lhs_by[i]);
+
+        lhs_grps[i] = iter != key_grps.end() ? iter->second : npos;
     }
-    else  {
-        std::ranges::sort(idx_vec_lhs, cf);
-        std::ranges::sort(idx_vec_rhs, cf);
+
+    const size_type grp_s = key_grps.size();
+    auto            bucket =
+        [grp_s](const StlVecType<size_type> &grps,
+                StlVecType<size_type> &rows,
+                StlVecType<size_type> &offs) -> void  {
+            offs.assign(grp_s + 1, 0);
+            for (const auto grp : grps)
+                if (grp != npos)  offs[grp + 1] += 1;
+            std::partial_sum(offs.begin(), offs.end(), offs.begin());
+            rows.resize(offs.back());
+
+            StlVecType<size_type>   cursors = offs;
+
+            for (size_type i = 0; i < grps.size(); ++i) [[likely]]
+                if (grps[i] != npos)  rows[cursors[grps[i]]++] = i;
+        };
+
+    StlVecType<size_type>   lhs_rows;
+    StlVecType<size_type>   lhs_offs;
+    StlVecType<size_type>   rhs_rows;
+    StlVecType<size_type>   rhs_offs;
+
+    bucket(lhs_grps, lhs_rows, lhs_offs);
+    bucket(rhs_grps, rhs_rows, rhs_offs);
+
+    // lhs rows without a by-key in rhs, or past the end of the by column,
+    // don't match anything
+    //
+    for (size_type i = 0; i < joined_index_idx.size(); ++i) [[likely]]
+        joined_index_idx[i] = { i, npos };
+    for (size_type g = 0; g < grp_s; ++g) [[likely]]  {
+        const size_type *lhs_g = lhs_rows.data() + lhs_offs[g];
+        const size_type *rhs_g = rhs_rows.data() + rhs_offs[g];
+
+        asof_match_(lhs_idx, rhs_idx,
+                    lhs_offs[g + 1] - lhs_offs[g],
+                    [lhs_g](size_type k) -> size_type { return (lhs_g[k]); },
+                    rhs_offs[g + 1] - rhs_offs[g],
+                    [rhs_g](size_type k) -> size_type { return (rhs_g[k]); },
+                    ap, tolerance, joined_index_idx);
     }
+    return (index_join_helper_<DataFrame, RHS_T, Ts ...>
+                (*this, rhs, joined_index_idx));
+}
 
-    switch(mp)  {
-        case join_policy::inner_join:
-            return (index_inner_join_<DataFrame, RHS_T, Ts ...>
-                        (*this, rhs, idx_vec_lhs, idx_vec_rhs));
-        case join_policy::left_join:
-            return (index_left_join_<DataFrame, RHS_T, Ts ...>
-                        (*this, rhs, idx_vec_lhs, idx_vec_rhs));
-        case join_policy::right_join:
-            return (index_right_join_<DataFrame, RHS_T, Ts ...>
-                        (*this, rhs, idx_vec_lhs, idx_vec_rhs));
-        case join_policy::left_right_join:
-        default:
-            return (index_left_right_join_<DataFrame, RHS_T, Ts ...>
-                        (*this, rhs, idx_vec_lhs, idx_vec_rhs));
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename LV, typename RV, typename LR, typename RR>
+void DataFrame<I, H>::
+asof_match_(const LV &lhs_idx,
+            const RV &rhs_idx,
+            size_type lhs_s,
+            LR &&lhs_row,
+            size_type rhs_s,
+            RR &&rhs_row,
+            asof_policy ap,
+            std::optional<double> tolerance,
+            IndexIdxVector &joined_index_idx)  {
+
+    constexpr size_type npos = std::numeric_limits<size_type>::max();
+    constexpr bool      has_dist =
+        requires (const IndexType &a)  {
+            { a - a } -> std::convertible_to<double>;
+        };
+
+    if constexpr (! has_dist)  {
+        if (tolerance || ap == asof_policy::nearest)
+            throw NotFeasible("join_asof(): Index type has no distance");
+    }
+
+    // Distance from lo to hi, where lo <= hi
+    //
+    const auto  dist =
+        [](const IndexType &lo, const IndexType &hi) -> double  {
+            if constexpr (has_dist)  return (double(hi - lo));
+            else  return (0.0);
+        };
+
+    // Both cursors only move forward. le_end is the number of rhs rows with
+    // index <= the lhs index, lt_end is the number of rhs rows with index <
+    // the lhs index.
+    //
+    size_type   le_end = 0;
+    size_type   lt_end = 0;
+
+    for (size_type k = 0; k < lhs_s; ++k) [[likely]]  {
+        const size_type l = lhs_row(k);
+        const auto      &lhs_val = lhs_idx[l];
+
+        while (lt_end < rhs_s && rhs_idx[rhs_row(lt_end)] < lhs_val)
+            lt_end += 1;
+        if (le_end < lt_end)  le_end = lt_end;
+        while (le_end < rhs_s && ! (lhs_val < rhs_idx[rhs_row(le_end)]))
+            le_end += 1;
+
+        const size_type back = le_end > 0 ? rhs_row(le_end - 1) : npos;
+        const size_type forw = lt_end < rhs_s ? rhs_row(lt_end) : npos;
+        size_type       match = npos;
+        double          match_dist = 0;
+
+        if (ap == asof_policy::backward)  {
+            match = back;
+            if (match != npos && tolerance)
+                match_dist = dist(rhs_idx[match], lhs_val);
+        }
+        else if (ap == asof_policy::forward)  {
+            match = forw;
+            if (match != npos && tolerance)
+                match_dist = dist(lhs_val, rhs_idx[match]);
+        }
+        else if (back == npos)  {
+            match = forw;
+            if (match != npos)  match_dist = dist(lhs_val, rhs_idx[match]);
+        }
+        else  {
+            match = back;
+            match_dist = dist(rhs_idx[back], lhs_val);
+            if (forw != npos)  {
+                const double    forw_dist = dist(lhs_val, rhs_idx[forw]);
+
+                if (forw_dist < match_dist)  {
+                    match = forw;
+                    match_dist = forw_dist;
+                }
+            }
+        }
+        if (tolerance && match_dist > *tolerance)  match = npos;
+        joined_index_idx[l] = { l, match };
     }
 }
 
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename RHS_T, comparable T, typename ... Ts>
-DataFrame<unsigned int, H>
-DataFrame<I, H>::
-join_by_column (const RHS_T &rhs, const char *name, join_policy mp) const  {
+template<typename LV, typename RV>
+typename DataFrame<I, H>::IndexIdxVector
+DataFrame<I, H>::get_joined_index_idx_(const LV &lhs_vec,
+                                       const RV &rhs_vec,
+                                       join_policy mp,
+                                       bool lhs_sorted,
+                                       bool rhs_sorted)  {
 
+    using T = typename LV::value_type;
     using pair_vec_t = StlVecType<JoinSortingPair<T>>;
     using pair_vec_iter = typename StlVecType<JoinSortingPair<T>>::iterator;
 
-    const auto      &lhs_vec = get_column<T>(name);
-    const auto      &rhs_vec = rhs.template get_column<T>(name);
+    // A hash join is used, if one side is this many times smaller than
+    // the other
+    //
+    constexpr size_type hash_join_ratio = 8;
+
     const size_type lhs_vec_s = lhs_vec.size();
     const size_type rhs_vec_s = rhs_vec.size();
-    pair_vec_t      col_vec_lhs;
-    pair_vec_t      col_vec_rhs;
+
+    // If the big side is not sorted, hash the small side and probe the big
+    // side. This only works if the big side doesn't have to be in the result
+    // in full.
+    //
+    if constexpr (hashable<T>)  {
+        const bool  lhs_small =
+            ! rhs_sorted && lhs_vec_s * hash_join_ratio <= rhs_vec_s &&
+            (mp == join_policy::inner_join || mp == join_policy::left_join);
+        const bool  rhs_small =
+            ! lhs_sorted && rhs_vec_s * hash_join_ratio <= lhs_vec_s &&
+            (mp == join_policy::inner_join || mp == join_policy::right_join);
+
+        if (lhs_small || rhs_small)
+            return (get_hash_index_idx_vector_(lhs_vec, rhs_vec,
+                                               mp, lhs_small));
+    }
+
+    pair_vec_t  col_vec_lhs;
+    pair_vec_t  col_vec_rhs;
 
     col_vec_lhs.reserve(lhs_vec_s);
     for (size_type i = 0; i < lhs_vec_s; ++i) [[likely]]
@@ -137,14 +337,19 @@ join_by_column (const RHS_T &rhs, const char *name, join_policy mp) const  {
     for (size_type i = 0; i < rhs_vec_s; ++i) [[likely]]
         col_vec_rhs.push_back(std::make_pair(&(rhs_vec[i]), i));
 
+    // Only the side(s) that are not already sorted get sorted. If both are,
+    // it is a straight merge.
+    //
     auto        cf = [] (const JoinSortingPair<T> &l,
                          const JoinSortingPair<T> &r) -> bool  {
                          return (*(l.first) < *(r.first));
                      };
     const auto  thread_level =
-        (lhs_vec_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level((lhs_sorted ? 0 : lhs_vec_s) +
+                             (rhs_sorted ? 0 : rhs_vec_s),
+                         SORT_WORK, 1, sizeof(JoinSortingPair<T>));
 
-    if (thread_level > 3)  {
+    if (thread_level > 3 && ! lhs_sorted && ! rhs_sorted)  {
         std::future<void>   futures[2];
 
         futures[0] = thr_pool_.dispatch(
@@ -165,29 +370,164 @@ join_by_column (const RHS_T &rhs, const char *name, join_policy mp) const  {
         futures[1].get();
     }
     else  {
-        std::ranges::sort(col_vec_lhs, cf);
-        std::ranges::sort(col_vec_rhs, cf);
+        if (! lhs_sorted)  std::ranges::sort(col_vec_lhs, cf);
+        if (! rhs_sorted)  std::ranges::sort(col_vec_rhs, cf);
     }
 
     switch(mp)  {
         case join_policy::inner_join:
-            return (column_inner_join_<DataFrame, RHS_T, T, Ts ...>
-                        (*this, rhs, name, col_vec_lhs, col_vec_rhs));
+            return (get_inner_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs));
         case join_policy::left_join:
-            return (column_left_join_<DataFrame, RHS_T, T, Ts ...>
-                        (*this, rhs, name, col_vec_lhs, col_vec_rhs));
+            return (get_left_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs));
         case join_policy::right_join:
-            return (column_right_join_<DataFrame, RHS_T, T, Ts ...>
-                        (*this, rhs, name, col_vec_lhs, col_vec_rhs));
+            return (get_right_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs));
         case join_policy::left_right_join:
         default:
-            return (column_left_right_join_<DataFrame, RHS_T, T, Ts ...>
-                        (*this, rhs, name, col_vec_lhs, col_vec_rhs));
+            return (get_left_right_index_idx_vector_<T>(col_vec_lhs,
+                                                        col_vec_rhs));
     }
 }
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename LV, typename RV>
+typename DataFrame<I, H>::IndexIdxVector
+DataFrame<I, H>::get_hash_index_idx_vector_(const LV &lhs_vec,
+                                            const RV &rhs_vec,
+                                            join_policy mp,
+                                            bool lhs_is_small)  {
+
+    using T = typename LV::value_type;
+
+    constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+    std::unordered_map<T, size_type>    key_grps;  // Key -> group id
+    StlVecType<const T *>               grp_keys;
+    StlVecType<size_type>               lhs_grps(lhs_vec.size());
+    StlVecType<size_type>               rhs_grps(rhs_vec.size());
+    auto                                build =
+        [&key_grps, &grp_keys]
+        (const auto &vec, StlVecType<size_type> &grps) -> void  {
+            key_grps.reserve(vec.size());
+            for (size_type i = 0; i < vec.size(); ++i) [[likely]]  {
+                const auto  [iter, inserted] =
+                    key_grps.try_emplace(vec[i], grp_keys.size());
+
+                if (inserted)  grp_keys.push_back(&(iter->first));
+                grps[i] = iter->second;
+            }
+        };
+    auto                                probe =
+        [&key_grps = std::as_const(key_grps)]
+        (const auto &vec, StlVecType<size_type> &grps) -> void  {
+            for (size_type i = 0; i < vec.size(); ++i) [[likely]]  {
+                const auto  iter = key_grps.find(vec[i]);
+
+                grps[i] = iter != key_grps.end() ? iter->second : npos;
+            }
+        };
+
+    // Group the small side by hashing. The big side is only probed.
+    //
+    if (lhs_is_small)  {
+        build(lhs_vec, lhs_grps);
+        probe(rhs_vec, rhs_grps);
+    }
+    else  {
+        build(rhs_vec, rhs_grps);
+        probe(lhs_vec, lhs_grps);
+    }
+
+    // Only the unique keys of the small side are sorted, so the result comes
+    // out in key order, like a sort-merge join
+    //
+    const size_type         grp_s = grp_keys.size();
+    StlVecType<size_type>   ranks(grp_s);
+
+    {
+        StlVecType<size_type>   order(grp_s);
+
+        std::iota(order.begin(), order.end(), size_type(0));
+        std::ranges::sort(order,
+                          [&grp_keys](size_type i, size_type j) -> bool  {
+                              return (*(grp_keys[i]) < *(grp_keys[j]));
+                          });
+        for (size_type r = 0; r < grp_s; ++r)
+            ranks[order[r]] = r;
+    }
+
+    // Counting sort of each side's matching rows by key rank. Rows with
+    // the same key stay in their original order.
+    //
+    auto    bucket =
+        [&ranks = std::as_const(ranks), grp_s]
+        (const StlVecType<size_type> &grps,
+         StlVecType<size_type> &rows,
+         StlVecType<size_type> &offs) -> void  {
+            offs.assign(grp_s + 1, 0);
+            for (const auto grp : grps)
+                if (grp != npos)  offs[ranks[grp] + 1] += 1;
+            std::partial_sum(offs.begin(), offs.end(), offs.begin());
+            rows.resize(offs.back());
+
+            StlVecType<size_type>   cursors = offs;
+
+            for (size_type i = 0; i < grps.size(); ++i) [[likely]]
+                if (grps[i] != npos)
+                    rows[cursors[ranks[grps[i]]]++] = i;
+        };
+
+    StlVecType<size_type>   lhs_rows;
+    StlVecType<size_type>   lhs_offs;
+    StlVecType<size_type>   rhs_rows;
+    StlVecType<size_type>   rhs_offs;
+
+    bucket(lhs_grps, lhs_rows, lhs_offs);
+    bucket(rhs_grps, rhs_rows, rhs_offs);
+
+    // Rows with equal keys are paired the same way the sort-merge joins
+    // above pair them
+    //
+    IndexIdxVector  joined_index_idx;
+
+    joined_index_idx.reserve(std::max(lhs_rows.size(), rhs_rows.size()));
+    for (size_type g = 0; g < grp_s; ++g) [[likely]]  {
+        const size_type lhs_b = lhs_offs[g];
+        const size_type lhs_e = lhs_offs[g + 1];
+        const size_type rhs_b = rhs_offs[g];
+        const size_type rhs_e = rhs_offs[g + 1];
+
+        if (lhs_b == lhs_e || rhs_b == rhs_e)  {
+            if (mp == join_policy::left_join)  {
+                for (size_type l = lhs_b; l < lhs_e; ++l)
+                    joined_index_idx.emplace_back(lhs_rows[l], npos);
+            }
+            else if (mp == join_policy::right_join)  {
+                for (size_type r = rhs_b; r < rhs_e; ++r)
+                    joined_index_idx.emplace_back(npos, rhs_rows[r]);
+            }
+        }
+        else if (mp == join_policy::right_join)  {
+            for (size_type l = lhs_b; l < lhs_e; ++l)
+                joined_index_idx.emplace_back(lhs_rows[l], rhs_rows[rhs_b]);
+            for (size_type r = rhs_b + 1; r < rhs_e; ++r)
+                joined_index_idx.emplace_back(lhs_rows[lhs_e - 1],
+                                              rhs_rows[r]);
+        }
+        else  {
+            for (size_type r = rhs_b; r < rhs_e; ++r)
+                joined_index_idx.emplace_back(lhs_rows[lhs_b], rhs_rows[r]);
+            for (size_type l = lhs_b + 1; l < lhs_e; ++l)
+                joined_index_idx.emplace_back(lhs_rows[l],
+                                              rhs_rows[rhs_e - 1]);
+        }
+    }
+    return (joined_index_idx);
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename LHS_T, typename RHS_T, typename ... Ts>
 DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
@@ -217,9 +557,12 @@ index_join_helper_(const LHS_T &lhs,
         };
 
     // Load the index
-    if (len >= ThreadPool::MUL_THR_THHOLD && get_thread_level() > 2)  {
+    if (const auto thread_level =
+            get_thread_level(len, GATHER_WORK, 1, sizeof(IndexType));
+        thread_level > 2)  {
         auto    futures =
-            thr_pool_.parallel_loop(size_type(0), len, std::move(lbd));
+            thr_pool_.parallel_loop(thread_level,
+                                    size_type(0), len, std::move(lbd));
 
         for (auto &fut : futures)  fut.get();
     }
@@ -292,9 +635,14 @@ column_join_helper_(const LHS_T &lhs,
             }
         };
 
-    if (len >= ThreadPool::MUL_THR_THHOLD && get_thread_level() > 2)  {
+    if (const auto thread_level =
+            get_thread_level(len, GATHER_WORK, 1,
+                             sizeof(left_idx_t) + sizeof(right_idx_t) +
+                             sizeof(T));
+        thread_level > 2)  {
         auto    futures =
-            thr_pool_.parallel_loop(size_type(0), len, std::move(lbd));
+            thr_pool_.parallel_loop(thread_level,
+                                    size_type(0), len, std::move(lbd));
 
         for (auto &fut : futures)  fut.get();
     }
@@ -375,38 +723,6 @@ DataFrame<I, H>::get_inner_index_idx_vector_(
 
 // ----------------------------------------------------------------------------
 
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-index_inner_join_(const LHS_T &lhs,
-                  const RHS_T &rhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs) {
-
-    return (index_join_helper_<LHS_T, RHS_T, Ts ...>
-        (lhs, rhs,
-         get_inner_index_idx_vector_<IndexType>(col_vec_lhs, col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::
-column_inner_join_(const LHS_T &lhs,
-                   const RHS_T &rhs,
-                   const char *col_name,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
-
-    return (column_join_helper_<LHS_T, RHS_T, T, Ts ...>
-                (lhs, rhs, col_name,
-                 get_inner_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
 template<typename I, typename H>
 template<typename T>
 typename DataFrame<I, H>::IndexIdxVector
@@ -462,38 +778,6 @@ DataFrame<I, H>::get_left_index_idx_vector_(
 }
 // ----------------------------------------------------------------------------
 
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-index_left_join_(const LHS_T &lhs, const RHS_T &rhs,
-                 const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                 const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs) {
-
-    return (index_join_helper_<LHS_T, RHS_T, Ts ...>
-                (lhs, rhs,
-                 get_left_index_idx_vector_<IndexType>(col_vec_lhs,
-                                                       col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::
-column_left_join_(const LHS_T &lhs,
-                  const RHS_T &rhs,
-                  const char *col_name,
-                  const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
-
-    return (column_join_helper_<LHS_T, RHS_T, T, Ts ...>
-                (lhs, rhs, col_name,
-                 get_left_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
 template<typename I, typename H>
 template<typename T>
 typename DataFrame<I, H>::IndexIdxVector
@@ -553,38 +837,6 @@ DataFrame<I, H>::get_right_index_idx_vector_(
 
 // ----------------------------------------------------------------------------
 
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-index_right_join_(const LHS_T &lhs, const RHS_T &rhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs) {
-
-    return (index_join_helper_<LHS_T, RHS_T, Ts ...>
-                (lhs, rhs,
-                 get_right_index_idx_vector_<IndexType>(col_vec_lhs,
-                                                        col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::
-column_right_join_(const LHS_T &lhs,
-                   const RHS_T &rhs,
-                   const char *col_name,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
-
-    return (column_join_helper_<LHS_T, RHS_T, T, Ts ...>
-                (lhs, rhs, col_name,
-                 get_right_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
 template<typename I, typename H>
 template<typename T>
 typename DataFrame<I, H>::IndexIdxVector
@@ -648,41 +900,6 @@ DataFrame<I, H>::get_left_right_index_idx_vector_(
 
 // ----------------------------------------------------------------------------
 
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-index_left_right_join_(
-    const LHS_T &lhs,
-    const RHS_T &rhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs) {
-
-    return (index_join_helper_<LHS_T, RHS_T, Ts ...>
-                (lhs, rhs,
-                 get_left_right_index_idx_vector_<IndexType>(col_vec_lhs,
-                                                             col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::
-column_left_right_join_(const LHS_T &lhs,
-                        const RHS_T &rhs,
-                        const char *col_name,
-                        const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                        const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
-
-    return (column_join_helper_<LHS_T, RHS_T, T, Ts ...>
-                (lhs, rhs, col_name,
-                 get_left_right_index_idx_vector_<T>(col_vec_lhs,
-                                                     col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
 template<typename I, typename H>
 template<typename LHS_T, typename RHS_T, typename ... Ts>
 void DataFrame<I, H>::
@@ -285,6 +285,31 @@ print_csv2_data_functor_<S, Ts ...>::operator() (const T &vec)  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename ... Ts>
+template<typename T>
+void DataFrame<I, H>::
+csv2_col_writer_functor_<Ts ...>::operator() (const T &vec)  {
+
+    writer.vec = &vec;
+    writer.format = &DataFrame::template csv2_format_cells_<T, false>;
+    return;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename S, typename ... Ts>
+template<typename T>
+void DataFrame<I, H>::
+print_binary_functor_<S, Ts ...>::operator() (const T &vec)  {
+
+    _write_bin_col_(os, name, vec, start_row, end_row, alignment, pos, dir);
+    return;
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename ... Ts>
 template<typename T>
@@ -859,6 +884,20 @@ DataFrame<I, H>::columns_info_functor_<Ts ...>::operator() (const T &vec)  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename ... Ts>
+template<typename T>
+void
+DataFrame<I, H>::col_bytes_functor_<Ts ...>::operator() (const T &)  {
+
+    using VecType = typename std::remove_reference<T>::type;
+    using ValueType = typename VecType::value_type;
+
+    bytes += sizeof(ValueType);
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename ... Ts>
 template<typename T>
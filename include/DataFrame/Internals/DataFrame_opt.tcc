@@ -70,8 +70,10 @@ DataFrame<I, H> &DataFrame<I, H>::
 modify_by_idx (DataFrame &rhs, sort_state already_sorted)  {
 
     if (already_sorted == sort_state::not_sorted)  {
-        rhs.sort<IndexType, Ts ...>(DF_INDEX_COL_NAME, sort_spec::ascen);
-        sort<IndexType, Ts ...>(DF_INDEX_COL_NAME, sort_spec::ascen);
+        if (! rhs.is_index_sorted())
+            rhs.sort<IndexType, Ts ...>(DF_INDEX_COL_NAME, sort_spec::ascen);
+        if (! is_index_sorted())
+            sort<IndexType, Ts ...>(DF_INDEX_COL_NAME, sort_spec::ascen);
     }
 
     const size_type lhs_s { indices_.size() };
@@ -50,6 +50,102 @@ sc_binary_operation(const DF &lhs, const ST &rhs);
 
 // ----------------------------------------------------------------------------
 
+// These keep the cached sortedness of the index (idx_order_) current.
+// Erasing rows keeps a sorted index sorted. Appending to a sorted index only
+// needs the new tail checked.
+//
+inline void index_changed_()  {
+
+    idx_order_.store(IdxOrder::unknown, std::memory_order_relaxed);
+}
+
+inline void index_erased_()  {
+
+    if (idx_order_.load(std::memory_order_relaxed) != IdxOrder::sorted)
+        index_changed_();
+}
+
+inline void index_appended_(size_type old_s)  {
+
+    if (idx_order_.load(std::memory_order_relaxed) == IdxOrder::sorted)  {
+        const bool  sorted =
+            std::is_sorted(indices_.begin() + (old_s > 0 ? old_s - 1 : 0),
+                           indices_.end());
+
+        idx_order_.store(sorted ? IdxOrder::sorted : IdxOrder::not_sorted,
+                         std::memory_order_relaxed);
+    }
+}
+
+// These give the bytes of one row of the named columns, or of all the
+// columns but the named ones. They are the cell_bytes of
+// get_thread_level(), when an operation goes over several columns of
+// different types. Columns of types not in Ts are not counted.
+//
+template<typename ... Ts>
+size_type col_bytes_(const char *name) const  {
+
+    size_type                   bytes { 0 };
+    col_bytes_functor_<Ts ...>  functor (bytes);
+    const auto                  iter = column_tb_.find (name);
+
+    if (iter != column_tb_.end())  data_[iter->second].change(functor);
+    return (bytes);
+}
+
+template<typename ... Ts, typename ... Ns>
+size_type row_bytes_(const Ns & ... skip_names) const  {
+
+    size_type                   bytes { 0 };
+    col_bytes_functor_<Ts ...>  functor (bytes);
+
+    for (const auto &[name, idx] : column_list_) [[likely]]
+        if (((name != skip_names) && ...))
+            data_[idx].change(functor);
+    return (bytes);
+}
+
+// ----------------------------------------------------------------------------
+
+// After a sort by names, with names[0] sorted in dir1 direction, the index
+// is sorted if names[0] is the index in ascending order. It is reordered if
+// it is one of the keys or it was not ignored.
+//
+void
+index_sorted_by_(bool ignore_index,
+                 sort_spec dir1,
+                 std::initializer_list<const char *> names)  {
+
+    const auto  is_idx =
+        [](const char *name) -> bool  {
+            return (! ::strcmp(name, DF_INDEX_COL_NAME));
+        };
+
+    if (is_idx(*names.begin()) && dir1 == sort_spec::ascen)
+        idx_order_.store(IdxOrder::sorted, std::memory_order_relaxed);
+    else if (! ignore_index || std::ranges::any_of(names, is_idx))
+        index_changed_();
+}
+
+// ----------------------------------------------------------------------------
+
+// For an index that is not sorted, it returns the rows whose index value is
+// in [range.begin, range.end], in row order
+//
+StlVecType<size_type>
+idx_range_rows_(const Index2D<IndexType> &range) const  {
+
+    StlVecType<size_type>   rows;
+    const size_type         idx_s = indices_.size();
+
+    for (size_type i = 0; i < idx_s; ++i) [[likely]]
+        if (! (indices_[i] < range.begin) && ! (range.end < indices_[i]))
+            rows.push_back(i);
+    return (rows);
+}
+
+// ----------------------------------------------------------------------------
+
 // Maps row number -> number of missing column(s)
 //
 using DropRowMap = DFMap<size_type, size_type>;
@@ -66,6 +162,121 @@ void read_csv2_(std::istream &file,
                 bool columns_only,
                 size_type starting_row,
                 size_type num_rows);
+void read_csv2_buffer_(const char *buffer,
+                       size_type buffer_size,
+                       bool columns_only,
+                       size_type starting_row,
+                       size_type num_rows);
+void read_binary_(const char *buffer,
+                  size_type buffer_size,
+                  bool columns_only,
+                  size_type starting_row,
+                  size_type num_rows);
+
+template<typename T>
+void
+read_binary_column_(const char *buffer,
+                    size_type buffer_size,
+                    const _bin_col_desc_ &desc,
+                    size_type starting_row,
+                    size_type ending_row);
+
+template<typename S, typename ... Ts>
+void
+write_binary_(S &o, bool columns_only, long start_row, long end_row) const;
+
+// Formatted cells of a batch of rows of one csv2 column. Cell i is
+// text[ends[i - 1], ends[i]).
+//
+struct  csv2_cell_buf_  {
+
+    std::string             text { };
+    StlVecType<size_type>   ends { };
+    std::ostringstream      ss { };  // For types without a to_chars form
+};
+
+// A column resolved once to its vector and type specific formatter.
+// format is null, if the column type is not in the written types.
+//
+struct  csv2_col_writer_  {
+
+    const void  *vec { nullptr };
+    void        (*format)(const void *vec,
+                          size_type begin,
+                          size_type end,
+                          int precision,
+                          csv2_cell_buf_ &cells) { nullptr };
+};
+
+template<typename V, bool IS_INDEX>
+static void
+csv2_format_cells_(const void *vec,
+                   size_type begin,
+                   size_type end,
+                   int precision,
+                   csv2_cell_buf_ &cells);
+static void
+write_csv2_rows_(const StlVecType<csv2_col_writer_> &cols,
+                 size_type begin,
+                 size_type end,
+                 int precision,
+                 StlVecType<csv2_cell_buf_> &cells,
+                 std::string &out);
+template<typename S, typename ... Ts>
+void
+write_csv2_data_(S &o,
+                 bool columns_only,
+                 long start_row,
+                 long end_row,
+                 std::streamsize precision) const;
+
+// Type specific operations on a csv2 column buffer. They let the
+// buffer based csv2 reader resolve a column type once, instead of once per
+// cell. If in_place is set, parse() reads the cell directly from the
+// buffer and does not need a terminating '\0'.
+//
+struct  csv2_col_ops_  {
+
+    void (*make)(std::any &col_vec, size_type reserve);
+    void (*parse)(const char *value, std::size_t size, std::any &col_vec);
+    void (*append)(std::any &col_vec, std::any &chunk_vec);
+    void (*load)(DataFrame &df, const char *name, std::any &col_vec);
+    bool in_place;
+};
+
+template<typename T>
+static void
+csv2_make_(std::any &col_vec, size_type reserve);
+template<typename T>
+static void
+csv2_append_(std::any &col_vec, std::any &chunk_vec);
+template<typename T>
+static void
+csv2_load_(DataFrame &df, const char *name, std::any &col_vec);
+template<typename T>
+static void
+csv2_parse_(const char *value, std::size_t size, std::any &col_vec);
+template<DT_DATE_STYLE DS>
+static void
+csv2_parse_dt_(const char *value, std::size_t size, std::any &col_vec);
+
+template<typename T>
+static csv2_col_ops_
+csv2_ops_(void (*parse)(const char *, std::size_t, std::any &) = nullptr);
+static csv2_col_ops_
+get_csv2_col_ops_(const char *type_spec);
+
+static const char *
+parse_csv2_header_(const char *cursor,
+                   const char *buf_end,
+                   StlVecType<String64> &col_names,
+                   StlVecType<size_type> &col_sizes,
+                   StlVecType<csv2_col_ops_> &ops);
+static void
+parse_csv2_chunk_(const char *begin,
+                  const char *end,
+                  const StlVecType<csv2_col_ops_> &ops,
+                  StlVecType<std::any> &col_vecs);
 
 template<typename T, typename ITR>
 void
@@ -84,67 +295,48 @@ column_join_helper_(const LHS_T &lhs,
                     const char *col_name,
                     const IndexIdxVector &joined_index_idx);
 
+template<typename LV, typename RV>
+static IndexIdxVector
+get_joined_index_idx_(const LV &lhs_vec,
+                      const RV &rhs_vec,
+                      join_policy mp,
+                      bool lhs_sorted,
+                      bool rhs_sorted);
+
+template<typename LV, typename RV>
+static IndexIdxVector
+get_hash_index_idx_vector_(const LV &lhs_vec,
+                           const RV &rhs_vec,
+                           join_policy mp,
+                           bool lhs_is_small);
+
+template<typename LV, typename RV, typename LR, typename RR>
+static void
+asof_match_(const LV &lhs_idx,
+            const RV &rhs_idx,
+            size_type lhs_s,
+            LR &&lhs_row,
+            size_type rhs_s,
+            RR &&rhs_row,
+            asof_policy ap,
+            std::optional<double> tolerance,
+            IndexIdxVector &joined_index_idx);
+
 template<typename T>
 static IndexIdxVector
 get_inner_index_idx_vector_(const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
                             const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
 
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-index_inner_join_(const LHS_T &lhs, const RHS_T &rhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs);
-
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-column_inner_join_(const LHS_T &lhs,
-                   const RHS_T &rhs,
-                   const char *col_name,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
-
 template<typename T>
 static IndexIdxVector
 get_left_index_idx_vector_(const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
                            const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
 
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-index_left_join_(const LHS_T &lhs, const RHS_T &rhs,
-                 const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                 const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs);
-
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-column_left_join_(const LHS_T &lhs,
-                  const RHS_T &rhs,
-                  const char *col_name,
-                  const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
-
 template<typename T>
 static IndexIdxVector
 get_right_index_idx_vector_(const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
                             const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
 
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-index_right_join_(const LHS_T &lhs, const RHS_T &rhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs);
-
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-column_right_join_(const LHS_T &lhs,
-                   const RHS_T &rhs,
-                   const char *col_name,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
-
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-static void
-concat_helper_(LHS_T &lhs, const RHS_T &rhs, bool add_new_columns);
-
 template<typename T>
 static IndexIdxVector
 get_left_right_index_idx_vector_(
@@ -152,19 +344,8 @@ get_left_right_index_idx_vector_(
     const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
 
 template<typename LHS_T, typename RHS_T, typename ... Ts>
-static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-index_left_right_join_(
-    const LHS_T &lhs, const RHS_T &rhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs);
-
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-column_left_right_join_(const LHS_T &lhs,
-                        const RHS_T &rhs,
-                        const char *col_name,
-                        const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                        const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
+static void
+concat_helper_(LHS_T &lhs, const RHS_T &rhs, bool add_new_columns);
 
 // ----------------------------------------------------------------------------
 
@@ -440,8 +621,8 @@ template<typename ... Ts>
 void remove_data_by_sel_common_(const StlVecType<size_type> &col_indices)  {
 
     const auto  thread_level =
-        (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(indices_.size(), GATHER_WORK,
+                         1, row_bytes_<Ts ...>() + sizeof(IndexType));
     SpinGuard   guard (lock_);
 
     if (thread_level > 2)  {
@@ -464,7 +645,8 @@ void remove_data_by_sel_common_(const StlVecType<size_type> &col_indices)  {
             };
             auto    future_idx = thr_pool_.dispatch(false, lbd_idx);
             auto    futures =
-                thr_pool_.parallel_loop(column_list_.begin(),
+                thr_pool_.parallel_loop(thread_level,
+                                        column_list_.begin(),
                                         column_list_.end(),
                                         std::move(lbd));
 
@@ -484,6 +666,7 @@ void remove_data_by_sel_common_(const StlVecType<size_type> &col_indices)  {
         for (size_type i = 0; i < col_indices_s; ++i) [[likely]]
             indices_.erase(indices_.begin() + (col_indices[i] - del_count++));
     }
+    index_erased_();
 
     return;
 }
@@ -502,9 +685,14 @@ join_helper_common_(
     using res_t = decltype(result);
 
     std::vector<std::future<void>>  futures;
+    const size_type                 row_bytes =
+        skip_col_name
+            ? lhs.template row_bytes_<Ts ...>(skip_col_name) +
+              rhs.template row_bytes_<Ts ...>(skip_col_name)
+            : lhs.template row_bytes_<Ts ...>() +
+              rhs.template row_bytes_<Ts ...>();
     const auto                      thread_level =
-        (lhs.indices_.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(joined_index_idx.size(), GATHER_WORK, 1, row_bytes);
 
 
     if (thread_level > 2)
@@ -686,8 +874,8 @@ remove_dups_common_(const DataFrame &s_df,
     }
 
     const auto  thread_level =
-        (new_df.get_index().size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+        get_thread_level(new_df.get_index().size(), COPY_WORK,
+                         1, s_df.template row_bytes_<Ts ...>());
 
     if (thread_level > 2)  {
         auto    lbd =
@@ -704,7 +892,8 @@ remove_dups_common_(const DataFrame &s_df,
                 }
             };
         auto    futures =
-            thr_pool_.parallel_loop(s_df.column_list_.begin(),
+            thr_pool_.parallel_loop(thread_level,
+                                    s_df.column_list_.begin(),
                                     s_df.column_list_.end(),
                                     std::move(lbd));
 
@@ -749,7 +938,8 @@ data_by_sel_common_(const StlVecType<size_type> &col_indices,
     }
 
     const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+        get_thread_level(col_indices.size(), GATHER_WORK,
+                         1, row_bytes_<Ts ...>());
 
     if (thread_level > 2)  {
         auto    lbd =
@@ -767,7 +957,8 @@ data_by_sel_common_(const StlVecType<size_type> &col_indices,
             };
 
         auto    futuers =
-            thr_pool_.parallel_loop(column_list_.begin(),
+            thr_pool_.parallel_loop(thread_level,
+                                    column_list_.begin(),
                                     column_list_.end(),
                                     std::move(lbd));
 
@@ -853,6 +1044,249 @@ view_by_sel_common_(const StlVecType<size_type> &col_indices,
 
 // ----------------------------------------------------------------------------
 
+// It returns the rows in [0, scan_s) for which
+// sel_functor(indices_[i], vecs[i] ...) is true, in order. Past the end of
+// a column, its nan is passed instead.
+// If parallel is true, large scans are split into chunks on thr_pool_.
+// Each chunk collects its own rows and the chunks are concatenated in
+// order. That is only done if sel_functor can be called as const. A functor
+// with a non-const operator(), such as a mutable lambda, is assumed to keep
+// state and is called serially, in row order.
+//
+template<typename F, typename ... Vs>
+StlVecType<size_type>
+get_sel_indices_(F &sel_functor,
+                 bool parallel,
+                 size_type scan_s,
+                 const Vs & ... vecs) const  {
+
+    const size_type min_col_s =
+        std::min({ scan_s, size_type(vecs.size()) ... });
+    auto            chunk_sel =
+        [&sel_functor, min_col_s, this, &vecs ...]
+        (size_type begin, size_type end,
+         StlVecType<size_type> &rows) -> void  {
+            const size_type full_end = std::min(end, min_col_s);
+
+            for (size_type i = begin; i < full_end; ++i) [[likely]]
+                if (sel_functor(this->indices_[i], vecs[i] ...)) [[unlikely]]
+                    rows.push_back(i);
+            for (size_type i = std::max(begin, min_col_s); i < end; ++i)
+                if (sel_functor(
+                        this->indices_[i],
+                        (i < vecs.size()
+                             ? vecs[i]
+                             : get_nan<typename Vs::value_type>()) ...))
+                    rows.push_back(i);
+        };
+
+    constexpr bool  const_functor =
+        std::is_invocable_v<const F &,
+                            const IndexType &,
+                            const typename Vs::value_type & ...>;
+    StlVecType<size_type>   col_indices;
+
+    if constexpr (const_functor)  {
+        if (const auto thread_level =
+                get_thread_level(
+                    scan_s, VISIT_WORK, 1,
+                    (sizeof(IndexType) + ... +
+                     sizeof(typename Vs::value_type)));
+            parallel && thread_level > 2)  {
+            auto    futures =
+                thr_pool_.parallel_loop(
+                    thread_level,
+                    size_type(0),
+                    scan_s,
+                    [&chunk_sel](size_type begin,
+                                 size_type end) -> StlVecType<size_type>  {
+                        StlVecType<size_type>   rows;
+
+                        rows.reserve((end - begin) / 2);
+                        chunk_sel(begin, end, rows);
+                        return (rows);
+                    });
+            StlVecType<StlVecType<size_type>>   chunks;
+            size_type                           sel_count = 0;
+
+            chunks.reserve(futures.size());
+            for (auto &fut : futures)  {
+                chunks.push_back(fut.get());
+                sel_count += chunks.back().size();
+            }
+            col_indices.reserve(sel_count);
+            for (const auto &rows : chunks)
+                col_indices.insert(col_indices.end(),
+                                   rows.begin(), rows.end());
+            return (col_indices);
+        }
+    }
+
+    col_indices.reserve(scan_s / 2);
+    chunk_sel(0, scan_s, col_indices);
+    return (col_indices);
+}
+
+// ----------------------------------------------------------------------------
+
+// One bit per row, 64 rows per word
+//
+using SelMask = StlVecType<std::uint64_t>;
+
+// It ands the rows of vec that satisfy cmp(vec[i], value) into mask.
+// Each word is filled with no branches. The comparisons go into 64 byte
+// flags, which the compiler vectorizes. Then every 8 flags are packed into
+// a byte of the word by one multiply.
+//
+template<typename V, typename T, typename CMP>
+static void
+and_sel_mask_(const V &vec, const T &value, CMP &&cmp, SelMask &mask)  {
+
+    const size_type col_s = std::min(vec.size(), mask.size() * 64);
+    const size_type full_words = col_s / 64;
+    auto            lbd =
+        [&vec, &value, &cmp, &mask]
+        (size_type begin, size_type end) -> void  {
+            for (size_type w = begin; w < end; ++w) [[likely]]  {
+                const size_type base = w * 64;
+                unsigned char   flags[64];
+                std::uint64_t   bits = 0;
+
+                for (size_type j = 0; j < 64; ++j)
+                    flags[j] = cmp(vec[base + j], value);
+
+                // The multiply gathers 8 flag bytes into one byte. It
+                // relies on the first flag being the lowest byte.
+                //
+                if constexpr (std::endian::native == std::endian::little)  {
+                    for (size_type b = 0; b < 8; ++b)  {
+                        std::uint64_t   eight;
+
+                        std::memcpy(&eight, flags + b * 8, sizeof(eight));
+                        bits |=
+                            ((eight * 0x0102040810204080ULL) >> 56) << (b * 8);
+                    }
+                }
+                else  {
+                    for (size_type j = 0; j < 64; ++j)
+                        bits |= std::uint64_t(flags[j]) << j;
+                }
+                mask[w] &= bits;
+            }
+        };
+
+    if (const auto thread_level =
+            get_thread_level(col_s, VISIT_WORK,
+                             1, sizeof(typename V::value_type));
+        thread_level > 2)  {
+        auto    futures =
+            thr_pool_.parallel_loop(thread_level,
+                                    size_type(0), full_words, std::move(lbd));
+
+        for (auto &fut : futures)  fut.get();
+    }
+    else
+        lbd(0, full_words);
+
+    // The partial last word, and rows past the end of the column
+    //
+    if (full_words < mask.size())  {
+        std::uint64_t   bits = 0;
+
+        for (size_type i = full_words * 64; i < col_s; ++i)
+            bits |= std::uint64_t(cmp(vec[i], value)) << (i % 64);
+        mask[full_words] &= bits;
+        std::fill(mask.begin() + (full_words + 1), mask.end(), 0);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename V, typename T>
+static void
+and_sel_mask_(const V &vec, compare_op op, const T &value, SelMask &mask)  {
+
+    switch(op)  {
+        case compare_op::eq:
+            and_sel_mask_(vec, value, std::equal_to<T> { }, mask);
+            break;
+        case compare_op::ne:
+            and_sel_mask_(vec, value, std::not_equal_to<T> { }, mask);
+            break;
+        case compare_op::lt:
+            and_sel_mask_(vec, value, std::less<T> { }, mask);
+            break;
+        case compare_op::le:
+            and_sel_mask_(vec, value, std::less_equal<T> { }, mask);
+            break;
+        case compare_op::gt:
+            and_sel_mask_(vec, value, std::greater<T> { }, mask);
+            break;
+        case compare_op::ge:
+        default:
+            and_sel_mask_(vec, value, std::greater_equal<T> { }, mask);
+            break;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// It returns the rows selected by all the predicates, in order.
+// The popcount of the mask gives the exact number of rows up front.
+//
+template<typename ... Ps>
+StlVecType<size_type>
+get_pred_rows_(const ColumnPred<Ps> & ... preds) const  {
+
+    const size_type idx_s = indices_.size();
+    SelMask         mask ((idx_s + 63) / 64, ~std::uint64_t(0));
+
+    if (idx_s % 64)
+        mask.back() = (std::uint64_t(1) << (idx_s % 64)) - 1;
+
+    auto    and_pred =
+        [this, &mask](const auto &pred) -> void  {
+            using PredT = typename std::remove_cvref_t<decltype(pred)>::type;
+
+            if constexpr (std::is_same_v<PredT, IndexType>)  {
+                if (! ::strcmp(pred.col_name, DF_INDEX_COL_NAME))  {
+                    and_sel_mask_(indices_, pred.op, pred.value, mask);
+                    return;
+                }
+            }
+            and_sel_mask_(get_column<PredT>(pred.col_name, false),
+                          pred.op,
+                          pred.value,
+                          mask);
+        };
+
+    {
+        const SpinGuard guard(lock_);
+
+        (and_pred(preds), ...);
+    }
+
+    size_type   sel_count = 0;
+
+    for (const auto bits : mask)
+        sel_count += std::popcount(bits);
+
+    StlVecType<size_type>   col_indices (sel_count);
+    size_type               pos = 0;
+
+    for (size_type w = 0; w < mask.size(); ++w) [[likely]]  {
+        std::uint64_t   bits = mask[w];
+
+        while (bits)  {
+            col_indices[pos++] = w * 64 + std::countr_zero(bits);
+            bits &= bits - 1;
+        }
+    }
+    return (col_indices);
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename V, typename T>
 inline static void
 replace_vector_vals_(V &data_vec,
@@ -1414,6 +1848,503 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
 
 // ----------------------------------------------------------------------------
 
+// It returns the named groupby column, which could be the index
+//
+template<typename T>
+const ColumnVecType<T> &
+groupby_col_(const char *col_name) const  {
+
+    if (! ::strcmp(col_name, DF_INDEX_COL_NAME))
+        return (*((const ColumnVecType<T> *) &(get_index())));
+    return (get_column<T>(col_name, false));
+}
+
+// ----------------------------------------------------------------------------
+
+// It sorts the grouping permutation by the groupby columns, unless they are
+// known to be presorted. Then it finds where the groups start, in parallel
+// if it is worth it.
+//
+template<typename ... Vs>
+void
+sort_grouping_(Grouping &grouping,
+               bool presorted,
+               const Vs & ... vecs) const  {
+
+    auto            &sort_v = grouping.permutation;
+    auto            &grp_offs = grouping.offsets;
+    const size_type vec_s = sort_v.size();
+
+    std::iota(sort_v.begin(), sort_v.end(), 0);
+    if (! presorted)
+        std::ranges::sort(sort_v,
+                          [&vecs ...](size_type i, size_type j) -> bool  {
+                              return (std::forward_as_tuple(vecs[i] ...) <
+                                      std::forward_as_tuple(vecs[j] ...));
+                          });
+
+    auto    lbd =
+        [&sort_v, &vecs ...]
+        (size_type begin, size_type end) -> StlVecType<size_type>  {
+            StlVecType<size_type>   starts;
+
+            for (size_type i = std::max(begin, size_type(1)); i < end; ++i)
+                if (((vecs[sort_v[i]] != vecs[sort_v[i - 1]]) || ...))
+                    starts.push_back(i);
+            return (starts);
+        };
+
+    grp_offs.assign(1, 0);
+    if (const auto thread_level =
+            get_thread_level(vec_s, VISIT_WORK,
+                             1, (sizeof(typename Vs::value_type) + ...));
+        thread_level > 2)  {
+        auto    futures =
+            thr_pool_.parallel_loop(thread_level,
+                                    size_type(0), vec_s, std::move(lbd));
+
+        for (auto &fut : futures)  {
+            while (fut.wait_for(std::chrono::seconds(0)) ==
+                       std::future_status::timeout)
+                thr_pool_.run_task();
+
+            const auto  starts = fut.get();
+
+            grp_offs.insert(grp_offs.end(), starts.begin(), starts.end());
+        }
+    }
+    else if (vec_s > 0)  {
+        grp_offs = lbd(0, vec_s);
+        grp_offs.insert(grp_offs.begin(), 0);
+    }
+    if (vec_s > 0)  grp_offs.push_back(vec_s);
+}
+
+// ----------------------------------------------------------------------------
+
+// It gives every row a dense group id by hashing the groupby columns in one
+// pass. Then it buckets the rows of the grouping permutation by group id,
+// keeping the original row order within each group. If sort_groups, group
+// ids are the ranks of the unique keys, so groups come out in ascending key
+// order. Otherwise, they come out in the order they first appear.
+//
+// The hash table is open addressing over group ids. Keys are compared
+// through the first row of each group, so nothing is copied or allocated
+// per group.
+//
+template<typename ... Vs>
+static void
+hash_grouping_(Grouping &grouping, bool sort_groups, const Vs & ... vecs)  {
+
+    constexpr std::size_t   hash_bits = sizeof(std::size_t) * 8;
+    constexpr std::size_t   golden = std::size_t(0x9E3779B97F4A7C15ULL);
+
+    auto                    &sort_v = grouping.permutation;
+    const size_type         vec_s = sort_v.size();
+    StlVecType<size_type>   row_grps (vec_s);
+    StlVecType<size_type>   grp_rows;    // First row of each group
+    StlVecType<std::size_t> grp_hashes;
+    StlVecType<size_type>   slots (1024, 0);  // Group id + 1, 0 is empty
+    std::size_t             shift = hash_bits - 10;
+
+    for (size_type i = 0; i < vec_s; ++i) [[likely]]  {
+        std::size_t h = 0;
+
+        (_hash_combine_(h, vecs[i]), ...);
+        h *= golden;
+
+        const size_type mask = slots.size() - 1;
+        size_type       slot = h >> shift;
+
+        while (true)  {
+            const size_type grp = slots[slot];
+
+            if (grp == 0)  {  // New group
+                row_grps[i] = grp_rows.size();
+                grp_rows.push_back(i);
+                grp_hashes.push_back(h);
+                slots[slot] = grp_rows.size();
+                break;
+            }
+            if (grp_hashes[grp - 1] == h &&
+                ((vecs[grp_rows[grp - 1]] == vecs[i]) && ...))  {
+                row_grps[i] = grp - 1;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        // Keep the load factor under 1/2
+        //
+        if (grp_rows.size() * 2 > slots.size())  {
+            slots.assign(slots.size() * 2, 0);
+            shift -= 1;
+
+            const size_type new_mask = slots.size() - 1;
+
+            for (size_type g = 0; g < grp_rows.size(); ++g)  {
+                size_type   new_slot = grp_hashes[g] >> shift;
+
+                while (slots[new_slot] != 0)
+                    new_slot = (new_slot + 1) & new_mask;
+                slots[new_slot] = g + 1;
+            }
+        }
+    }
+
+    const size_type grp_s = grp_rows.size();
+
+    if (sort_groups && grp_s > 1)  {
+        StlVecType<size_type>   ranks (grp_s);
+
+        // Only the unique keys are sorted, by their first rows
+        //
+        std::ranges::sort(grp_rows,
+                          [&vecs ...](size_type i, size_type j) -> bool  {
+                              return (std::forward_as_tuple(vecs[i] ...) <
+                                      std::forward_as_tuple(vecs[j] ...));
+                          });
+        for (size_type r = 0; r < grp_s; ++r)
+            ranks[row_grps[grp_rows[r]]] = r;
+        for (auto &grp : row_grps)
+            grp = ranks[grp];
+    }
+
+    // Counting sort by group id. The group starts come out of it for free.
+    //
+    auto                    &grp_offs = grouping.offsets;
+    StlVecType<size_type>   cursors (grp_s + 1, 0);
+
+    for (const auto grp : row_grps)
+        cursors[grp + 1] += 1;
+    std::partial_sum(cursors.begin(), cursors.end(), cursors.begin());
+    grp_offs = cursors;
+    for (size_type i = 0; i < vec_s; ++i) [[likely]]
+        sort_v[cursors[row_grps[i]]++] = i;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename ... Vs>
+Grouping
+make_grouping_(groupby_policy policy, const Vs & ... vecs) const  {
+
+    Grouping    grouping;
+
+    grouping.permutation.resize(std::min({ vecs.size() ... }));
+
+    // Grouping by a sorted index alone, all policies produce the runs of
+    // equal index values in order
+    //
+    bool    presorted = false;
+
+    if constexpr (sizeof...(Vs) == 1)
+        presorted = ((static_cast<const void *>(&vecs) ==
+                          static_cast<const void *>(&indices_)) && ...) &&
+                    is_index_sorted();
+
+    if (presorted || policy == groupby_policy::sort)  {
+        sort_grouping_(grouping, presorted, vecs ...);
+    }
+    else if constexpr ((hashable<typename Vs::value_type> && ...))  {
+        hash_grouping_(grouping,
+                       policy == groupby_policy::hash_sorted,
+                       vecs ...);
+    }
+    else  {
+        throw NotFeasible("groupby: Hash policies need hashable column types");
+    }
+    return (grouping);
+}
+
+// ----------------------------------------------------------------------------
+
+// It aggregates the groups of grouping into res. First, the groupby key
+// columns that are not the index are loaded.
+// If it is worth threads, columns with mergeable visitors are aggregated one
+// at a time, each by all threads. Otherwise, they are aggregated in parallel,
+// one column per thread.
+//
+template<typename I_V, typename ... Ts, typename ... Vs>
+void
+groupby_common_(DataFrame &res,
+                const Grouping &grouping,
+                I_V &idx_visitor,
+                std::tuple<Ts ...> &triples,
+                std::pair<const char *, const Vs *> ... keys) const  {
+
+    const auto      &sort_v = grouping.permutation;
+    const auto      &grp_offs = grouping.offsets;
+    const size_type grp_s = grouping.group_count();
+
+    // A Grouping could have been built or changed by the caller. Each group
+    // must have at least one row, since its keys are taken from its first
+    // row.
+    //
+    if (sort_v.size() > indices_.size())
+        throw InconsistentData("groupby(): Grouping has more rows than "
+                               "the DataFrame");
+    if (grp_offs.empty() ||
+        grp_offs.front() != 0 ||
+        grp_offs.back() != sort_v.size())
+        throw InconsistentData("groupby(): Grouping offsets must start at 0 "
+                               "and end at the number of rows");
+    for (size_type g = 1; g < grp_offs.size(); ++g)
+        if (grp_offs[g] <= grp_offs[g - 1]) [[unlikely]]
+            throw InconsistentData("groupby(): Grouping offsets must be "
+                                   "increasing");
+    for (const size_type row : sort_v)
+        if (row >= indices_.size()) [[unlikely]]
+            throw InconsistentData("groupby(): Grouping has a row past the "
+                                   "end of the DataFrame");
+
+    auto    load_key =
+        [&res, &sort_v, &grp_offs, grp_s](const auto &key) -> void  {
+            if (::strcmp(key.first, DF_INDEX_COL_NAME))  {
+                using ColValueType =
+                    typename std::remove_cvref_t<
+                        decltype(*key.second)>::value_type;
+
+                auto    &col =
+                    res.template create_column<ColValueType>(key.first);
+
+                col.resize(grp_s);
+                for (size_type g = 0; g < grp_s; ++g)
+                    col[g] = (*key.second)[sort_v[grp_offs[g]]];
+            }
+        };
+
+    (load_key(keys), ...);
+
+    // All result columns must exist before any of them is filled
+    //
+    for_each_in_tuple(triples,
+                      [&res](auto &triple) -> void  {
+                          _create_column_from_triple_(res, triple);
+                      });
+
+    constexpr bool  mergeable =
+        mergeable_visitor<I_V> &&
+        (mergeable_visitor<
+             std::tuple_element_t<2, std::remove_cvref_t<Ts>>> && ...);
+    const auto      thread_level =
+        get_thread_level(
+            sort_v.size(), VISIT_WORK, 1,
+            (sizeof(IndexType) + ... +
+             sizeof(typename std::tuple_element_t<
+                        2, std::remove_cvref_t<Ts>>::value_type)));
+    const bool      in_parallel = thread_level > 2;
+
+    std::vector<std::future<void>>  futures;
+
+    for_each_in_tuple(
+        triples,
+        [this, &res, &sort_v, &grp_offs, thread_level, in_parallel,
+         &futures]
+        (auto &triple) -> void  {
+            using TripleType = std::remove_cvref_t<decltype(triple)>;
+            using ValueType =
+                typename std::tuple_element_t<2, TripleType>::value_type;
+            using ResultType =
+                typename std::tuple_element_t<2, TripleType>::result_type;
+
+            const auto  &src_vec =
+                get_column<ValueType>(std::get<0>(triple), false);
+            auto        &dst_vec =
+                res.template get_column<ResultType>(std::get<1>(triple),
+                                                    false);
+            auto        &visitor = std::get<2>(triple);
+
+            if constexpr (mergeable)  {
+                if (in_parallel)  {
+                    _groupby_visit_parallel_(visitor, indices_, src_vec,
+                                             sort_v, grp_offs, dst_vec,
+                                             thread_level);
+                    return;
+                }
+            }
+            if (in_parallel && sizeof...(Ts) > 1)
+                futures.push_back(
+                    thr_pool_.dispatch(
+                        false,
+                        [this, &visitor, &src_vec, &sort_v, &grp_offs,
+                         &dst_vec]() -> void  {
+                            _groupby_visit_(visitor, indices_, src_vec,
+                                            sort_v, grp_offs, dst_vec);
+                        }));
+            else
+                _groupby_visit_(visitor, indices_, src_vec,
+                                sort_v, grp_offs, dst_vec);
+        });
+
+    if constexpr (mergeable)  {
+        if (in_parallel)
+            _groupby_visit_parallel_(idx_visitor, indices_, indices_,
+                                     sort_v, grp_offs, res.indices_,
+                                     thread_level);
+        else
+            _groupby_visit_(idx_visitor, indices_, indices_,
+                            sort_v, grp_offs, res.indices_);
+    }
+    else  {
+        _groupby_visit_(idx_visitor, indices_, indices_,
+                        sort_v, grp_offs, res.indices_);
+    }
+
+    for (auto &fut : futures)  {
+        while (fut.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::timeout)
+            thr_pool_.run_task();
+        fut.get();
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// It splits the rows into chunks and visits each chunk with a copy of
+// visitor on the thread-pool, while the calling thread visits the first
+// chunk with visitor itself. feed(vis, begin, end) passes rows [begin, end)
+// to vis. row_bytes is the size of the data fed per row. The partial
+// visitors are merged pairwise, so each sum is added to a sum of about the
+// same size, and always the later rows into the earlier.
+//
+template<typename V, typename F>
+V &
+parallel_visit_(V &visitor, size_type row_bytes, F &&feed) const  {
+
+    // Checked before the cost model is asked, so it does not depend on the
+    // number of rows
+    //
+    if constexpr (conditionally_mergeable<V>)
+        if (! visitor.can_merge()) [[unlikely]]
+            throw NotFeasible("parallel_visit(): ERROR: The visitor cannot be "
+                              "merged in this configuration");
+
+    const size_type idx_s = indices_.size();
+    const size_type chunk_cnt =
+        get_thread_level(idx_s, VISIT_WORK, 1, row_bytes);
+
+    visitor.pre();
+    if (chunk_cnt < 2)  {
+        feed(visitor, size_type(0), idx_s);
+        visitor.post();
+        return (visitor);
+    }
+
+    const size_type                 chunk_s = idx_s / chunk_cnt;
+    std::vector<V>                  partials(chunk_cnt - 1, visitor);
+    std::vector<std::future<void>>  futures;
+
+    futures.reserve(chunk_cnt - 1);
+    for (size_type c = 1; c < chunk_cnt; ++c)  {
+        const size_type begin = c * chunk_s;
+        const size_type end = (c + 1 == chunk_cnt) ? idx_s : begin + chunk_s;
+
+        futures.push_back(
+            thr_pool_.dispatch(false,
+                               [&feed, begin, end](V &vis) -> void  {
+                                   vis.pre();
+                                   feed(vis, begin, end);
+                               },
+                               std::ref(partials[c - 1])));
+    }
+    feed(visitor, size_type(0), chunk_s);
+    for (auto &fut : futures)  {
+        while (fut.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::timeout)
+            thr_pool_.run_task();
+        fut.get();
+    }
+
+    const auto  chunk = [&visitor, &partials](size_type c) -> V &  {
+        return (c == 0 ? visitor : partials[c - 1]);
+    };
+
+    for (size_type step = 1; step < chunk_cnt; step *= 2)
+        for (size_type c = 0; c + step < chunk_cnt; c += step * 2)
+            chunk(c).merge(chunk(c + step));
+    visitor.post();
+    return (visitor);
+}
+
+// ----------------------------------------------------------------------------
+
+// Below this many rows, the comparison sort is faster than the radix sort
+//
+static constexpr size_type  RADIX_SORT_THHOLD_ = 4096;
+
+// If all the sort columns have radix sortable types, it stably sorts
+// sorting_idxs by them using the radix sort. The first key is the most
+// significant one. It also reorders the key columns and the index (unless
+// ignore_index) by the result and returns true. Otherwise, it does nothing
+// and returns false.
+//
+template<typename ... Vs>
+bool
+radix_sort_common_(StlVecType<size_type> &sorting_idxs,
+                   bool ignore_index,
+                   std::pair<Vs *, sort_spec> ... keys)  {
+
+    if constexpr ((_radix_sortable_<typename Vs::value_type> && ...))  {
+        const size_type idx_s = sorting_idxs.size();
+
+        if (idx_s < RADIX_SORT_THHOLD_)  return (false);
+
+        const auto  thread_level =
+            get_thread_level(idx_s, SORT_WORK,
+                             1, (sizeof(typename Vs::value_type) + ...));
+        const auto  key_tuple = std::make_tuple(keys ...);
+
+        // Since each pass is stable, sorting from the least significant key
+        // to the most significant one gives the lexicographic order
+        //
+        [&]<std::size_t ... Is>(std::index_sequence<Is ...>) -> void  {
+            ((_radix_sort_(
+                  *(std::get<sizeof ... (Vs) - 1 - Is>(key_tuple).first),
+                  std::get<sizeof ... (Vs) - 1 - Is>(key_tuple).second,
+                  sorting_idxs,
+                  thread_level)), ...);
+        } (std::make_index_sequence<sizeof ... (Vs)> { });
+
+        // The key columns are gathered, when they are not views. It is much
+        // faster than the in place reordering sort_functor_ does
+        //
+        StlVecType<const void *>    done_cols;
+        StlVecType<bool>            done_vec;
+        auto                        reorder =
+            [&done_cols, &done_vec, &sorting_idxs, idx_s]
+            (auto &vec) -> void  {
+                using vec_t = std::remove_reference_t<decltype(vec)>;
+
+                const void  *addr = &vec;
+
+                if (std::ranges::find(done_cols, addr) != done_cols.end())
+                    return;
+                done_cols.push_back(addr);
+                if constexpr (std::is_same_v<
+                                  vec_t,
+                                  StlVecType<typename vec_t::value_type>>)  {
+                    vec_t   sorted(idx_s);
+
+                    for (size_type i = 0; i < idx_s; ++i)
+                        sorted[i] = vec[sorting_idxs[i]];
+                    vec.swap(sorted);
+                }
+                else  {
+                    done_vec.resize(idx_s);
+                    _sort_by_sorted_index_(vec, sorting_idxs, done_vec, idx_s);
+                }
+            };
+
+        (reorder(*(keys.first)), ...);
+        if (! ignore_index)  reorder(indices_);
+        return (true);
+    }
+    else  return (false);
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename T>
 inline static void
 get_mem_numbers_(const VectorView<T, align_value> &,
@@ -33,8 +33,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <any>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <iterator>
 #include <sstream>
 
 // ----------------------------------------------------------------------------
@@ -1161,6 +1163,575 @@ read_csv2_(std::istream &stream,
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::
+csv2_make_(std::any &col_vec, size_type reserve)  {
+
+    col_vec = StlVecType<T> { };
+    std::any_cast<StlVecType<T> &>(col_vec).reserve(reserve);
+}
+
+// --------------------------------------
+
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::
+csv2_append_(std::any &col_vec, std::any &chunk_vec)  {
+
+    StlVecType<T>   &vec = std::any_cast<StlVecType<T> &>(col_vec);
+    StlVecType<T>   &chunk = std::any_cast<StlVecType<T> &>(chunk_vec);
+
+    if (vec.empty())  {
+        vec = std::move(chunk);
+    }
+    else  {
+        vec.insert(vec.end(),
+                   std::make_move_iterator(chunk.begin()),
+                   std::make_move_iterator(chunk.end()));
+        chunk = StlVecType<T> { };
+    }
+}
+
+// --------------------------------------
+
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::
+csv2_load_(DataFrame &df, const char *name, std::any &col_vec)  {
+
+    df.template load_column<T>(
+        name,
+        std::move(std::any_cast<StlVecType<T> &>(col_vec)),
+        nan_policy::dont_pad_with_nans);
+}
+
+// --------------------------------------
+
+// These are the same conversions that read_csv2_() does per cell.
+// Numbers and strings are taken in place, so value is not necessarily
+// '\0' terminated for them.
+//
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::
+csv2_parse_(const char *value, std::size_t size, std::any &col_vec)  {
+
+    StlVecType<T>   &vec = *std::any_cast<StlVecType<T>>(&col_vec);
+
+    if constexpr (std::is_same_v<T, std::string>)  {
+        vec.emplace_back(value, size);
+        return;
+    }
+    else if constexpr (std::is_same_v<T, char> ||
+                       std::is_same_v<T, unsigned char>)  {
+        if (size > 1)
+            vec.push_back(
+                static_cast<T>(int(_atonum_<long>(value, value + size, 10))));
+        else if (size > 0)
+            vec.push_back(static_cast<T>(value[0]));
+        return;
+    }
+    else  {
+        if (size == 0)  return;
+
+        const char  *end = value + size;
+
+        if constexpr (std::is_same_v<T, float> ||
+                      std::is_same_v<T, double> ||
+                      std::is_same_v<T, long double> ||
+                      std::is_same_v<T, long> ||
+                      std::is_same_v<T, long long> ||
+                      std::is_same_v<T, unsigned long> ||
+                      std::is_same_v<T, unsigned long long>)
+            vec.push_back(_atonum_<T>(value, end));
+        else if constexpr (std::is_same_v<T, int>)
+            vec.push_back(static_cast<int>(_atonum_<long>(value, end)));
+        else if constexpr (std::is_same_v<T, unsigned int>)
+            vec.push_back(
+                static_cast<unsigned int>(_atonum_<unsigned long>(value, end)));
+        else if constexpr (std::is_same_v<T, bool>)
+            vec.push_back(
+                static_cast<bool>(_atonum_<unsigned long>(value, end)));
+        else if constexpr (std::is_same_v<T, DateTime>)  {
+            time_t      t;
+            int         n;
+            DateTime    dt;
+
+#ifdef _MSC_VER
+            ::sscanf(value, "%lld.%d", &t, &n);
+#else
+            ::sscanf(value, "%ld.%d", &t, &n);
+#endif // _MSC_VER
+            dt.set_time(t, n);
+            vec.emplace_back(std::move(dt));
+        }
+        else if constexpr (std::is_same_v<T, std::vector<double>>)
+            vec.push_back(_get_dbl_vec_from_value_(value));
+        else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+            vec.push_back(_get_str_vec_from_value_(value));
+        else if constexpr (std::is_same_v<T, std::set<double>>)
+            vec.push_back(_get_dbl_set_from_value_(value));
+        else if constexpr (std::is_same_v<T, std::set<std::string>>)
+            vec.push_back(_get_str_set_from_value_(value));
+        else
+            vec.push_back(_get_str_dbl_map_from_value_<T>(value));
+    }
+}
+
+// --------------------------------------
+
+template<typename I, typename H>
+template<DT_DATE_STYLE DS>
+void DataFrame<I, H>::
+csv2_parse_dt_(const char *value, std::size_t, std::any &col_vec)  {
+
+    std::any_cast<StlVecType<DateTime>>(&col_vec)->emplace_back(value, DS);
+}
+
+// --------------------------------------
+
+template<typename I, typename H>
+template<typename T>
+typename DataFrame<I, H>::csv2_col_ops_
+DataFrame<I, H>::csv2_ops_(
+    void (*parse)(const char *, std::size_t, std::any &))  {
+
+    return (csv2_col_ops_ { &DataFrame::template csv2_make_<T>,
+                            parse ? parse : &DataFrame::template csv2_parse_<T>,
+                            &DataFrame::template csv2_append_<T>,
+                            &DataFrame::template csv2_load_<T>,
+                            ! parse &&
+                            (std::is_arithmetic_v<T> ||
+                             std::is_same_v<T, std::string>) });
+}
+
+// --------------------------------------
+
+template<typename I, typename H>
+typename DataFrame<I, H>::csv2_col_ops_
+DataFrame<I, H>::get_csv2_col_ops_(const char *type_spec)  {
+
+    using str_dbl_map_t = std::map<std::string, double>;
+    using str_dbl_unomap_t = std::unordered_map<std::string, double>;
+
+    if (! ::strcmp(type_spec, "float"))
+        return (csv2_ops_<float>());
+    else if (! ::strcmp(type_spec, "double")) [[likely]]
+        return (csv2_ops_<double>());
+    else if (! ::strcmp(type_spec, "longdouble"))
+        return (csv2_ops_<long double>());
+    else if (! ::strcmp(type_spec, "int"))
+        return (csv2_ops_<int>());
+    else if (! ::strcmp(type_spec, "uint"))
+        return (csv2_ops_<unsigned int>());
+    else if (! ::strcmp(type_spec, "char"))
+        return (csv2_ops_<char>());
+    else if (! ::strcmp(type_spec, "uchar"))
+        return (csv2_ops_<unsigned char>());
+    else if (! ::strcmp(type_spec, "long"))
+        return (csv2_ops_<long>());
+    else if (! ::strcmp(type_spec, "longlong"))
+        return (csv2_ops_<long long>());
+    else if (! ::strcmp(type_spec, "ulong"))
+        return (csv2_ops_<unsigned long>());
+    else if (! ::strcmp(type_spec, "ulonglong"))
+        return (csv2_ops_<unsigned long long>());
+    else if (! ::strcmp(type_spec, "string"))
+        return (csv2_ops_<std::string>());
+    else if (! ::strcmp(type_spec, "DateTime"))
+        return (csv2_ops_<DateTime>());
+    else if (! ::strcmp(type_spec, "DateTimeAME"))
+        return (csv2_ops_<DateTime>(
+                    &DataFrame::template
+                        csv2_parse_dt_<DT_DATE_STYLE::AME_STYLE>));
+    else if (! ::strcmp(type_spec, "DateTimeEUR"))
+        return (csv2_ops_<DateTime>(
+                    &DataFrame::template
+                        csv2_parse_dt_<DT_DATE_STYLE::EUR_STYLE>));
+    else if (! ::strcmp(type_spec, "DateTimeISO"))
+        return (csv2_ops_<DateTime>(
+                    &DataFrame::template
+                        csv2_parse_dt_<DT_DATE_STYLE::ISO_STYLE>));
+    else if (! ::strcmp(type_spec, "bool"))
+        return (csv2_ops_<bool>());
+    else if (! ::strcmp(type_spec, "dbl_vec"))
+        return (csv2_ops_<std::vector<double>>());
+    else if (! ::strcmp(type_spec, "str_vec"))
+        return (csv2_ops_<std::vector<std::string>>());
+    else if (! ::strcmp(type_spec, "dbl_set"))
+        return (csv2_ops_<std::set<double>>());
+    else if (! ::strcmp(type_spec, "str_set"))
+        return (csv2_ops_<std::set<std::string>>());
+    else if (! ::strcmp(type_spec, "str_dbl_map"))
+        return (csv2_ops_<str_dbl_map_t>());
+    else if (! ::strcmp(type_spec, "str_dbl_unomap"))
+        return (csv2_ops_<str_dbl_unomap_t>());
+
+    throw DataFrameError("DataFrame::read_csv2_buffer_(): ERROR: "
+                         "Unknown column type");
+}
+
+// --------------------------------------
+
+// It parses the csv2 rows in [begin, end) into the given column buffers.
+// It is the same state machine as read_csv2_(), but on a memory buffer.
+//
+template<typename I, typename H>
+void DataFrame<I, H>::
+parse_csv2_chunk_(const char *begin,
+                  const char *end,
+                  const StlVecType<csv2_col_ops_> &ops,
+                  StlVecType<std::any> &col_vecs)  {
+
+    const size_type col_s = ops.size();
+    size_type       col_index = 0;
+    std::string     value;
+
+    value.reserve(1024);
+    while (begin < end) [[likely]]  {
+        const char  c = *begin;
+
+        if (c == '#')  {
+            const char  *nl =
+                static_cast<const char *>(::memchr(begin, '\n', end - begin));
+
+            begin = nl ? nl + 1 : end;
+            continue;
+        }
+        else if (c == '\n')  {
+            col_index = 0;
+            begin += 1;
+            continue;
+        }
+        else if (c == '\r' || c == '\0')  {
+            begin += 1;
+            continue;
+        }
+
+        const char  *token_end = _find_csv_delim_(begin, end);
+
+        if (col_index < col_s) [[likely]]  {
+            const csv2_col_ops_ &op = ops[col_index];
+
+            if (op.in_place) [[likely]]
+                op.parse(begin, token_end - begin, col_vecs[col_index]);
+            else  {
+                value.assign(begin, token_end);
+                op.parse(value.c_str(), value.size(), col_vecs[col_index]);
+            }
+        }
+        col_index += 1;
+        begin = (token_end < end && *token_end == ',')
+                    ? token_end + 1 : token_end;
+    }
+}
+
+// --------------------------------------
+
+template<typename I, typename H>
+const char *DataFrame<I, H>::
+parse_csv2_header_(const char *cursor,
+                   const char *buf_end,
+                   StlVecType<String64> &col_names,
+                   StlVecType<size_type> &col_sizes,
+                   StlVecType<csv2_col_ops_> &ops)  {
+
+    bool        header_read = false;
+    std::string token;
+
+    const auto  get_token =
+        [&cursor, buf_end, &token](char delim) -> void  {
+            const char  *token_end = cursor;
+
+            while (token_end < buf_end && *token_end != delim)
+                token_end += 1;
+            token.assign(cursor, token_end);
+            cursor = token_end < buf_end ? token_end + 1 : buf_end;
+        };
+
+    while (cursor < buf_end && ! header_read)  {
+        const char  c = *cursor;
+
+        if (c == '#')  {
+            while (cursor < buf_end && *cursor++ != '\n')  ;
+            continue;
+        }
+        else if (c == '\r' || c == '\n' || c == '\0')  {
+            cursor += 1;
+            continue;
+        }
+
+        get_token(':');
+        col_names.emplace_back(token.c_str());
+        get_token(':');
+        col_sizes.push_back(size_type(atoi(token.c_str())));
+        if (cursor >= buf_end || *cursor++ != '<') [[unlikely]]
+            throw DataFrameError(
+                "DataFrame::read_csv2_buffer_(): ERROR: Expected "
+                "'<' char to specify column type");
+        get_token('>');
+        ops.push_back(get_csv2_col_ops_(token.c_str()));
+        if (cursor < buf_end)  {
+            const char  after_type = *cursor++;
+
+            header_read = after_type == '\n' || after_type == '\r';
+        }
+    }
+    return (cursor);
+}
+
+// --------------------------------------
+
+template<typename I, typename H>
+void DataFrame<I, H>::
+read_csv2_buffer_(const char *buffer,
+                  size_type buffer_size,
+                  bool columns_only,
+                  size_type starting_row,
+                  size_type num_rows)  {
+
+    const char                  *const buf_end = buffer + buffer_size;
+    StlVecType<String64>        col_names;
+    StlVecType<csv2_col_ops_>   ops;
+    StlVecType<size_type>       col_sizes;
+
+    col_names.reserve(32);
+    ops.reserve(32);
+    col_sizes.reserve(32);
+
+    // First get the header which is column names, sizes and types
+    //
+    const char  *cursor =
+        parse_csv2_header_(buffer, buf_end, col_names, col_sizes, ops);
+
+    // Jump to the starting row. This counts rows the same way
+    // read_csv2_() does.
+    //
+    for (size_type row_cnt = 0;
+         row_cnt < starting_row && cursor < buf_end; ++cursor)
+        if (*cursor == '\r' || *cursor == '\n')
+            row_cnt += 1;
+
+    // Find the end of the rows we need to read
+    //
+    const char  *const data_end =
+        num_rows != std::numeric_limits<size_type>::max()
+            ? _skip_csv2_rows_(cursor, buf_end, num_rows, false)
+            : buf_end;
+
+    const size_type col_s = ops.size();
+
+    if (col_s == 0)  return;
+    if (col_names[0] != DF_INDEX_COL_NAME && ! columns_only) [[unlikely]]
+        throw DataFrameError("DataFrame::read_csv2_buffer_(): ERROR: "
+                             "Index column is not the first column");
+
+    // Split the data into chunks on row boundaries. Small files and low
+    // thread levels are parsed in one chunk by this thread.
+    //
+    const size_type     data_size = data_end - cursor;
+    const size_type     chunk_s =
+        get_thread_level(data_size, VISIT_WORK, 1, 1) > 2
+            ? get_thread_level(data_size, VISIT_WORK, 1, 1)
+            : size_type(1);
+    StlVecType<const char *>    boundaries { cursor };
+
+    boundaries.reserve(chunk_s + 1);
+    for (size_type i = 1; i < chunk_s; ++i)  {
+        const char  *target = cursor + (data_size * i) / chunk_s;
+
+        if (target < boundaries.back())  target = boundaries.back();
+
+        const char  *nl = static_cast<const char *>(
+            ::memchr(target, '\n', data_end - target));
+
+        boundaries.push_back(nl ? nl + 1 : data_end);
+    }
+    boundaries.push_back(data_end);
+
+    StlVecType<StlVecType<std::any>>    chunk_vecs(chunk_s);
+
+    for (size_type i = 0; i < chunk_s; ++i)  {
+        const size_type chunk_size = boundaries[i + 1] - boundaries[i];
+
+        chunk_vecs[i].resize(col_s);
+        for (size_type j = 0; j < col_s; ++j)
+            ops[j].make(chunk_vecs[i][j],
+                        data_size > 0
+                            ? (col_sizes[j] * chunk_size) / data_size + 1
+                            : 0);
+    }
+
+    auto    lbd =
+        [&boundaries, &ops, &chunk_vecs](size_type i) -> void  {
+            parse_csv2_chunk_(boundaries[i], boundaries[i + 1],
+                              ops, chunk_vecs[i]);
+        };
+
+    if (chunk_s > 1)  {
+        std::vector<std::future<void>>  futures;
+
+        futures.reserve(chunk_s);
+        for (size_type i = 0; i < chunk_s; ++i)
+            futures.emplace_back(thr_pool_.dispatch(false, lbd, i));
+        for (auto &fut : futures)  fut.get();
+    }
+    else
+        lbd(0);
+
+    // Concatenate the chunks in order and load the columns
+    //
+    const size_type begin = col_names[0] == DF_INDEX_COL_NAME ? 1 : 0;
+
+    if (! columns_only) [[likely]]  {
+        for (size_type i = 1; i < chunk_s; ++i)
+            ops[0].append(chunk_vecs[0][0], chunk_vecs[i][0]);
+        load_index(std::move(
+            std::any_cast<IndexVecType &>(chunk_vecs[0][0])));
+    }
+    for (size_type j = begin; j < col_s; ++j) [[likely]]  {
+        for (size_type i = 1; i < chunk_s; ++i)
+            ops[j].append(chunk_vecs[0][j], chunk_vecs[i][j]);
+        ops[j].load(*this, col_names[j].c_str(), chunk_vecs[0][j]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::
+read_binary_column_(const char *buffer,
+                    size_type buffer_size,
+                    const _bin_col_desc_ &desc,
+                    size_type starting_row,
+                    size_type ending_row)  {
+
+    StlVecType<T>   vec;
+
+    _read_bin_col_(buffer, buffer_size, desc, starting_row, ending_row, vec);
+    load_column<T>(desc.name, std::move(vec), nan_policy::dont_pad_with_nans);
+}
+
+// --------------------------------------
+
+template<typename I, typename H>
+void DataFrame<I, H>::
+read_binary_(const char *buffer,
+             size_type buffer_size,
+             bool columns_only,
+             size_type starting_row,
+             size_type num_rows)  {
+
+    const _bin_file_header_ ref_header;
+    const _bin_file_footer_ ref_footer;
+    _bin_file_header_       header;
+    _bin_file_footer_       footer;
+
+    if (buffer_size < sizeof(header) + sizeof(footer)) [[unlikely]]
+        throw DataFrameError("DataFrame::read_binary_(): ERROR: "
+                             "File is too short to be a binary DataFrame");
+
+    std::memcpy(&header, buffer, sizeof(header));
+    std::memcpy(&footer, buffer + buffer_size - sizeof(footer), sizeof(footer));
+    if (std::memcmp(header.magic, ref_header.magic, sizeof(header.magic)) ||
+        std::memcmp(footer.magic, ref_footer.magic, sizeof(footer.magic)))
+        [[unlikely]]
+        throw DataFrameError("DataFrame::read_binary_(): ERROR: "
+                             "File is not a binary DataFrame");
+    if (header.version != ref_header.version ||
+        header.byte_order != ref_header.byte_order) [[unlikely]]
+        throw DataFrameError("DataFrame::read_binary_(): ERROR: "
+                             "Unsupported version or byte order");
+
+    const size_type dir_end = buffer_size - sizeof(footer);
+
+    if (footer.dir_offset > dir_end ||
+        footer.col_count >
+            (dir_end - footer.dir_offset) / sizeof(_bin_col_desc_))
+        [[unlikely]]
+        throw DataFrameError("DataFrame::read_binary_(): ERROR: "
+                             "Column directory is out of the file bounds");
+
+    for (size_type i = 0; i < footer.col_count; ++i) [[likely]]  {
+        _bin_col_desc_  desc;
+
+        std::memcpy(&desc,
+                    buffer + footer.dir_offset + i * sizeof(desc),
+                    sizeof(desc));
+        desc.name[sizeof(desc.name) - 1] = '\0';
+        desc.type[sizeof(desc.type) - 1] = '\0';
+
+        const size_type col_s = desc.count;
+        const size_type sr = std::min(starting_row, col_s);
+        const size_type er = sr + std::min(num_rows, col_s - sr);
+
+        if (! ::strcmp(desc.name, DF_INDEX_COL_NAME))  {
+            if (! columns_only) [[likely]]  {
+                IndexVecType    idx_vec;
+
+                _read_bin_col_(buffer, buffer_size, desc, sr, er, idx_vec);
+                load_index(std::move(idx_vec));
+            }
+            continue;
+        }
+        if (i == 0 && ! columns_only) [[unlikely]]
+            throw DataFrameError("DataFrame::read_binary_(): ERROR: "
+                                 "Index column is not the first column");
+
+        if (! ::strcmp(desc.type, "float"))
+            read_binary_column_<float>(buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "double")) [[likely]]
+            read_binary_column_<double>(buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "longdouble"))
+            read_binary_column_<long double>(
+                buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "short"))
+            read_binary_column_<short>(buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "ushort"))
+            read_binary_column_<unsigned short>(
+                buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "int"))
+            read_binary_column_<int>(buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "uint"))
+            read_binary_column_<unsigned int>(
+                buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "char"))
+            read_binary_column_<char>(buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "uchar"))
+            read_binary_column_<unsigned char>(
+                buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "long"))
+            read_binary_column_<long>(buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "longlong"))
+            read_binary_column_<long long>(
+                buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "ulong"))
+            read_binary_column_<unsigned long>(
+                buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "ulonglong"))
+            read_binary_column_<unsigned long long>(
+                buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "string"))
+            read_binary_column_<std::string>(
+                buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "DateTime"))
+            read_binary_column_<DateTime>(buffer, buffer_size, desc, sr, er);
+        else if (! ::strcmp(desc.type, "bool"))
+            read_binary_column_<bool>(buffer, buffer_size, desc, sr, er);
+        else  {
+            String1K    err;
+
+            err.printf("DataFrame::read_binary_(): ERROR: Column '%s' has "
+                       "unsupported type <%s>", desc.name, desc.type);
+            throw DataFrameError(err.c_str());
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 bool DataFrame<I, H>::
 read (const char *file_name,
@@ -1169,6 +1740,25 @@ read (const char *file_name,
       size_type starting_row,
       size_type num_rows)  {
 
+    static_assert(std::is_base_of<HeteroVector<align_value>, DataVec>::value,
+                  "Only a StdDataFrame can call read()");
+
+    // Regular files are mapped. Anything else is read as a stream below
+    //
+    if (iof == io_format::binary || iof == io_format::csv2)  {
+        const _MappedFile_  file (file_name);
+
+        if (file.loaded)  {
+            if (iof == io_format::binary)
+                read_binary_(file.data, file.size,
+                             columns_only, starting_row, num_rows);
+            else
+                read_csv2_buffer_(file.data, file.size,
+                                  columns_only, starting_row, num_rows);
+            return (true);
+        }
+    }
+
     std::ifstream       stream;
     const IOStreamOpti  io_opti(stream, file_name);
 
@@ -1216,6 +1806,13 @@ read (S &in_s,
 
         read_json_ (in_s, columns_only);
     }
+    else if (iof == io_format::binary)  {
+        const std::string   buffer { std::istreambuf_iterator<char>(in_s),
+                                     std::istreambuf_iterator<char>() };
+
+        read_binary_(buffer.data(), buffer.size(),
+                     columns_only, starting_row, num_rows);
+    }
     else
         throw NotImplemented("read(): This io_format is not implemented");
 
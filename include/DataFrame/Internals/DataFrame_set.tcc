@@ -118,6 +118,7 @@ void DataFrame<I, H>::clear()  {
     indices_.clear();
     column_tb_.clear();
     column_list_.clear();
+    index_changed_();
     return;
 }
 
@@ -134,6 +135,10 @@ void DataFrame<I, H>::swap(DataFrame &other)  {
     indices_.swap(other.indices_);
     column_tb_.swap(other.column_tb_);
     column_list_.swap(other.column_list_);
+    idx_order_.store(
+        other.idx_order_.exchange(idx_order_.load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed),
+        std::memory_order_relaxed);
     return;
 }
 
@@ -246,6 +251,7 @@ DataFrame<I, H>::load_index(const ITR &begin, const ITR &end)  {
 
     indices_.clear();
     indices_.insert (indices_.end(), begin, end);
+    index_changed_();
     return (indices_.size());
 }
 
@@ -259,6 +265,7 @@ DataFrame<I, H>::load_index(IndexVecType &&idx)  {
                   "Only a StdDataFrame can call load_index()");
 
     indices_ = idx;
+    index_changed_();
     return (indices_.size());
 }
 
@@ -352,8 +359,10 @@ DataFrame<I, H>::append_index(Index2D<const ITR &> range)  {
                   "Only a StdDataFrame can call append_index()");
 
     const size_type s = std::distance(range.begin, range.end);
+    const size_type old_s = indices_.size();
 
     indices_.insert(indices_.end(), range.begin, range.end);
+    index_appended_(old_s);
     return (s);
 }
 
@@ -367,6 +376,7 @@ DataFrame<I, H>::append_index(const IndexType &val)  {
                   "Only a StdDataFrame can call append_index()");
 
     indices_.push_back (val);
+    index_appended_(indices_.size() - 1);
     return (1);
 }
 
@@ -902,8 +912,10 @@ DataFrame<I, H>::append_row (IndexType *idx_val, Ts&& ... args)  {
     static_assert(std::is_base_of<HeteroVector<align_value>, DataVec>::value,
                   "Only a StdDataFrame can call append_row()");
 
-    if (idx_val)
+    if (idx_val)  {
         indices_.push_back(*idx_val);
+        index_appended_(indices_.size() - 1);
+    }
 
     size_type   cnt = 1;
     auto        args_tuple =
@@ -926,6 +938,11 @@ void DataFrame<I, H>::remove_data_by_idx (Index2D<IndexType> range)  {
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call remove_data_by_idx()");
 
+    if (! is_index_sorted())  {
+        remove_data_by_sel_common_<Ts ...>(idx_range_rows_(range));
+        return;
+    }
+
     const auto  &lower =
         std::lower_bound (indices_.begin(), indices_.end(), range.begin);
     const auto  &upper =
@@ -939,10 +956,11 @@ void DataFrame<I, H>::remove_data_by_idx (Index2D<IndexType> range)  {
 
         make_consistent<Ts ...>();
         indices_.erase(lower, upper);
+        index_erased_();
 
         const auto      thread_level =
-            (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-                ? 0L : get_thread_level();
+            get_thread_level(indices_.size(), COPY_WORK,
+                             1, row_bytes_<Ts ...>());
         const SpinGuard guard(lock_);
 
         if (thread_level > 2)  {
@@ -955,7 +973,8 @@ void DataFrame<I, H>::remove_data_by_idx (Index2D<IndexType> range)  {
                         this->data_[citer->second].change(functor);
                 };
             auto    futures =
-                thr_pool_.parallel_loop(column_list_.begin(),
+                thr_pool_.parallel_loop(thread_level,
+                                        column_list_.begin(),
                                         column_list_.end(),
                                         std::move(lbd));
 
@@ -991,10 +1010,11 @@ void DataFrame<I, H>::remove_data_by_loc (Index2D<long> range)  {
         make_consistent<Ts ...>();
         indices_.erase(indices_.begin() + range.begin,
                        indices_.begin() + range.end);
+        index_erased_();
 
         const auto      thread_level =
-            (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-                ? 0L : get_thread_level();
+            get_thread_level(indices_.size(), COPY_WORK,
+                             1, row_bytes_<Ts ...>());
         const SpinGuard guard(lock_);
 
         if (thread_level > 2)  {
@@ -1008,7 +1028,8 @@ void DataFrame<I, H>::remove_data_by_loc (Index2D<long> range)  {
                         this->data_[citer->second].change(functor);
                 };
             auto    futures =
-                thr_pool_.parallel_loop(column_list_.begin(),
+                thr_pool_.parallel_loop(thread_level,
+                                        column_list_.begin(),
                                         column_list_.end(),
                                         std::move(lbd));
 
@@ -1038,19 +1059,15 @@ void DataFrame<I, H>::remove_data_by_loc (Index2D<long> range)  {
 
 template<typename I, typename H>
 template<typename T, typename F, typename ... Ts>
-void DataFrame<I, H>::remove_data_by_sel (const char *name, F &sel_functor)  {
+void DataFrame<I, H>::remove_data_by_sel (const char *name, F &sel_functor,
+                                          bool parallel)  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call remove_data_by_sel()");
 
     const ColumnVecType<T>  &vec = get_column<T>(name);
-    const size_type         col_s = vec.size();
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(indices_.size() / 2);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]
-        if (sel_functor (indices_[i], vec[i]))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, vec.size(), vec);
 
     remove_data_by_sel_common_<Ts ...>(col_indices);
     return;
@@ -1058,10 +1075,24 @@ void DataFrame<I, H>::remove_data_by_sel (const char *name, F &sel_functor)  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename ... Ts, typename ... Ps>
+void DataFrame<I, H>::remove_data_by_pred (const ColumnPred<Ps> & ... preds)  {
+
+    static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
+                  "Only a StdDataFrame can call remove_data_by_pred()");
+
+    remove_data_by_sel_common_<Ts ...>(get_pred_rows_(preds ...));
+    return;
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T1, typename T2, typename F, typename ... Ts>
 void DataFrame<I, H>::
-remove_data_by_sel (const char *name1, const char *name2, F &sel_functor)  {
+remove_data_by_sel (const char *name1, const char *name2, F &sel_functor,
+                    bool parallel)  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call remove_data_by_sel()");
@@ -1070,20 +1101,8 @@ remove_data_by_sel (const char *name1, const char *name2, F &sel_functor)  {
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         min_col_s = std::min(col_s1, col_s2);
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor (indices_[i], vec1[i], vec2[i]))
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i)
-        if (sel_functor (indices_[i],
-                         i < col_s1 ? vec1[i] : get_nan<T1>(),
-                         i < col_s2 ? vec2[i] : get_nan<T2>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2);
 
     remove_data_by_sel_common_<Ts ...>(col_indices);
     return;
@@ -1097,7 +1116,8 @@ void DataFrame<I, H>::
 remove_data_by_sel (const char *name1,
                     const char *name2,
                     const char *name3,
-                    F &sel_functor)  {
+                    F &sel_functor,
+                    bool parallel)  {
 
     static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
                   "Only a StdDataFrame can call remove_data_by_sel()");
@@ -1107,22 +1127,8 @@ remove_data_by_sel (const char *name1,
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
     const ColumnVecType<T3> &vec3 = get_column<T3>(name3, false);
     const size_type         idx_s = indices_.size();
-    const size_type         col_s1 = vec1.size();
-    const size_type         col_s2 = vec2.size();
-    const size_type         col_s3 = vec3.size();
-    const size_type         min_col_s = std::min({ col_s1, col_s2, col_s3 });
-    StlVecType<size_type>   col_indices;
-
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor (indices_[i], vec1[i], vec2[i], vec3[i]))
-            col_indices.push_back(i);
-    for (size_type i = min_col_s; i < idx_s; ++i)
-        if (sel_functor (indices_[i],
-                         i < col_s1 ? vec1[i] : get_nan<T1>(),
-                         i < col_s2 ? vec2[i] : get_nan<T2>(),
-                         i < col_s3 ? vec3[i] : get_nan<T3>()))
-            col_indices.push_back(i);
+    const auto              col_indices =
+        get_sel_indices_(sel_functor, parallel, idx_s, vec1, vec2, vec3);
 
     remove_data_by_sel_common_<Ts ...>(col_indices);
     return;
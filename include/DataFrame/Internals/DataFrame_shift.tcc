@@ -49,8 +49,8 @@ void DataFrame<I, H>::self_shift(size_type periods, shift_policy sp)  {
             vertical_shift_functor_<Ts ...> functor(periods, sp);
             const size_type                 num_cols = data_.size();
             const auto                      thread_level =
-                (indices_.size() < ThreadPool::MUL_THR_THHOLD)
-                    ? 0L : get_thread_level();
+                get_thread_level(indices_.size(), COPY_WORK,
+                                 1, row_bytes_<Ts ...>());
             const SpinGuard                 guard(lock_);
 
             if (thread_level > 2)  {
@@ -60,7 +60,8 @@ void DataFrame<I, H>::self_shift(size_type periods, shift_policy sp)  {
                             this->data_[idx].change(functor);
                     };
                 auto    futuers =
-                    thr_pool_.parallel_loop(size_type(0), num_cols,
+                    thr_pool_.parallel_loop(thread_level,
+                                            size_type(0), num_cols,
                                             std::move(lbd));
 
                 for (auto &fut : futuers)  fut.get();
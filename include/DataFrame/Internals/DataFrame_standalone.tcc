@@ -31,13 +31,24 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <DataFrame/Utils/DateTime.h>
 #include <DataFrame/Utils/Threads/ThreadGranularity.h>
+#include <DataFrame/Utils/Utils.h>
 
+#include <algorithm>
+#include <bit>
 #include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <future>
 #include <iostream>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <optional>
 #include <ranges>
 #include <set>
 #include <sstream>
@@ -45,6 +56,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#  include <emmintrin.h>
+#endif // __SSE2__ || _M_X64
+
+#ifndef _WIN32
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif // _WIN32
 
 // ----------------------------------------------------------------------------
 
@@ -187,297 +210,159 @@ _create_column_from_triple_(DF &df, T &triple) {
 
 // ----------------------------------------------------------------------------
 
-template<typename DF, typename T, typename I_V, typename V>
+// It aggregates src_vec into dst_vec[g] for every group g of the grouping
+// permutation sort_v, where grp_offs has the start of each group in sort_v
+// followed by the size of sort_v. Rows past the end of src_vec are not
+// passed to the visitor.
+//
+template<typename VIS, typename SI, typename SV, typename DV, typename SO>
 static inline void
-_load_groupby_data_1_(
-    const DF &source,
-    DF &dest,
-    T &triple,
-    I_V &&idx_visitor,
-    const V &input_col,
-    const typename DF::template StlVecType<std::size_t> &sort_v,
-    const char *col_name)  {
-
-    std::size_t         marker = 0;
-    auto                &dst_idx = dest.get_index();
-    const std::size_t   vec_size = input_col.size();
-    const auto          &src_idx = source.get_index();
+_groupby_visit_(VIS &visitor,
+                const SI &src_idx,
+                const SV &src_vec,
+                const SO &sort_v,
+                const SO &grp_offs,
+                DV &dst_vec)  {
+
+    const std::size_t   grp_s = grp_offs.size() - 1;
+    const std::size_t   src_s = src_vec.size();
+
+    dst_vec.resize(grp_s);
+    for (std::size_t grp = 0; grp < grp_s; ++grp) [[likely]]  {
+        visitor.pre();
+        for (std::size_t i = grp_offs[grp]; i < grp_offs[grp + 1]; ++i)  {
+            const std::size_t   row = sort_v[i];
 
-    if (dst_idx.empty())  {
-        using ColValueType = typename V::value_type;
-
-        auto    *col_vec =
-            ::strcmp(col_name, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType>(col_name))
-                : nullptr;
-
-        dst_idx.reserve(vec_size / 2 + 1);
-        if (col_vec)  col_vec->reserve(vec_size / 2 + 1);
-        for (std::size_t i = 0; i < vec_size; ++i)  {
-            if (input_col[sort_v[i]] != input_col[sort_v[marker]])  {
-                idx_visitor.pre();
-                for (std::size_t j = marker; j < i; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-                idx_visitor.post();
-                dst_idx.push_back(idx_visitor.get_result());
-                if (col_vec)  col_vec->push_back(input_col[sort_v[i - 1]]);
-                marker = i;
-            }
-        }
-        if (marker < vec_size || vec_size == 1)  {
-            idx_visitor.pre();
-            if (vec_size == 1)
-                idx_visitor(src_idx[sort_v[0]], src_idx[sort_v[0]]);
-            else
-                for (std::size_t j = marker; j < vec_size; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-            idx_visitor.post();
-            dst_idx.push_back(idx_visitor.get_result());
-            if (col_vec)  col_vec->push_back(input_col[sort_v[vec_size - 1]]);
+            if (row < src_s) [[likely]]
+                visitor(src_idx[row], src_vec[row]);
         }
-    }
-
-    using ValueType = typename std::tuple_element<2, T>::type::value_type;
-
-    const auto          &src_vec =
-        source.template get_column<ValueType>(std::get<0>(triple));
-    const std::size_t   max_count = std::min(vec_size, src_vec.size());
-    auto                &dst_vec = _create_column_from_triple_(dest, triple);
-    auto                &visitor = std::get<2>(triple);
-
-    dst_vec.reserve(max_count / 2 + 1);
-    marker = 0;
-    for (std::size_t i = 0; i < max_count; ++i) [[likely]]  {
-        if (input_col[sort_v[i]] != input_col[sort_v[marker]])  {
-            visitor.pre();
-            for (std::size_t j = marker; j < i; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-            visitor.post();
-            dst_vec.push_back(visitor.get_result());
-            marker = i;
-        }
-    }
-    if (marker < max_count || max_count == 1)  {
-        visitor.pre();
-        if (max_count == 1)
-            visitor(src_idx[sort_v[0]], src_vec[sort_v[0]]);
-        else
-            for (std::size_t j = marker; j < max_count; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
         visitor.post();
-        dst_vec.push_back(visitor.get_result());
+        dst_vec[grp] = visitor.get_result();
     }
 }
 
 // ----------------------------------------------------------------------------
 
-template<typename DF, typename T, typename I_V, typename V1, typename V2>
+// Same as above, but thread_level blocks of sort_v are visited in parallel by
+// copies of visitor. A group that spans more than one block is put together
+// from its partial visitors by merge(), in row order.
+//
+template<typename VIS, typename SI, typename SV, typename DV, typename SO>
 static inline void
-_load_groupby_data_2_(
-    const DF &source,
-    DF &dest,
-    T &triple,
-    I_V &&idx_visitor,
-    const V1 &input_col1,
-    const V2 &input_col2,
-    const typename DF::template StlVecType<std::size_t> &sort_v,
-    const char *col_name1,
-    const char *col_name2) {
-
-    std::size_t         marker = 0;
-    auto                &dst_idx = dest.get_index();
-    const std::size_t   vec_size =
-        std::min(input_col1.size(), input_col2.size());
-    const auto          &src_idx = source.get_index();
-
-    if (dst_idx.empty())  {
-        using ColValueType1 = typename V1::value_type;
-        using ColValueType2 = typename V2::value_type;
-
-        auto    *col_vec1 =
-            ::strcmp(col_name1, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType1>(col_name1))
-                : nullptr;
-        auto    *col_vec2 =
-            ::strcmp(col_name2, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType2>(col_name2))
-                : nullptr;
-
-        dst_idx.reserve(vec_size / 2 + 1);
-        if (col_vec1) col_vec1->reserve(vec_size / 2 + 1);
-        if (col_vec2) col_vec2->reserve(vec_size / 2 + 1);
-        for (std::size_t i = 0; i < vec_size; ++i)  {
-            if (input_col1[sort_v[i]] != input_col1[sort_v[marker]] ||
-                input_col2[sort_v[i]] != input_col2[sort_v[marker]])  {
-                idx_visitor.pre();
-                for (std::size_t j = marker; j < i; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-                idx_visitor.post();
-                dst_idx.push_back(idx_visitor.get_result());
-                if (col_vec1) col_vec1->push_back(input_col1[sort_v[i - 1]]);
-                if (col_vec2) col_vec2->push_back(input_col2[sort_v[i - 1]]);
-                marker = i;
+_groupby_visit_parallel_(VIS &visitor,
+                         const SI &src_idx,
+                         const SV &src_vec,
+                         const SO &sort_v,
+                         const SO &grp_offs,
+                         DV &dst_vec,
+                         long thread_level)  {
+
+    using visitor_t = std::remove_cvref_t<VIS>;
+    using partial_t = std::pair<std::size_t, visitor_t>;
+    using partials_t = std::vector<partial_t>;
+
+    const std::size_t   src_s = src_vec.size();
+
+    dst_vec.resize(grp_offs.size() - 1);
+
+    auto    lbd =
+        [&visitor, &src_idx, &src_vec, &sort_v, &grp_offs, &dst_vec, src_s]
+        (std::size_t begin, std::size_t end) -> partials_t  {
+            partials_t  partials;
+            visitor_t   vis = visitor;
+            std::size_t grp =
+                std::size_t(std::ranges::upper_bound(grp_offs, begin) -
+                            grp_offs.begin()) - 1;
+
+            for (std::size_t i = begin; i < end; ++grp)  {
+                const std::size_t   grp_end = std::min(grp_offs[grp + 1], end);
+
+                vis.pre();
+                for (; i < grp_end; ++i)  {
+                    const std::size_t   row = sort_v[i];
+
+                    if (row < src_s) [[likely]]
+                        vis(src_idx[row], src_vec[row]);
+                }
+                if (grp_offs[grp] >= begin && grp_offs[grp + 1] <= end)  {
+                    vis.post();
+                    dst_vec[grp] = vis.get_result();
+                }
+                else
+                    partials.emplace_back(grp, vis);
+            }
+            return (partials);
+        };
+    auto    futures =
+        ThreadGranularity::thr_pool_.parallel_loop(thread_level,
+                                                   std::size_t(0),
+                                                   sort_v.size(),
+                                                   std::move(lbd));
+
+    std::optional<visitor_t>    pending;
+    std::size_t                 pending_grp { 0 };
+
+    for (auto &fut : futures)  {
+        while (fut.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::timeout)
+            ThreadGranularity::thr_pool_.run_task();
+        for (auto &[grp, vis] : fut.get())  {
+            if (pending && pending_grp == grp)  {
+                pending->merge(vis);
+            }
+            else  {
+                if (pending)  {
+                    pending->post();
+                    dst_vec[pending_grp] = pending->get_result();
+                }
+                pending.emplace(std::move(vis));
+                pending_grp = grp;
             }
-        }
-        if (marker < vec_size || vec_size == 1)  {
-            idx_visitor.pre();
-            if (vec_size == 1)
-                idx_visitor(src_idx[sort_v[0]], src_idx[sort_v[0]]);
-            else
-                for (std::size_t j = marker; j < vec_size; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-            idx_visitor.post();
-            dst_idx.push_back(idx_visitor.get_result());
-            if (col_vec1) col_vec1->push_back(input_col1[sort_v[vec_size - 1]]);
-            if (col_vec2) col_vec2->push_back(input_col2[sort_v[vec_size - 1]]);
-        }
-    }
-
-    using ValueType = typename std::tuple_element<2, T>::type::value_type;
-
-    const auto          &src_vec =
-        source.template get_column<ValueType>(std::get<0>(triple));
-    const std::size_t   max_count = std::min(vec_size, src_vec.size());
-    auto                &dst_vec = _create_column_from_triple_(dest, triple);
-    auto                &visitor = std::get<2>(triple);
-
-    dst_vec.reserve(max_count / 2 + 1);
-    marker = 0;
-    for (std::size_t i = 0; i < max_count; ++i) [[likely]]  {
-        if (input_col1[sort_v[i]] != input_col1[sort_v[marker]] ||
-            input_col2[sort_v[i]] != input_col2[sort_v[marker]])  {
-            visitor.pre();
-            for (std::size_t j = marker; j < i; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-            visitor.post();
-            dst_vec.push_back(visitor.get_result());
-            marker = i;
         }
     }
-    if (marker < max_count || max_count == 1)  {
-        visitor.pre();
-        if (max_count == 1)
-            visitor(src_idx[sort_v[0]], src_vec[sort_v[0]]);
-        else
-            for (std::size_t j = marker; j < max_count; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-        visitor.post();
-        dst_vec.push_back(visitor.get_result());
+    if (pending)  {
+        pending->post();
+        dst_vec[pending_grp] = pending->get_result();
     }
 }
 
 // ----------------------------------------------------------------------------
 
-template<typename DF, typename T, typename I_V,
-         typename V1, typename V2, typename V3>
-static inline void
-_load_groupby_data_3_(
-    const DF &source,
-    DF &dest,
-    T &triple,
-    I_V &&idx_visitor,
-    const V1 &input_col1,
-    const V2 &input_col2,
-    const V3 &input_col3,
-    const typename DF::template StlVecType<std::size_t> &sort_v,
-    const char *col_name1,
-    const char *col_name2,
-    const char *col_name3) {
-
-    std::size_t         marker = 0;
-    auto                &dst_idx = dest.get_index();
-    const std::size_t   vec_size =
-        std::min({ input_col1.size(), input_col2.size(), input_col3.size() });
-    const auto          &src_idx = source.get_index();
-
-    if (dst_idx.empty())  {
-        using ColValueType1 = typename V1::value_type;
-        using ColValueType2 = typename V2::value_type;
-        using ColValueType3 = typename V3::value_type;
-
-        auto    *col_vec1 =
-            ::strcmp(col_name1, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType1>(col_name1))
-                : nullptr;
-        auto    *col_vec2 =
-            ::strcmp(col_name2, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType2>(col_name2))
-                : nullptr;
-        auto    *col_vec3 =
-            ::strcmp(col_name3, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType3>(col_name3))
-                : nullptr;
-
-        dst_idx.reserve(vec_size / 2 + 1);
-        if (col_vec1) col_vec1->reserve(vec_size / 2 + 1);
-        if (col_vec2) col_vec2->reserve(vec_size / 2 + 1);
-        if (col_vec3) col_vec3->reserve(vec_size / 2 + 1);
-        for (std::size_t i = 0; i < vec_size; ++i)  {
-            if (input_col1[sort_v[i]] != input_col1[sort_v[marker]] ||
-                input_col2[sort_v[i]] != input_col2[sort_v[marker]] ||
-                input_col3[sort_v[i]] != input_col3[sort_v[marker]])  {
-                idx_visitor.pre();
-                for (std::size_t j = marker; j < i; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-                idx_visitor.post();
-                dst_idx.push_back(idx_visitor.get_result());
-                if (col_vec1) col_vec1->push_back(input_col1[sort_v[i - 1]]);
-                if (col_vec2) col_vec2->push_back(input_col2[sort_v[i - 1]]);
-                if (col_vec3) col_vec3->push_back(input_col3[sort_v[i - 1]]);
-                marker = i;
-            }
-        }
-        if (marker < vec_size || vec_size == 1)  {
-            idx_visitor.pre();
-            if (vec_size == 1)
-                idx_visitor(src_idx[sort_v[0]], src_idx[sort_v[0]]);
-            else
-                for (std::size_t j = marker; j < vec_size; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-            idx_visitor.post();
-            dst_idx.push_back(idx_visitor.get_result());
-            if (col_vec1) col_vec1->push_back(input_col1[sort_v[vec_size - 1]]);
-            if (col_vec2) col_vec2->push_back(input_col2[sort_v[vec_size - 1]]);
-            if (col_vec3) col_vec3->push_back(input_col3[sort_v[vec_size - 1]]);
-        }
-    }
-
-    using ValueType = typename std::tuple_element<2, T>::type::value_type;
+// For a sorted src_idx, it returns where the by_distance buckets start.
+// Each bucket end is found by a binary search, instead of comparing every
+// index value against the bucket start. The last entry is the start of the
+// trailing bucket, which is never closed.
+//
+template<typename SI, typename V>
+static inline std::vector<std::size_t>
+_bucket_starts_(const SI &src_idx, const V &value)  {
 
-    const auto          &src_vec =
-        source.template get_column<ValueType>(std::get<0>(triple));
-    const std::size_t   max_count = std::min(vec_size, src_vec.size());
-    auto                &dst_vec = _create_column_from_triple_(dest, triple);
-    auto                &visitor = std::get<2>(triple);
+    using src_type = typename SI::value_type;
 
-    dst_vec.reserve(max_count / 2 + 1);
-    marker = 0;
-    for (std::size_t i = 0; i < max_count; ++i) [[likely]]  {
-        if (input_col1[sort_v[i]] != input_col1[sort_v[marker]] ||
-            input_col2[sort_v[i]] != input_col2[sort_v[marker]] ||
-            input_col3[sort_v[i]] != input_col3[sort_v[marker]])  {
-            visitor.pre();
-            for (std::size_t j = marker; j < i; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-            visitor.post();
-            dst_vec.push_back(visitor.get_result());
-            marker = i;
-        }
-    }
-    if (marker < max_count || max_count == 1)  {
-        visitor.pre();
-        if (max_count == 1)
-            visitor(src_idx[sort_v[0]], src_vec[sort_v[0]]);
-        else
-            for (std::size_t j = marker; j < max_count; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-        visitor.post();
-        dst_vec.push_back(visitor.get_result());
+    std::vector<std::size_t>    starts;
+    const auto                  begin = src_idx.begin();
+    const auto                  end = src_idx.end();
+    auto                        marker = begin;
+
+    while (marker != end)  {
+        const src_type  &marker_val = *marker;
+
+        starts.push_back(std::size_t(std::distance(begin, marker)));
+        marker =
+            std::partition_point(
+                marker + 1, end,
+                [&marker_val, &value](const src_type &val) -> bool  {
+                    return (! (val - marker_val >= src_type(value)));
+                });
     }
+    return (starts);
 }
 
 // ----------------------------------------------------------------------------
 
+// If starts is given, by_distance buckets are taken from it.
+// See _bucket_starts_()
+//
 template<typename DV, typename SI, typename SV, typename V, typename VIS>
 static inline void
 _bucketize_core_(DV &dst_vec,
@@ -486,12 +371,25 @@ _bucketize_core_(DV &dst_vec,
                  const V &value,
                  VIS &visitor,
                  std::size_t src_s,
-                 bucket_type bt)  {
+                 bucket_type bt,
+                 const std::vector<std::size_t> *starts)  {
 
     using src_type = typename SI::value_type;
 
     dst_vec.reserve(src_s / 5);
-    if (bt == bucket_type::by_distance)  {
+    if (bt == bucket_type::by_distance && starts)  {
+        const std::size_t   starts_s = starts->size();
+
+        for (std::size_t b = 1;
+             b < starts_s && (*starts)[b] < src_s; ++b) [[likely]]  {
+            visitor.pre();
+            for (std::size_t i = (*starts)[b - 1]; i < (*starts)[b]; ++i)
+                visitor(src_idx[i], src_vec[i]);
+            visitor.post();
+            dst_vec.push_back(visitor.get_result());
+        }
+    }
+    else if (bt == bucket_type::by_distance)  {
         std::size_t marker { 0 };
 
         visitor.pre();
@@ -526,6 +424,7 @@ _load_bucket_data_(const DF &source,
                    DF &dest,
                    const I &value,
                    bucket_type bt,
+                   const std::vector<std::size_t> *starts,
                    T &triple,
                    std::vector<std::future<void>> &futures) {
 
@@ -538,8 +437,9 @@ _load_bucket_data_(const DF &source,
     const std::size_t   src_s = std::min(src_vec.size(), src_idx.size());
     auto                &visitor = std::get<2>(triple);
     const auto          thread_level =
-        (src_idx.size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : ThreadGranularity::get_thread_level();
+        ThreadGranularity::get_thread_level(
+            src_idx.size(), ThreadGranularity::VISIT_WORK,
+            1, sizeof(ValueType));
 
     if (thread_level > 3)
         futures.emplace_back(
@@ -556,9 +456,11 @@ _load_bucket_data_(const DF &source,
                     std::cref(value),
                     std::ref(visitor),
                     src_s,
-                    bt));
+                    bt,
+                    starts));
     else
-        _bucketize_core_(dst_vec, src_idx, src_vec, value, visitor, src_s, bt);
+        _bucketize_core_(dst_vec, src_idx, src_vec, value, visitor,
+                         src_s, bt, starts);
 }
 
 // ----------------------------------------------------------------------------
@@ -633,6 +535,158 @@ _get_token_from_file_ (std::istream &file,
 
 // ----------------------------------------------------------------------------
 
+// Returns the first ',' or '\n' in [begin, end) or end. The bytes are
+// compared 16 at a time when SSE2 is available.
+//
+inline static const char *
+_find_csv_delim_(const char *begin, const char *end)  {
+
+#if defined(__SSE2__) || defined(_M_X64)
+    const __m128i   comma = _mm_set1_epi8(',');
+    const __m128i   newline = _mm_set1_epi8('\n');
+
+    while (end - begin >= 16)  {
+        const __m128i   chunk =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const int       mask =
+            _mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, comma),
+                             _mm_cmpeq_epi8(chunk, newline)));
+
+        if (mask != 0)  {
+#ifdef _MSC_VER
+            unsigned long   idx;
+
+            _BitScanForward(&idx, static_cast<unsigned long>(mask));
+            return (begin + idx);
+#else
+            return (begin + __builtin_ctz(static_cast<unsigned int>(mask)));
+#endif // _MSC_VER
+        }
+        begin += 16;
+    }
+#endif // __SSE2__ || _M_X64
+
+    while (begin < end && *begin != ',' && *begin != '\n')  begin += 1;
+    return (begin);
+}
+
+// ----------------------------------------------------------------------------
+
+// Returns the end of the first num_rows csv2 data rows in [begin, end) and
+// reduces num_rows by the number of rows found. A row ends with '\n'.
+// Comment lines do not count. Empty lines count, the same way read_csv2_()
+// counts them for num_rows, unless skip_empty is true.
+//
+inline static const char *
+_skip_csv2_rows_(const char *begin,
+                 const char *end,
+                 std::size_t &num_rows,
+                 bool skip_empty)  {
+
+    while (begin < end && num_rows > 0)  {
+        const char  *line_begin = begin;
+
+        while (line_begin < end &&
+               (*line_begin == '\r' || *line_begin == '\0'))
+            line_begin += 1;
+        if (line_begin >= end)  return (end);
+
+        const char  *nl = static_cast<const char *>(
+            ::memchr(line_begin, '\n', end - line_begin));
+
+        if (*line_begin != '#' && (! skip_empty || *line_begin != '\n'))
+            num_rows -= 1;
+        begin = nl ? nl + 1 : end;
+    }
+    return (begin);
+}
+
+// ----------------------------------------------------------------------------
+
+// Converts the characters in [begin, end) to a number exactly the way
+// strtol(value, nullptr, base), strtoul(), strtod(), ... would.
+// The common forms are parsed in place by std::from_chars. Anything else
+// (leading blanks or '+', octal/hex prefixes, out of range values, inf/nan)
+// is copied and handed to the C library function.
+//
+template<typename T>
+inline static T
+_atonum_(const char *begin, const char *end, int base = 0)  {
+
+    const char  *digits = begin;
+
+    if (digits < end && *digits == '-')  digits += 1;
+
+    bool    fast = digits < end;
+
+    if (fast)  {
+        const char  c = *digits;
+
+        if constexpr (std::is_floating_point_v<T>)
+            fast = (std::isdigit(static_cast<unsigned char>(c)) ||
+                    c == '.') &&
+                   ! (c == '0' && digits + 1 < end &&
+                      (digits[1] == 'x' || digits[1] == 'X'));
+        else
+            fast = std::isdigit(static_cast<unsigned char>(c)) &&
+                   (std::is_signed_v<T> || digits == begin) &&
+                   ! (base == 0 && c == '0' && digits + 1 < end &&
+                      (std::isdigit(static_cast<unsigned char>(digits[1])) ||
+                       digits[1] == 'x' || digits[1] == 'X'));
+    }
+
+    if (fast) [[likely]]  {
+        T   value { };
+
+        if constexpr (std::is_floating_point_v<T>)  {
+#ifdef __cpp_lib_to_chars
+            const auto  [ptr, ec] = std::from_chars(begin, end, value);
+
+            if (ec == std::errc { }) [[likely]]  return (value);
+#endif // __cpp_lib_to_chars
+        }
+        else  {
+            const auto  [ptr, ec] = std::from_chars(begin, end, value, 10);
+
+            if (ec == std::errc { }) [[likely]]  return (value);
+        }
+    }
+
+    char        local[64];
+    std::string heap;
+    const char  *value = local;
+    const auto  size = std::size_t(end - begin);
+
+    if (size < sizeof(local))  {
+        std::memcpy(local, begin, size);
+        local[size] = '\0';
+    }
+    else  {
+        heap.assign(begin, end);
+        value = heap.c_str();
+    }
+
+    if constexpr (std::is_same_v<T, float>)
+        return (std::strtof(value, nullptr));
+    else if constexpr (std::is_same_v<T, double>)
+        return (std::strtod(value, nullptr));
+    else if constexpr (std::is_same_v<T, long double>)
+        return (std::strtold(value, nullptr));
+    else if constexpr (std::is_same_v<T, long>)
+        return (std::strtol(value, nullptr, base));
+    else if constexpr (std::is_same_v<T, long long>)
+        return (std::strtoll(value, nullptr, base));
+    else if constexpr (std::is_same_v<T, unsigned long>)
+        return (std::strtoul(value, nullptr, base));
+    else if constexpr (std::is_same_v<T, unsigned long long>)
+        return (std::strtoull(value, nullptr, base));
+    else
+        static_assert(std::is_floating_point_v<T>, "Unsupported type");
+}
+
+// ----------------------------------------------------------------------------
+
 inline static std::vector<double>
 _get_dbl_vec_from_value_(const char *value)  {
 
@@ -877,6 +931,495 @@ inline static S &_write_csv_df_index_(S &o, unsigned char value)  {
 
 // ----------------------------------------------------------------------------
 
+// Appends value to buf exactly the way _write_csv_df_index_() writes it to
+// a stream with default flags and the given precision. If IS_INDEX, it is
+// written the way operator << writes it instead. Types that have no
+// to_chars() form are formatted by ss.
+//
+template<bool IS_INDEX, typename T>
+inline static void
+_append_csv2_value_(std::string &buf,
+                    const T &value,
+                    int precision,
+                    std::ostringstream &ss)  {
+
+    constexpr bool  is_char =
+        std::is_same_v<T, char> ||
+        std::is_same_v<T, signed char> ||
+        std::is_same_v<T, unsigned char>;
+
+    if constexpr (std::is_same_v<T, std::string>)  {
+        buf += value;
+    }
+    else if constexpr (std::is_same_v<T, bool>)  {
+        buf += value ? '1' : '0';
+    }
+    else if constexpr (is_char)  {
+        if constexpr (IS_INDEX || std::is_same_v<T, signed char>)
+            buf += static_cast<char>(value);
+        else if (std::isprint(value))
+            buf += static_cast<char>(value);
+        else if constexpr (std::is_same_v<T, char>)
+            _append_csv2_value_<IS_INDEX>(buf, static_cast<int>(value),
+                                          precision, ss);
+        else
+            _append_csv2_value_<IS_INDEX>(
+                buf, static_cast<unsigned int>(value), precision, ss);
+    }
+    else if constexpr ((std::is_integral_v<T> &&
+                        sizeof(T) >= sizeof(short)) ||
+                       std::is_floating_point_v<T>)  {
+        char    tmp[128];
+
+        if constexpr (std::is_floating_point_v<T>)  {
+            const auto  [ptr, ec] =
+                std::to_chars(tmp, tmp + sizeof(tmp), value,
+                              std::chars_format::general,
+                              precision < 0 ? 6 : precision);
+
+            if (ec == std::errc { }) [[likely]]  {
+                buf.append(tmp, ptr);
+                return;
+            }
+            ss << value;
+            buf += ss.view();
+            ss.str(std::string { });
+        }
+        else  {
+            const auto  [ptr, ec] =
+                std::to_chars(tmp, tmp + sizeof(tmp), value);
+
+            buf.append(tmp, ptr);
+        }
+    }
+    else if constexpr (std::is_same_v<T, DateTime> && ! IS_INDEX)  {
+        _append_csv2_value_<IS_INDEX>(buf, value.time(), precision, ss);
+        buf += '.';
+        _append_csv2_value_<IS_INDEX>(buf, value.nanosec(), precision, ss);
+    }
+    else  {
+        std::ostream    &os = ss;
+
+        if constexpr (IS_INDEX)
+            os << value;
+        else
+            _write_csv_df_index_(os, value);
+        buf += ss.view();
+        ss.str(std::string { });
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+//
+// io_format::binary
+//
+// A binary DataFrame file looks like this:
+//     <_bin_file_header_>
+//     <Data block of column 1> ... <Data block of column N>
+//     <Column directory: N _bin_col_desc_ entries>
+//     <_bin_file_footer_>
+// If the index is written, it is the first column in the directory. Every
+// data block starts at a file offset that is a multiple of the header
+// alignment. That alignment is never less than the DataFrame align_value,
+// so a mapped file has its column data aligned the same way columns are in
+// memory.
+// Arithmetic columns are stored as native arrays. bool columns take one
+// byte per value. DateTime columns are stored as _bin_datetime_ records.
+// String columns are stored as <count + 1> offsets into a string heap that
+// immediately follows the offsets. The directory is at the end, so a file
+// can be written to any stream in a single pass.
+//
+
+struct  _bin_file_header_  {
+
+    char            magic[8] { 'H', 'M', 'D', 'F', 'B', 'I', 'N', '1' };
+    std::uint32_t   version { 1 };
+    std::uint32_t   byte_order { 0x01020304 };
+    std::uint64_t   alignment { 0 };  // Alignment of all data blocks
+    std::uint64_t   reserved { 0 };
+};
+
+struct  _bin_col_desc_  {
+
+    char            name[64] { };
+    char            type[24] { };     // Same type names as csv2
+    std::uint64_t   count { 0 };
+    std::uint64_t   data_offset { 0 };
+    std::uint64_t   data_bytes { 0 };
+    std::uint64_t   heap_offset { 0 };  // Only for strings
+    std::uint64_t   heap_bytes { 0 };   // Only for strings
+};
+
+struct  _bin_file_footer_  {
+
+    std::uint64_t   dir_offset { 0 };
+    std::uint64_t   col_count { 0 };
+    char            magic[8] { 'H', 'M', 'D', 'F', 'E', 'N', 'D', '1' };
+};
+
+struct  _bin_datetime_  {
+
+    std::int64_t    time { 0 };
+    std::int32_t    nanosec { 0 };
+    std::int32_t    time_zone { 0 };
+};
+
+template<typename T>
+inline static constexpr bool    _bin_supported_type_ =
+    std::is_arithmetic_v<T> ||
+    std::is_same_v<T, DateTime> ||
+    std::is_same_v<T, std::string>;
+
+// ----------------------------------------------------------------------------
+
+template<typename S>
+inline static void
+_write_bin_bytes_(S &o,
+                  const void *data,
+                  std::size_t bytes,
+                  std::size_t &pos)  {
+
+    o.write(reinterpret_cast<const char *>(data), bytes);
+    pos += bytes;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename S>
+inline static void
+_write_bin_pad_(S &o, std::size_t alignment, std::size_t &pos)  {
+
+    static constexpr char   zeros[256] { };
+    std::size_t             pad = (alignment - pos % alignment) % alignment;
+
+    while (pad > 0)  {
+        const std::size_t   bytes = std::min(pad, sizeof(zeros));
+
+        _write_bin_bytes_(o, zeros, bytes, pos);
+        pad -= bytes;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// Writes the [start_row, end_row) range of vec as one column data block
+// (plus its string heap) and appends the column descriptor to dir.
+//
+template<typename S, typename V>
+inline static void
+_write_bin_col_(S &o,
+                const char *col_name,
+                const V &vec,
+                std::size_t start_row,
+                std::size_t end_row,
+                std::size_t alignment,
+                std::size_t &pos,
+                std::vector<_bin_col_desc_> &dir)  {
+
+    using ValueType = typename V::value_type;
+
+    const auto  &citer = _typeinfo_name_.find(typeid(ValueType));
+
+    if (! _bin_supported_type_<ValueType> ||
+        citer == _typeinfo_name_.end()) [[unlikely]]  {
+        String1K    err;
+
+        err.printf("write(): ERROR: io_format::binary does not support the "
+                   "type of column '%s'", col_name);
+        throw NotImplemented(err.c_str());
+    }
+
+    // A cut name could collide with another column when it is read back
+    //
+    if (::strlen(col_name) >= sizeof(_bin_col_desc_::name)) [[unlikely]]  {
+        String1K    err;
+
+        err.printf("write(): ERROR: Column name '%s' is longer than the %zu "
+                   "characters io_format::binary can store",
+                   col_name, sizeof(_bin_col_desc_::name) - 1);
+        throw DataFrameError(err.c_str());
+    }
+
+    if constexpr (_bin_supported_type_<ValueType>)  {
+        constexpr std::size_t   buf_size = 1024;
+        const std::size_t       vec_s = vec.size();
+        const std::size_t       sr = std::min(start_row, vec_s);
+        const std::size_t       er = std::min(end_row, vec_s);
+        const std::size_t       n = er > sr ? er - sr : 0;
+        _bin_col_desc_          desc;
+
+        ::strncpy(desc.name, col_name, sizeof(desc.name) - 1);
+        ::strncpy(desc.type, citer->second, sizeof(desc.type) - 1);
+        desc.count = n;
+        _write_bin_pad_(o, alignment, pos);
+        desc.data_offset = pos;
+
+        if constexpr (std::is_same_v<ValueType, bool>)  {
+            char    buffer[buf_size];
+
+            for (std::size_t i = sr; i < er; )  {
+                const std::size_t   bytes = std::min(buf_size, er - i);
+
+                for (std::size_t j = 0; j < bytes; ++j)
+                    buffer[j] = vec[i + j] ? 1 : 0;
+                _write_bin_bytes_(o, buffer, bytes, pos);
+                i += bytes;
+            }
+        }
+        else if constexpr (std::is_arithmetic_v<ValueType>)  {
+            if constexpr (requires { vec.data(); })  {
+                if (n > 0)
+                    _write_bin_bytes_(o, vec.data() + sr,
+                                      n * sizeof(ValueType), pos);
+            }
+            else  {  // Views are not necessarily contiguous
+                ValueType   buffer[buf_size];
+
+                for (std::size_t i = sr; i < er; )  {
+                    const std::size_t   cnt = std::min(buf_size, er - i);
+
+                    for (std::size_t j = 0; j < cnt; ++j)
+                        buffer[j] = vec[i + j];
+                    _write_bin_bytes_(o, buffer, cnt * sizeof(ValueType), pos);
+                    i += cnt;
+                }
+            }
+        }
+        else if constexpr (std::is_same_v<ValueType, DateTime>)  {
+            _bin_datetime_  buffer[buf_size];
+
+            for (std::size_t i = sr; i < er; )  {
+                const std::size_t   cnt = std::min(buf_size, er - i);
+
+                for (std::size_t j = 0; j < cnt; ++j)  {
+                    const DateTime  &dt = vec[i + j];
+
+                    buffer[j].time = dt.time();
+                    buffer[j].nanosec = dt.nanosec();
+                    buffer[j].time_zone =
+                        static_cast<std::int32_t>(dt.get_timezone());
+                }
+                _write_bin_bytes_(o, buffer, cnt * sizeof(_bin_datetime_), pos);
+                i += cnt;
+            }
+        }
+        else  {  // std::string
+            std::uint64_t   buffer[buf_size];
+            std::uint64_t   offset = 0;
+            std::size_t     cnt = 0;
+
+            buffer[cnt++] = offset;
+            for (std::size_t i = sr; i < er; ++i)  {
+                offset += vec[i].size();
+                buffer[cnt++] = offset;
+                if (cnt == buf_size)  {
+                    _write_bin_bytes_(o, buffer, cnt * sizeof(offset), pos);
+                    cnt = 0;
+                }
+            }
+            _write_bin_bytes_(o, buffer, cnt * sizeof(offset), pos);
+            desc.data_bytes = pos - desc.data_offset;
+            desc.heap_offset = pos;
+            desc.heap_bytes = offset;
+            for (std::size_t i = sr; i < er; ++i)
+                _write_bin_bytes_(o, vec[i].data(), vec[i].size(), pos);
+        }
+
+        if (desc.heap_offset == 0)
+            desc.data_bytes = pos - desc.data_offset;
+        dir.push_back(desc);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// Reads the [start_row, end_row) range of a column written by
+// _write_bin_col_() from a buffer that holds the whole file.
+//
+template<typename V>
+inline static void
+_read_bin_col_(const char *buffer,
+               std::size_t buffer_size,
+               const _bin_col_desc_ &desc,
+               std::size_t start_row,
+               std::size_t end_row,
+               V &vec)  {
+
+    using ValueType = typename V::value_type;
+
+    static_assert(_bin_supported_type_<ValueType>,
+                  "io_format::binary does not support this column type");
+
+    constexpr std::size_t   elem_size =
+        std::is_same_v<ValueType, bool>
+            ? 1
+            : std::is_same_v<ValueType, DateTime>
+                ? sizeof(_bin_datetime_)
+                : std::is_same_v<ValueType, std::string>
+                    ? sizeof(std::uint64_t) : sizeof(ValueType);
+    const std::size_t       min_bytes =
+        (desc.count + (std::is_same_v<ValueType, std::string> ? 1 : 0)) *
+        elem_size;
+    const auto              &citer = _typeinfo_name_.find(typeid(ValueType));
+
+    if (citer == _typeinfo_name_.end() ||
+        ::strcmp(citer->second, desc.type)) [[unlikely]]  {
+        String1K    err;
+
+        err.printf("DataFrame::read_binary_(): ERROR: Column '%s' of type "
+                   "<%s> cannot be read as <%s>",
+                   desc.name, desc.type,
+                   citer != _typeinfo_name_.end() ? citer->second : "N/A");
+        throw DataFrameError(err.c_str());
+    }
+    if (desc.data_offset > buffer_size ||
+        desc.data_bytes > buffer_size - desc.data_offset ||
+        desc.data_bytes < min_bytes ||
+        desc.heap_offset > buffer_size ||
+        desc.heap_bytes > buffer_size - desc.heap_offset) [[unlikely]]
+        throw DataFrameError("DataFrame::read_binary_(): ERROR: "
+                             "Column data block is out of the file bounds");
+
+    const char          *data = buffer + desc.data_offset;
+    const std::size_t   n = end_row - start_row;
+
+    vec.reserve(n);
+    if constexpr (std::is_same_v<ValueType, bool>)  {
+        for (std::size_t i = start_row; i < end_row; ++i)
+            vec.push_back(data[i] != 0);
+    }
+    else if constexpr (std::is_arithmetic_v<ValueType>)  {
+        const char  *src = data + start_row * sizeof(ValueType);
+
+        // Mapped files have aligned blocks, so this is a single bulk copy
+        //
+        if (reinterpret_cast<std::uintptr_t>(src) % alignof(ValueType) == 0)
+            vec.assign(reinterpret_cast<const ValueType *>(src),
+                       reinterpret_cast<const ValueType *>(src) + n);
+        else  {
+            vec.resize(n);
+            std::memcpy(vec.data(), src, n * sizeof(ValueType));
+        }
+    }
+    else if constexpr (std::is_same_v<ValueType, DateTime>)  {
+        _bin_datetime_  rec;
+        DateTime        dt;
+
+        for (std::size_t i = start_row; i < end_row; ++i)  {
+            std::memcpy(&rec, data + i * sizeof(rec), sizeof(rec));
+            if (static_cast<std::int32_t>(dt.get_timezone()) !=
+                    rec.time_zone)
+                dt = DateTime(static_cast<DT_TIME_ZONE>(rec.time_zone));
+            dt.set_time(rec.time, rec.nanosec);
+            vec.push_back(dt);
+        }
+    }
+    else  {  // std::string
+        const char      *heap = buffer + desc.heap_offset;
+        std::uint64_t   begin;
+        std::uint64_t   end;
+
+        std::memcpy(&begin, data + start_row * sizeof(begin), sizeof(begin));
+        for (std::size_t i = start_row; i < end_row; ++i)  {
+            std::memcpy(&end, data + (i + 1) * sizeof(end), sizeof(end));
+            if (end < begin || end > desc.heap_bytes) [[unlikely]]
+                throw DataFrameError("DataFrame::read_binary_(): ERROR: "
+                                     "Bad string heap offset");
+            vec.emplace_back(heap + begin, end - begin);
+            begin = end;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// A read-only image of a whole file. On POSIX systems the file is memory
+// mapped. Otherwise, it is read into memory.
+// Only a non-empty regular file is mapped. Anything else, e.g. a FIFO or
+// /dev/stdin, reports no size. Then loaded is false and the caller must read
+// the file as a stream.
+//
+struct  _MappedFile_  {
+
+    explicit
+    _MappedFile_ (const char *file_name)  {
+
+#ifndef _WIN32
+        struct stat st;
+
+        // Opening a FIFO would block or consume its data. So it is checked
+        // before the file is opened.
+        //
+        if (::stat(file_name, &st) != 0) [[unlikely]]  throw_error_(file_name);
+        if (! S_ISREG(st.st_mode) || st.st_size == 0)  return;
+
+        const int   fd = ::open(file_name, O_RDONLY);
+
+        if (fd < 0 || ::fstat(fd, &st) != 0) [[unlikely]]  {
+            if (fd >= 0)  ::close(fd);
+            throw_error_(file_name);
+        }
+        if (S_ISREG(st.st_mode) && st.st_size > 0)  {
+            void    *addr =
+                ::mmap(nullptr, std::size_t(st.st_size),
+                       PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (addr == MAP_FAILED) [[unlikely]]  {
+                ::close(fd);
+                throw_error_(file_name);
+            }
+            size = std::size_t(st.st_size);
+            ::madvise(addr, size, MADV_SEQUENTIAL);
+            data = static_cast<const char *>(addr);
+            loaded = true;
+        }
+        ::close(fd);
+#else
+        std::ifstream   stream (file_name, std::ios_base::binary);
+
+        if (stream.fail()) [[unlikely]]  throw_error_(file_name);
+        buffer_.assign(std::istreambuf_iterator<char>(stream),
+                       std::istreambuf_iterator<char>());
+        data = buffer_.data();
+        size = buffer_.size();
+        loaded = true;
+#endif // _WIN32
+    }
+
+    ~_MappedFile_ ()  {
+
+#ifndef _WIN32
+        if (data)
+            ::munmap(const_cast<char *>(data), size);
+#endif // _WIN32
+    }
+
+    _MappedFile_ () = delete;
+    _MappedFile_ (const _MappedFile_ &) = delete;
+    _MappedFile_ &operator = (const _MappedFile_ &) = delete;
+
+    const char  *data { nullptr };
+    std::size_t size { 0 };
+    bool        loaded { false };
+
+private:
+
+    [[noreturn]] static void throw_error_(const char *file_name)  {
+
+        String1K    err;
+
+        err.printf("read(): ERROR: Unable to open file '%s'", file_name);
+        throw DataFrameError(err.c_str());
+    }
+
+#ifdef _WIN32
+    std::string buffer_ { };
+#endif // _WIN32
+};
+
+// ----------------------------------------------------------------------------
+
 //
 // Specializing std::hash for tuples
 //
@@ -968,6 +1511,243 @@ _sort_by_sorted_index_(T &to_be_sorted,
 
 // ----------------------------------------------------------------------------
 
+// Sort key types that _radix_sort_() can sort
+//
+template<typename T>
+inline constexpr bool   _radix_sortable_ =
+    (std::is_arithmetic_v<T> && ! std::is_same_v<T, bool> &&
+     sizeof(T) <= sizeof(std::uint64_t)) ||
+    std::is_same_v<T, DateTime>;
+
+template<typename T>
+using _radix_key_t_ =
+    std::conditional_t<sizeof(T) == 1, std::uint8_t,
+    std::conditional_t<sizeof(T) == 2, std::uint16_t,
+    std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+// It maps a sort key to an unsigned integer, so that the order of mapped
+// keys is the order of keys under the given sort_spec
+//
+template<typename T>
+inline static _radix_key_t_<T>
+_to_radix_key_(const T &val, sort_spec dir)  {
+
+    using key_t = _radix_key_t_<T>;
+
+    constexpr key_t sign_bit = key_t(key_t(1) << (sizeof(key_t) * 8 - 1));
+    const bool      is_abs =
+        dir == sort_spec::abs_ascen || dir == sort_spec::abs_desce;
+    key_t           key;
+
+    if constexpr (std::is_same_v<T, DateTime>)
+        key = key_t(key_t(val.long_time()) ^ sign_bit);
+    else  {
+        const T v = is_abs ? T(abs__(val)) : val;
+
+        if constexpr (std::is_floating_point_v<T>)  {
+            const key_t bits = std::bit_cast<key_t>(v == T(0) ? T(0) : v);
+
+            key = (bits & sign_bit) ? key_t(~bits) : key_t(bits | sign_bit);
+        }
+        else if constexpr (std::is_signed_v<T>)
+            key = key_t(key_t(v) ^ sign_bit);
+        else
+            key = key_t(v);
+    }
+
+    if (dir == sort_spec::desce || dir == sort_spec::abs_desce)
+        key = key_t(~key);
+    return (key);
+}
+
+// ----------------------------------------------------------------------------
+
+// A mapped sort key and the row it came from
+//
+template<typename K, typename I>
+struct  _radix_item_  {
+
+    K   key;
+    I   idx;
+};
+
+// It stably sorts src[0, n) by the lowest digit_s 8-bit digits of the keys
+// and writes the idx of sorted items into out. dst is a scratch space of the
+// same size. It is a MSD radix sort that finishes small buckets with an
+// insertion sort.
+//
+template<typename K, typename I, typename O>
+static void
+_radix_msd_sort_(_radix_item_<K, I> *src,
+                 _radix_item_<K, I> *dst,
+                 std::size_t n,
+                 std::size_t digit_s,
+                 O *out)  {
+
+    constexpr std::size_t   radix = 256;
+    constexpr std::size_t   insertion_thhold = 32;
+
+    while (digit_s > 0 && n > insertion_thhold)  {
+        const std::size_t   shift = (digit_s - 1) * 8;
+        std::size_t         cnt[radix] = { };
+
+        for (std::size_t i = 0; i < n; ++i)
+            cnt[(src[i].key >> shift) & 0xFF] += 1;
+
+        digit_s -= 1;
+        if (cnt[(src[0].key >> shift) & 0xFF] == n)  continue;
+
+        std::size_t offsets[radix];
+        std::size_t sum = 0;
+
+        for (std::size_t r = 0; r < radix; ++r)  {
+            offsets[r] = sum;
+            sum += cnt[r];
+        }
+        for (std::size_t i = 0; i < n; ++i)
+            dst[offsets[(src[i].key >> shift) & 0xFF]++] = src[i];
+        for (std::size_t r = 0, begin = 0; r < radix; begin += cnt[r++])
+            if (cnt[r] > 0)
+                _radix_msd_sort_(dst + begin, src + begin, cnt[r], digit_s,
+                                 out + begin);
+        return;
+    }
+
+    if (digit_s > 0)  {
+        for (std::size_t i = 1; i < n; ++i)  {
+            const auto  item = src[i];
+            std::size_t j = i;
+
+            for ( ; j > 0 && item.key < src[j - 1].key; --j)
+                src[j] = src[j - 1];
+            src[j] = item;
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = O(src[i].idx);
+}
+
+// ----------------------------------------------------------------------------
+
+// It stably sorts sorting_idxs by keys[sorting_idxs[i]] in dir order.
+// The first pass is on the most significant digit that is not the same in
+// all keys. With thread_level > 2, it runs over blocks of rows and then over
+// the resulting buckets in parallel.
+//
+template<typename V, typename IV>
+static void
+_radix_sort_(const V &keys,
+             sort_spec dir,
+             IV &sorting_idxs,
+             long thread_level)  {
+
+    using key_t = _radix_key_t_<typename V::value_type>;
+    using idx_t = typename IV::value_type;
+    using item_t = _radix_item_<key_t, idx_t>;
+
+    constexpr std::size_t       radix = 256;
+    const std::size_t           idx_s = sorting_idxs.size();
+    const std::size_t           thr_cnt =
+        thread_level > 2 ? std::size_t(thread_level) : 1;
+    const std::size_t           block_s = (idx_s + thr_cnt - 1) / thr_cnt;
+    std::unique_ptr<item_t[]>   items(new item_t[idx_s]);
+    std::unique_ptr<item_t[]>   buffer(new item_t[idx_s]);
+    std::vector<key_t>          and_keys(thr_cnt, key_t(~key_t(0)));
+    std::vector<key_t>          or_keys(thr_cnt, key_t(0));
+    std::vector<std::size_t>    counts(thr_cnt * radix, 0);
+    auto                        in_parallel =
+        [thr_cnt](std::size_t n, auto &&lbd) -> void  {
+            if (thr_cnt > 1)  {
+                auto    futures =
+                    ThreadGranularity::thr_pool_.parallel_loop(
+                        long(thr_cnt), std::size_t(0), n,
+                        [&lbd](auto begin, auto end) -> void  {
+                            for (auto i = begin; i < end; ++i)  lbd(i);
+                        });
+
+                for (auto &fut : futures)  fut.get();
+            }
+            else
+                for (std::size_t i = 0; i < n; ++i)  lbd(i);
+        };
+
+    // Map the keys and find the bits that are not the same in all keys
+    //
+    in_parallel(thr_cnt, [&](std::size_t b) -> void  {
+        const std::size_t   end = std::min(idx_s, (b + 1) * block_s);
+        key_t               and_key = key_t(~key_t(0));
+        key_t               or_key = 0;
+
+        for (std::size_t i = b * block_s; i < end; ++i)  {
+            const idx_t idx = sorting_idxs[i];
+            const key_t key = _to_radix_key_(keys[idx], dir);
+
+            items[i] = { key, idx };
+            and_key &= key;
+            or_key |= key;
+        }
+        and_keys[b] = and_key;
+        or_keys[b] = or_key;
+    });
+
+    key_t   and_key = key_t(~key_t(0));
+    key_t   or_key = 0;
+
+    for (std::size_t b = 0; b < thr_cnt; ++b)  {
+        and_key &= and_keys[b];
+        or_key |= or_keys[b];
+    }
+
+    const key_t diff_bits = key_t(and_key ^ or_key);
+
+    if (diff_bits == 0)  return;  // All keys are equal. It is sorted
+
+    const std::size_t   msd = (std::bit_width(diff_bits) - 1) / 8;
+    const std::size_t   shift = msd * 8;
+
+    // First pass on the most significant digit from items to buffer
+    //
+    in_parallel(thr_cnt, [&](std::size_t b) -> void  {
+        const std::size_t   end = std::min(idx_s, (b + 1) * block_s);
+        std::size_t         *cnt = counts.data() + b * radix;
+
+        for (std::size_t i = b * block_s; i < end; ++i)
+            cnt[(items[i].key >> shift) & 0xFF] += 1;
+    });
+
+    std::vector<std::size_t>    offsets(thr_cnt * radix);
+    std::vector<std::size_t>    bucket_begins(radix + 1);
+    std::size_t                 total = 0;
+
+    for (std::size_t r = 0; r < radix; ++r)  {
+        bucket_begins[r] = total;
+        for (std::size_t b = 0; b < thr_cnt; ++b)  {
+            offsets[b * radix + r] = total;
+            total += counts[b * radix + r];
+        }
+    }
+    bucket_begins[radix] = total;
+    in_parallel(thr_cnt, [&](std::size_t b) -> void  {
+        const std::size_t   end = std::min(idx_s, (b + 1) * block_s);
+        std::size_t         *off = offsets.data() + b * radix;
+
+        for (std::size_t i = b * block_s; i < end; ++i)
+            buffer[off[(items[i].key >> shift) & 0xFF]++] = items[i];
+    });
+
+    // Sort each bucket by the rest of digits
+    //
+    in_parallel(radix, [&](std::size_t r) -> void  {
+        const std::size_t   begin = bucket_begins[r];
+
+        _radix_msd_sort_(buffer.get() + begin, items.get() + begin,
+                         bucket_begins[r + 1] - begin, msd,
+                         sorting_idxs.data() + begin);
+    });
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename T>
 inline static std::string _to_string_(const T &value)  {
 
@@ -1053,8 +1833,10 @@ _inv_merge_sort_(Con &original,
 
     if (right > left) {
         const auto  thr_lvl =
-            ((right - left) < (ThreadPool::MUL_THR_THHOLD / 2))
-                ? 0L : thread_level;
+            ThreadGranularity::get_thread_level(
+                right - left, ThreadGranularity::SORT_WORK,
+                1, sizeof(typename Con::value_type)) > 2
+                ? thread_level : 0L;
 
         // Divide the original into two parts and call _inv_merge_sort_()
         // for each of the parts
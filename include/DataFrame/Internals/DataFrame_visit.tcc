@@ -27,6 +27,8 @@ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <array>
+#include <cstring>
 #include <future>
 #include <tuple>
 
@@ -39,21 +41,92 @@ template<typename I, typename H>
 template<typename ... Ts>
 void DataFrame<I, H>::multi_visit (Ts ... args)  {
 
-    auto    args_tuple = std::tuple<Ts ...>(args ...);
-    auto    fc = [this](auto &pa) mutable -> void {
-        auto &functor = *(pa.second);
-
-        using T =
-            typename std::remove_reference<
-                decltype(functor)>::type::value_type;
-        using V =
-            typename std::remove_const<
-                typename std::remove_reference<decltype(functor)>::type>::type;
+    // Visitors on the same column are run in one pass over the column, a
+    // block of rows at a time. See FusedVisitor
+    //
+    constexpr size_type pair_cnt = sizeof ... (Ts);
+
+    // Each visitor with its column. The columns are looked up once
+    //
+    const std::tuple    jobs {
+        std::make_pair(
+            args.second,
+            &get_column<typename std::remove_reference_t<
+                            decltype(*(args.second))>::value_type>
+                (args.first)) ... };
+    const std::array<const char *, pair_cnt>    names { args.first ... };
+    const std::array<const void *, pair_cnt>    visitors {
+        static_cast<const void *>(args.second) ... };
+    const std::array<size_type, pair_cnt>       block_rows {
+        FusedVisitor<std::remove_reference_t<
+            decltype(*(args.second))>>::block_rows ... };
+    std::array<size_type, pair_cnt>             groups;  // First pair on
+                                                         // each column
+
+    // A visitor that is given more than once is only run on the column of
+    // its last pair. Running the pairs one by one leaves it in that state.
+    //
+    for (size_type i = 0; i < pair_cnt; ++i)  {
+        groups[i] = i;
+        for (size_type j = i + 1; j < pair_cnt; ++j)
+            if (visitors[j] == visitors[i])  {
+                groups[i] = pair_cnt;  // Not run
+                break;
+            }
+        if (groups[i] == pair_cnt)  continue;
+        for (size_type j = 0; j < i; ++j)
+            if (groups[j] != pair_cnt && ! std::strcmp(names[j], names[i]))  {
+                groups[i] = j;
+                break;
+            }
+    }
 
-        this->visit<T, V>(pa.first, functor);
-    };
+    const size_type idx_s = indices_.size();
 
-    for_each_in_tuple (args_tuple, fc);
+    for (size_type group = 0; group < pair_cnt; ++group)  {
+        if (groups[group] != group)  continue;
+
+        const auto  for_each_in_group =
+            [&jobs, &groups, group](auto &&func) -> void  {
+                size_type   i = 0;
+
+                for_each_in_tuple(jobs,
+                                  [&groups, group, &func, &i]
+                                  (const auto &job) -> void  {
+                                      if (groups[i++] == group)
+                                          func(*(job.first), *(job.second));
+                                  });
+            };
+        const size_type blk_rows = block_rows[group];
+
+        for_each_in_group([](auto &functor, const auto &) -> void  {
+            functor.pre();
+        });
+        for (size_type b = 0; b < idx_s; b += blk_rows)  {
+            const size_type e = std::min(b + blk_rows, idx_s);
+
+            for_each_in_group([this, b, e](auto &functor,
+                                           const auto &vec) -> void  {
+                using T =
+                    typename std::remove_reference_t<decltype(vec)>::value_type;
+
+                const size_type min_e = std::min<size_type>(e, vec.size());
+                size_type       i = b;
+
+                for (; i < min_e; ++i) [[likely]]
+                    functor (indices_[i], vec[i]);
+                if (i < e)  {
+                    const T nan_val = get_nan<T>();
+
+                    for (; i < e; ++i)
+                        functor (indices_[i], nan_val);
+                }
+            });
+        }
+        for_each_in_group([](auto &functor, const auto &) -> void  {
+            functor.post();
+        });
+    }
     return;
 }
 
@@ -255,6 +328,68 @@ visit_async(const char *name1,
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename T, mergeable_visitor V>
+V &DataFrame<I, H>::parallel_visit (const char *name, V &visitor) const  {
+
+    const auto      &vec = get_column<T>(name);
+    const size_type min_s = std::min<size_type>(vec.size(), indices_.size());
+    const T         nan_val = get_nan<T>();
+
+    return (parallel_visit_(
+        visitor,
+        sizeof(IndexType) + sizeof(T),
+        [this, &vec, min_s, &nan_val]
+        (V &vis, size_type begin, size_type end) -> void  {
+            const size_type min_e = std::min(end, min_s);
+            size_type       i = begin;
+
+            for (; i < min_e; ++i) [[likely]]
+                vis (indices_[i], vec[i]);
+            for (; i < end; ++i)
+                vis (indices_[i], nan_val);
+        }));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T1, typename T2, mergeable_visitor V>
+V &DataFrame<I, H>::
+parallel_visit (const char *name1, const char *name2, V &visitor) const  {
+
+    SpinGuard   guard (lock_);
+    const auto  &vec1 = get_column<T1>(name1, false);
+    const auto  &vec2 = get_column<T2>(name2, false);
+
+    guard.release();
+
+    const size_type data_s1 = vec1.size();
+    const size_type data_s2 = vec2.size();
+    const size_type min_s =
+        std::min<size_type>({ indices_.size(), data_s1, data_s2 });
+    const T1        nan_val1 = get_nan<T1>();
+    const T2        nan_val2 = get_nan<T2>();
+
+    return (parallel_visit_(
+        visitor,
+        sizeof(IndexType) + sizeof(T1) + sizeof(T2),
+        [this, &vec1, &vec2, data_s1, data_s2, min_s, &nan_val1, &nan_val2]
+        (V &vis, size_type begin, size_type end) -> void  {
+            const size_type min_e = std::min(end, min_s);
+            size_type       i = begin;
+
+            for (; i < min_e; ++i) [[likely]]
+                vis (indices_[i], vec1[i], vec2[i]);
+            for (; i < end; ++i)
+                vis (indices_[i],
+                     i < data_s1 ? vec1[i] : nan_val1,
+                     i < data_s2 ? vec2[i] : nan_val2);
+        }));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T1, typename T2, typename T3, typename V>
 V &DataFrame<I, H>::
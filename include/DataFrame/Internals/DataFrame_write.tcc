@@ -47,6 +47,10 @@ write(const char *file_name,
       long max_recs) const  {
 
     std::ofstream       stream;
+
+    if (iof == io_format::binary)
+        stream.open(file_name, std::ios_base::out | std::ios_base::binary);
+
     const IOStreamOpti  io_opti(stream, file_name);
 
     if (stream.fail()) [[unlikely]]  {
@@ -85,7 +89,8 @@ write(S &o,
 
     if (iof != io_format::csv &&
         iof != io_format::json &&
-        iof != io_format::csv2)
+        iof != io_format::csv2 &&
+        iof != io_format::binary)
         throw NotImplemented("write(): This io_format is not implemented");
 
     bool    need_pre_comma = false;
@@ -97,6 +102,11 @@ write(S &o,
     else
         start_row = std::max(long(0), end_row + max_recs);
 
+    if (iof == io_format::binary)  {
+        write_binary_<S, Ts ...>(o, columns_only, start_row, end_row);
+        return (true);
+    }
+
     o.precision(precision);
     if (iof == io_format::json)  {
         o << "{\n";
@@ -172,6 +182,16 @@ write(S &o,
         }
         o << '\n';
 
+        // Streams with default flags take the buffered writer. Otherwise,
+        // write cell by cell, so the stream formats the values.
+        //
+        if (o.flags() == (std::ios_base::skipws | std::ios_base::dec))  {
+            write_csv2_data_<S, Ts ...>(o, columns_only,
+                                        start_row, end_row, precision);
+            o << std::endl;
+            return (true);
+        }
+
         need_pre_comma = false;
         for (long i = start_row; i < end_row; ++i)  {
             size_type   count = 0;
@@ -204,6 +224,195 @@ write(S &o,
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename V, bool IS_INDEX>
+void DataFrame<I, H>::
+csv2_format_cells_(const void *vec,
+                   size_type begin,
+                   size_type end,
+                   int precision,
+                   csv2_cell_buf_ &cells)  {
+
+    const V         &col = *static_cast<const V *>(vec);
+    const size_type col_s = col.size();
+
+    cells.ss.precision(precision);
+    for (size_type i = begin; i < end; ++i)  {
+        if (i < col_s) [[likely]]
+            _append_csv2_value_<IS_INDEX>(cells.text, col[i],
+                                          precision, cells.ss);
+        cells.ends.push_back(cells.text.size());
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+void DataFrame<I, H>::
+write_csv2_rows_(const StlVecType<csv2_col_writer_> &cols,
+                 size_type begin,
+                 size_type end,
+                 int precision,
+                 StlVecType<csv2_cell_buf_> &cells,
+                 std::string &out)  {
+
+    // Format a batch of rows column by column, so each column's values are
+    // read sequentially. Then interleave the cells into rows.
+    //
+    constexpr size_type batch_s = 1024;
+    const size_type     col_s = cols.size();
+
+    for (size_type b = begin; b < end; b += batch_s)  {
+        const size_type e = std::min(b + batch_s, end);
+
+        for (size_type c = 0; c < col_s; ++c)  {
+            csv2_cell_buf_  &cell = cells[c];
+
+            cell.text.clear();
+            cell.ends.clear();
+            if (cols[c].format) [[likely]]
+                cols[c].format(cols[c].vec, b, e, precision, cell);
+            else
+                cell.ends.resize(e - b, 0);
+        }
+        for (size_type r = 0; r < e - b; ++r)  {
+            for (size_type c = 0; c < col_s; ++c)  {
+                const csv2_cell_buf_    &cell = cells[c];
+                const size_type         cell_b = r > 0 ? cell.ends[r - 1] : 0;
+
+                if (c > 0)  out += ',';
+                out.append(cell.text.data() + cell_b,
+                           cell.ends[r] - cell_b);
+            }
+            out += '\n';
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename S, typename ... Ts>
+void DataFrame<I, H>::
+write_csv2_data_(S &o,
+                 bool columns_only,
+                 long start_row,
+                 long end_row,
+                 std::streamsize precision) const  {
+
+    using index_vec_t = std::remove_cvref_t<decltype(indices_)>;
+
+    StlVecType<csv2_col_writer_>    cols;
+
+    cols.reserve(column_list_.size() + 1);
+    if (! columns_only)
+        cols.push_back(
+            csv2_col_writer_ {
+                &indices_,
+                &DataFrame::template csv2_format_cells_<index_vec_t, true> });
+    for (const auto &citer : column_list_) [[likely]]  {
+        csv2_col_writer_                    writer;
+        csv2_col_writer_functor_<Ts ...>    functor (writer);
+
+        data_[citer.second].change(functor);
+        cols.push_back(writer);
+    }
+
+    // Each block of rows is formatted into its own buffer and written with
+    // one call. With enough cells and a thread level above 2, a round of
+    // blocks is formatted in parallel, one block per thread, and written in
+    // order.
+    //
+    constexpr size_type block_s = 16 * 1024;
+    const size_type     row_s = end_row > start_row ? end_row - start_row : 0;
+    const size_type     row_bytes =
+        row_bytes_<Ts ...>() + (columns_only ? 0 : sizeof(IndexType));
+    const size_type     thr_lvl =
+        get_thread_level(row_s, VISIT_WORK, 1, row_bytes);
+    const size_type     thr_cnt =
+        thr_lvl > 2
+            ? std::min(thr_lvl, (row_s + block_s - 1) / block_s)
+            : size_type(1);
+    const int           prec = static_cast<int>(precision);
+
+    StlVecType<std::string>                 outs (thr_cnt);
+    StlVecType<StlVecType<csv2_cell_buf_>>  cells (thr_cnt);
+
+    for (auto &cell : cells)  cell.resize(cols.size());
+    for (size_type r = start_row; r < size_type(end_row);
+         r += block_s * thr_cnt)  {
+        auto    lbd =
+            [r, last = size_type(end_row), prec, &cols, &cells, &outs]
+            (size_type t) -> void  {
+                const size_type b = std::min(r + t * block_s, last);
+                const size_type e = std::min(b + block_s, last);
+
+                outs[t].clear();
+                write_csv2_rows_(cols, b, e, prec, cells[t], outs[t]);
+            };
+
+        if (thr_cnt > 1)  {
+            std::vector<std::future<void>>  futures;
+
+            futures.reserve(thr_cnt);
+            for (size_type t = 0; t < thr_cnt; ++t)
+                futures.emplace_back(thr_pool_.dispatch(false, lbd, t));
+            for (auto &fut : futures)  fut.get();
+        }
+        else
+            lbd(0);
+
+        for (const auto &out : outs)
+            o.write(out.data(), out.size());
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename S, typename ... Ts>
+void DataFrame<I, H>::
+write_binary_(S &o, bool columns_only, long start_row, long end_row) const  {
+
+    _bin_file_header_           header;
+    _bin_file_footer_           footer;
+    std::vector<_bin_col_desc_> dir;
+    std::size_t                 pos = 0;
+
+    header.alignment =
+        std::max(std::size_t(align_value), alignof(std::max_align_t));
+    dir.reserve(column_list_.size() + 1);
+    _write_bin_bytes_(o, &header, sizeof(header), pos);
+    if (! columns_only)
+        _write_bin_col_(o, DF_INDEX_COL_NAME, indices_,
+                        start_row, end_row, header.alignment, pos, dir);
+
+    {
+        const SpinGuard guard(lock_);
+
+        for (const auto &[name, idx] : column_list_) [[likely]]  {
+            print_binary_functor_<S, Ts ...>    functor (name.c_str(),
+                                                         o,
+                                                         start_row,
+                                                         end_row,
+                                                         header.alignment,
+                                                         pos,
+                                                         dir);
+
+            data_[idx].change(functor);
+        }
+    }
+
+    _write_bin_pad_(o, alignof(_bin_col_desc_), pos);
+    footer.dir_offset = pos;
+    footer.col_count = dir.size();
+    _write_bin_bytes_(o, dir.data(), dir.size() * sizeof(_bin_col_desc_), pos);
+    _write_bin_bytes_(o, &footer, sizeof(footer), pos);
+    o.flush();
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename ... Ts>
 std::future<bool> DataFrame<I, H>::
@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iterator>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 // ----------------------------------------------------------------------------
 
@@ -117,6 +118,18 @@ concept bidirectional_iterator =
 
 // ----------------------------------------------------------------------------
 
+// An iterator over contiguous arithmetic items of type T. Visitors scan such
+// ranges with the reduction kernels (see ReduceKernels.h)
+//
+template<typename H, typename T>
+concept contiguous_arithmetic =
+    std::contiguous_iterator<H> &&
+    std::is_arithmetic_v<T> &&
+    ! std::same_as<T, bool> &&
+    std::same_as<std::iter_value_t<H>, T>;
+
+// ----------------------------------------------------------------------------
+
 template<typename T>
 concept hashable = requires (const std::remove_reference_t<T> &a)  {
     { std::hash<T>{}(a) } -> std::convertible_to<std::size_t>;
@@ -140,6 +153,27 @@ concept has_result = requires (const std::remove_reference_t<T> &a)  {
     typename T::result_type;
 };
 
+// A visitor that can combine the partial state of another visitor of the
+// same type. Both visitors had pre() called and visited disjoint runs of
+// data, the other one's run after this one's. post() is called after merge.
+//
+template<typename T>
+concept mergeable_visitor =
+    requires (std::remove_reference_t<T> &a,
+              const std::remove_reference_t<T> &b)  {
+        { a.merge(b) };
+    };
+
+// A mergeable_visitor that can only be merged in some configurations, e.g. a
+// CorrVisitor can only merge pearson correlations.
+//
+template<typename T>
+concept conditionally_mergeable =
+    mergeable_visitor<T> &&
+    requires (const std::remove_reference_t<T> &v)  {
+        { v.can_merge() } -> std::convertible_to<bool>;
+    };
+
 // ----------------------------------------------------------------------------
 
 template<typename F, typename U, typename V>
@@ -201,6 +235,52 @@ concept StringOnly =
     std::is_same_v<T, char *> ||
     std::is_same_v<T, const char *>;
 
+// ----------------------------------------------------------------------------
+
+// A visitor that can update its result incrementally, as values enter and
+// leave a rolling window. After add()/remove() calls, post() and
+// get_result() give the result for the values currently in the window.
+//
+template<typename V>
+concept rolling_updatable =
+    requires (V &v,
+              const typename V::index_type &idx,
+              const typename V::value_type &val)  {
+    v.add(idx, val);
+    v.remove(idx, val);
+};
+
+// ----------------------------------------------------------------------------
+
+// A rolling_updatable visitor that can tell when remove() has cost it too
+// much precision. Then its state is rebuilt from the values in the window.
+//
+template<typename V>
+concept rolling_rebuildable =
+    rolling_updatable<V> &&
+    requires (const V &v)  {
+    { v.lost_precision() } -> std::convertible_to<bool>;
+};
+
+// ----------------------------------------------------------------------------
+
+// A visitor that takes one data item at a time
+//
+template<typename V>
+concept one_by_one_visitor =
+    requires (V &v,
+              const typename V::index_type &idx,
+              const typename V::value_type &val)  {
+    v(idx, val);
+};
+
+// A visitor that needs the whole column. Its one-by-one operator only
+// buffers the data, for the range operator to run in post().
+// See OBO_PORT_OPT
+//
+template<typename V>
+concept obo_ported_visitor = requires { typename V::obo_ported; };
+
 } // namespace hmdf
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,386 @@
+// Hossein Moein
+// October 17 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Sorted multiset of arithmetic values with O(log n) insert, erase,
+// select (n-th smallest), rank and prefix sum. It is the order statistic
+// structure behind the rolling median, quantile, MAD and rank visitors.
+//
+// Every link, at every level, knows how many items it skips over (its width)
+// and the sum of them. Nodes live in flat vectors and are recycled through
+// a free list, so a rolling window allocates only while it grows.
+//
+template <typename T>
+class IndexableSkipList  {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+    explicit
+    IndexableSkipList(size_type expected_size = 0)
+        : levels_(std::min(size_type(std::bit_width(expected_size)) + 1,
+                           size_type(32)))  {
+
+        values_.reserve(expected_size + 1);
+        heights_.reserve(expected_size + 1);
+        next_.reserve((expected_size + 1) * levels_);
+        width_.reserve((expected_size + 1) * levels_);
+        sum_.reserve((expected_size + 1) * levels_);
+        clear();
+    }
+
+    [[nodiscard]] inline size_type size() const noexcept  { return (size_); }
+    [[nodiscard]] inline bool empty() const noexcept  { return (size_ == 0); }
+
+    inline void clear()  {
+
+        values_.clear();
+        heights_.clear();
+        next_.clear();
+        width_.clear();
+        sum_.clear();
+        free_.clear();
+        size_ = 0;
+        new_node_(value_type { }, levels_);  // Head
+    }
+
+    void insert(const value_type &val)  {
+
+        size_type   chain[32];
+        size_type   chain_rank[32];
+        value_type  chain_sum[32];
+        size_type   node { head_ };
+        size_type   rank { 0 };
+        value_type  psum { 0 };
+
+        for (size_type lvl = levels_; lvl-- > 0; )  {
+            size_type   nxt = next_[at_(node, lvl)];
+
+            while (nxt != npos_ && values_[nxt] <= val)  {
+                rank += width_[at_(node, lvl)];
+                psum += sum_[at_(node, lvl)];
+                node = nxt;
+                nxt = next_[at_(node, lvl)];
+            }
+            chain[lvl] = node;
+            chain_rank[lvl] = rank;
+            chain_sum[lvl] = psum;
+        }
+
+        const size_type height = random_height_();
+        const size_type new_rank = chain_rank[0] + 1;
+        const size_type new_node = new_node_(val, height);
+
+        for (size_type lvl = 0; lvl < height; ++lvl)  {
+            const size_type     prev = at_(chain[lvl], lvl);
+            const size_type     curr = at_(new_node, lvl);
+            const value_type    skipped = chain_sum[0] - chain_sum[lvl];
+
+            next_[curr] = next_[prev];
+            width_[curr] = chain_rank[lvl] + width_[prev] + 1 - new_rank;
+            sum_[curr] = sum_[prev] - skipped;
+            next_[prev] = new_node;
+            width_[prev] = new_rank - chain_rank[lvl];
+            sum_[prev] = skipped + val;
+        }
+        for (size_type lvl = height; lvl < levels_; ++lvl)  {
+            width_[at_(chain[lvl], lvl)] += 1;
+            sum_[at_(chain[lvl], lvl)] += val;
+        }
+        size_ += 1;
+    }
+
+    // It erases one item equal to val. It returns false, if there was none
+    //
+    bool erase(const value_type &val)  {
+
+        size_type   chain[32];
+        size_type   node { head_ };
+
+        for (size_type lvl = levels_; lvl-- > 0; )  {
+            size_type   nxt = next_[at_(node, lvl)];
+
+            while (nxt != npos_ && values_[nxt] < val)  {
+                node = nxt;
+                nxt = next_[at_(node, lvl)];
+            }
+            chain[lvl] = node;
+        }
+
+        const size_type target = next_[at_(chain[0], 0)];
+
+        if (target == npos_ || values_[target] != val)  return (false);
+
+        const size_type height = heights_[target];
+
+        for (size_type lvl = 0; lvl < height; ++lvl)  {
+            const size_type prev = at_(chain[lvl], lvl);
+            const size_type curr = at_(target, lvl);
+
+            next_[prev] = next_[curr];
+            width_[prev] += width_[curr] - 1;
+            sum_[prev] += sum_[curr] - val;
+        }
+        for (size_type lvl = height; lvl < levels_; ++lvl)  {
+            width_[at_(chain[lvl], lvl)] -= 1;
+            sum_[at_(chain[lvl], lvl)] -= val;
+        }
+        free_.push_back(target);
+        size_ -= 1;
+        return (true);
+    }
+
+    // The n-th smallest item, starting from 0. n must be < size()
+    //
+    [[nodiscard]] const value_type &operator[] (size_type n) const  {
+
+        const size_type target = n + 1;
+        size_type       node { head_ };
+        size_type       rank { 0 };
+
+        for (size_type lvl = levels_; lvl-- > 0; )  {
+            while (next_[at_(node, lvl)] != npos_ &&
+                   rank + width_[at_(node, lvl)] <= target)  {
+                rank += width_[at_(node, lvl)];
+                node = next_[at_(node, lvl)];
+            }
+        }
+        return (values_[node]);
+    }
+
+    // Number of items < val
+    //
+    [[nodiscard]] inline size_type
+    count_less(const value_type &val) const  { return (rank_<false>(val)); }
+
+    // Number of items <= val
+    //
+    [[nodiscard]] inline size_type
+    count_less_equal(const value_type &val) const  {
+
+        return (rank_<true>(val));
+    }
+
+    // Sum of the n smallest items. n must be <= size()
+    //
+    [[nodiscard]] value_type sum_smallest(size_type n) const  {
+
+        size_type   node { head_ };
+        size_type   rank { 0 };
+        value_type  psum { 0 };
+
+        for (size_type lvl = levels_; lvl-- > 0; )  {
+            while (next_[at_(node, lvl)] != npos_ &&
+                   rank + width_[at_(node, lvl)] <= n)  {
+                rank += width_[at_(node, lvl)];
+                psum += sum_[at_(node, lvl)];
+                node = next_[at_(node, lvl)];
+            }
+        }
+        return (psum);
+    }
+
+private:
+
+    static constexpr size_type  npos_ = std::numeric_limits<size_type>::max();
+    static constexpr size_type  head_ = 0;
+
+    inline size_type at_(size_type node, size_type lvl) const noexcept  {
+
+        return (node * levels_ + lvl);
+    }
+
+    inline size_type new_node_(const value_type &val, size_type height)  {
+
+        size_type   node;
+
+        if (! free_.empty())  {
+            node = free_.back();
+            free_.pop_back();
+            values_[node] = val;
+            heights_[node] = static_cast<unsigned char>(height);
+        }
+        else  {
+            node = values_.size();
+            values_.push_back(val);
+            heights_.push_back(static_cast<unsigned char>(height));
+            next_.resize(next_.size() + levels_, npos_);
+            width_.resize(width_.size() + levels_, 0);
+            sum_.resize(sum_.size() + levels_, value_type { 0 });
+        }
+        for (size_type lvl = 0; lvl < levels_; ++lvl)  {
+            next_[at_(node, lvl)] = npos_;
+            width_[at_(node, lvl)] = size_ + 1;  // Width to the end
+            sum_[at_(node, lvl)] = value_type { 0 };
+        }
+        return (node);
+    }
+
+    // Geometric heights with p = 1/2, from a xorshift generator
+    //
+    inline size_type random_height_() noexcept  {
+
+        rand_state_ ^= rand_state_ << 13;
+        rand_state_ ^= rand_state_ >> 7;
+        rand_state_ ^= rand_state_ << 17;
+
+        const size_type h = std::countr_one(rand_state_) + 1;
+
+        return (h < levels_ ? h : levels_);
+    }
+
+    template<bool INCLUSIVE>
+    inline size_type rank_(const value_type &val) const  {
+
+        size_type   node { head_ };
+        size_type   rank { 0 };
+
+        for (size_type lvl = levels_; lvl-- > 0; )  {
+            size_type   nxt = next_[at_(node, lvl)];
+
+            while (nxt != npos_ &&
+                   (INCLUSIVE ? values_[nxt] <= val : values_[nxt] < val))  {
+                rank += width_[at_(node, lvl)];
+                node = nxt;
+                nxt = next_[at_(node, lvl)];
+            }
+        }
+        return (rank);
+    }
+
+    const size_type             levels_;
+    std::vector<value_type>     values_ { };
+    std::vector<unsigned char>  heights_ { };
+    std::vector<size_type>      next_ { };  // Node * levels_ + level
+    std::vector<size_type>      width_ { };
+    std::vector<value_type>     sum_ { };
+    std::vector<size_type>      free_ { };
+    size_type                   size_ { 0 };
+    std::uint64_t               rand_state_ { 0x9E3779B97F4A7C15ULL };
+};
+
+// ----------------------------------------------------------------------------
+
+// Sorted vector with the same interface as IndexableSkipList.
+// Insert and erase are O(n) memory moves, but for small sizes they are a lot
+// faster than walking the skip list links. Select is O(1).
+//
+template <typename T>
+class SortedVector  {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+    explicit
+    SortedVector(size_type expected_size = 0)  {
+
+        data_.reserve(expected_size + 1);
+    }
+
+    [[nodiscard]] inline size_type size() const noexcept  {
+
+        return (data_.size());
+    }
+    [[nodiscard]] inline bool empty() const noexcept  {
+
+        return (data_.empty());
+    }
+
+    inline void clear()  { data_.clear(); }
+
+    inline void insert(const value_type &val)  {
+
+        data_.insert(std::upper_bound(data_.begin(), data_.end(), val), val);
+    }
+
+    // It erases one item equal to val. It returns false, if there was none
+    //
+    inline bool erase(const value_type &val)  {
+
+        const auto  iter = std::lower_bound(data_.begin(), data_.end(), val);
+
+        if (iter == data_.end() || *iter != val)  return (false);
+        data_.erase(iter);
+        return (true);
+    }
+
+    [[nodiscard]] inline const value_type &
+    operator[] (size_type n) const  { return (data_[n]); }
+
+    [[nodiscard]] inline size_type
+    count_less(const value_type &val) const  {
+
+        return (std::lower_bound(data_.begin(), data_.end(), val) -
+                data_.begin());
+    }
+    [[nodiscard]] inline size_type
+    count_less_equal(const value_type &val) const  {
+
+        return (std::upper_bound(data_.begin(), data_.end(), val) -
+                data_.begin());
+    }
+
+    [[nodiscard]] inline value_type sum_smallest(size_type n) const  {
+
+        return (std::accumulate(data_.begin(), data_.begin() + n,
+                                value_type { 0 }));
+    }
+
+private:
+
+    std::vector<value_type> data_ { };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
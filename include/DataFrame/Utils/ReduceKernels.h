@@ -0,0 +1,464 @@
+// Hossein Moein
+// October 17 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// ----------------------------------------------------------------------------
+
+// With GCC on x86-64 Linux, each kernel is compiled for baseline x86-64,
+// AVX2 and AVX-512 and the best one for the running CPU is picked when the
+// program is loaded. Elsewhere, kernels are compiled for the target the
+// library user builds for, e.g. -march=native.
+// Define HMDF_NO_SIMD_DISPATCH to turn it off.
+// With GCC, multiply-adds are not fused into FMAs. Otherwise, the AVX-512
+// clone would round differently from the others, and the same column could
+// get a different Var/Corr on a different CPU.
+//
+#if defined(__GNUC__) && ! defined(__clang__) && defined(__x86_64__) && \
+    defined(__linux__) && ! defined(HMDF_NO_SIMD_DISPATCH)
+#  define HMDF_SIMD_DISPATCH \
+       __attribute__((target_clones("default", "avx2", "arch=x86-64-v4"), \
+                      optimize("fp-contract=off")))
+#elif defined(__GNUC__) && ! defined(__clang__)
+#  define HMDF_SIMD_DISPATCH __attribute__((optimize("fp-contract=off")))
+#else
+#  define HMDF_SIMD_DISPATCH
+#endif // __GNUC__
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Reduction kernels over contiguous arithmetic data. They are the range
+// fast paths of Sum, Mean, Extremum, Cov (and so Var, Std, Corr) and
+// DotProd visitors.
+// Each kernel keeps one cache line worth of independent accumulators, so
+// there is no dependency from one item to the next and the compiler keeps
+// the accumulators in vector registers. NaNs are masked out with selects,
+// instead of branches.
+//
+template<typename T>
+inline constexpr std::size_t    reduce_lanes =
+    (64 / sizeof(T)) > 4 ? (64 / sizeof(T)) : 4;
+
+// Counters are as wide as T, so they fit in the same vector registers.
+// They are folded into a size_t every reduce_block items, before they can
+// overflow.
+//
+template<typename T>
+using reduce_count_t =
+    std::conditional_t<sizeof(T) >= 8, std::uint64_t, std::uint32_t>;
+
+template<typename T>
+inline constexpr std::size_t    reduce_block = reduce_lanes<T> << 24;
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+struct  SumCount  {
+
+    T           sum { 0 };
+    std::size_t cnt { 0 };  // Number of non-nan items
+};
+
+// Sum of [begin, end). If skip_nan, nans are left out of the sum and count
+//
+template<typename T>
+HMDF_SIMD_DISPATCH SumCount<T>
+reduce_sum(const T *begin, const T *end, bool skip_nan) noexcept  {
+
+    constexpr std::size_t   L = reduce_lanes<T>;
+    const std::size_t       n = end - begin;
+    const std::size_t       vec_n = n - n % L;
+    SumCount<T>             result { };
+    T                       acc[L] { };
+
+    if (skip_nan && std::is_floating_point_v<T>)  {
+        for (std::size_t b = 0; b < vec_n; b += reduce_block<T>)  {
+            const std::size_t   block_e = std::min(b + reduce_block<T>, vec_n);
+            reduce_count_t<T>   cnt[L] { };
+
+            for (std::size_t i = b; i < block_e; i += L)
+                for (std::size_t j = 0; j < L; ++j)  {
+                    const T     val = begin[i + j];
+                    const bool  not_nan = val == val;
+
+                    acc[j] += not_nan ? val : T(0);
+                    cnt[j] += not_nan;
+                }
+            for (std::size_t j = 0; j < L; ++j)  result.cnt += cnt[j];
+        }
+        for (std::size_t i = vec_n; i < n; ++i)
+            if (begin[i] == begin[i])  {
+                acc[0] += begin[i];
+                result.cnt += 1;
+            }
+    }
+    else  {
+        for (std::size_t i = 0; i < vec_n; i += L)
+            for (std::size_t j = 0; j < L; ++j)
+                acc[j] += begin[i + j];
+        for (std::size_t i = vec_n; i < n; ++i)
+            acc[0] += begin[i];
+        result.cnt = n;
+    }
+    for (std::size_t j = 0; j < L; ++j)  result.sum += acc[j];
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+// Number of non-nan items in [begin, end)
+//
+template<typename T>
+HMDF_SIMD_DISPATCH std::size_t
+reduce_count(const T *begin, const T *end) noexcept  {
+
+    constexpr std::size_t   L = reduce_lanes<T>;
+    const std::size_t       n = end - begin;
+
+    if constexpr (! std::is_floating_point_v<T>)  return (n);
+
+    const std::size_t   vec_n = n - n % L;
+    std::size_t         result { 0 };
+
+    for (std::size_t b = 0; b < vec_n; b += reduce_block<T>)  {
+        const std::size_t   block_e = std::min(b + reduce_block<T>, vec_n);
+        reduce_count_t<T>   cnt[L] { };
+
+        for (std::size_t i = b; i < block_e; i += L)
+            for (std::size_t j = 0; j < L; ++j)
+                cnt[j] += begin[i + j] == begin[i + j];
+        for (std::size_t j = 0; j < L; ++j)  result += cnt[j];
+    }
+    for (std::size_t i = vec_n; i < n; ++i)
+        result += begin[i] == begin[i];
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+// Position of the largest (IS_MAX) or smallest item of [begin, end) that
+// beats init, or end - begin if there is none. Ties and nans never beat the
+// current value, so if there are ties, it is the first one. If init is nan,
+// nothing beats it.
+// The items are scanned a block at a time. Only the block where the
+// extremum was last improved is scanned again to find its position.
+//
+template<bool IS_MAX, typename T>
+HMDF_SIMD_DISPATCH std::size_t
+reduce_extremum(const T *begin, const T *end, T init) noexcept  {
+
+    constexpr std::size_t   L = reduce_lanes<T>;
+    constexpr std::size_t   block_s = 4096;
+    const std::size_t       n = end - begin;
+    T                       best = init;
+    std::size_t             best_block = n;
+
+    for (std::size_t b = 0; b < n; b += block_s)  {
+        const std::size_t   block_e = std::min(b + block_s, n);
+        const std::size_t   vec_e = b + (block_e - b) / L * L;
+        T                   acc[L];
+
+        for (std::size_t j = 0; j < L; ++j)  acc[j] = best;
+        for (std::size_t i = b; i < vec_e; i += L)
+            for (std::size_t j = 0; j < L; ++j)  {
+                const T val = begin[i + j];
+
+                if constexpr (IS_MAX)  acc[j] = acc[j] < val ? val : acc[j];
+                else  acc[j] = val < acc[j] ? val : acc[j];
+            }
+        for (std::size_t i = vec_e; i < block_e; ++i)  {
+            if constexpr (IS_MAX)
+                acc[0] = acc[0] < begin[i] ? begin[i] : acc[0];
+            else
+                acc[0] = begin[i] < acc[0] ? begin[i] : acc[0];
+        }
+
+        const T block_best = best;
+
+        for (std::size_t j = 0; j < L; ++j)  {
+            if constexpr (IS_MAX)  best = best < acc[j] ? acc[j] : best;
+            else  best = acc[j] < best ? acc[j] : best;
+        }
+        if (IS_MAX ? block_best < best : best < block_best)  best_block = b;
+    }
+    if (best_block == n)  return (n);
+    return (std::find(begin + best_block,
+                      begin + std::min(best_block + block_s, n),
+                      best) - begin);
+}
+
+// ----------------------------------------------------------------------------
+
+// Covariance moments are kept in floating-point, even for integer data.
+// Otherwise, the means would be truncated.
+//
+template<typename T>
+using reduce_moment_t =
+    std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+template<typename T>
+struct  CovMoments  {
+
+    std::size_t cnt { 0 };
+    T           mean1 { 0 };
+    T           mean2 { 0 };
+    T           m2_1 { 0 };  // Sum of squared deviations from mean1
+    T           m2_2 { 0 };  // Sum of squared deviations from mean2
+    T           c12 { 0 };   // Sum of products of the two deviations
+};
+
+// It adds a pair of values to the moments, with Welford's algorithm
+//
+template<typename T>
+inline void
+add_cov_moments(CovMoments<T> &m, T val1, T val2) noexcept  {
+
+    m.cnt += 1;
+
+    const T n = T(m.cnt);
+    const T delta1 = val1 - m.mean1;
+    const T delta2 = val2 - m.mean2;
+
+    m.mean1 += delta1 / n;
+    m.mean2 += delta2 / n;
+    m.m2_1 += delta1 * (val1 - m.mean1);
+    m.m2_2 += delta2 * (val2 - m.mean2);
+    m.c12 += delta1 * (val2 - m.mean2);
+}
+
+// It merges the moments of a later run of data into lhs, with Chan's
+// parallel formula. Unlike adding up raw sums of products, the result
+// hardly depends on how the data was split.
+//
+template<typename T>
+inline void
+merge_cov_moments(CovMoments<T> &lhs, const CovMoments<T> &rhs) noexcept  {
+
+    if (rhs.cnt == 0)  return;
+    if (lhs.cnt == 0)  {
+        lhs = rhs;
+        return;
+    }
+
+    const T delta1 = rhs.mean1 - lhs.mean1;
+    const T delta2 = rhs.mean2 - lhs.mean2;
+    const T rhs_w = T(rhs.cnt) / T(lhs.cnt + rhs.cnt);
+    const T f = T(lhs.cnt) * rhs_w;
+
+    lhs.mean1 += delta1 * rhs_w;
+    lhs.mean2 += delta2 * rhs_w;
+    lhs.m2_1 += rhs.m2_1 + delta1 * delta1 * f;
+    lhs.m2_2 += rhs.m2_2 + delta2 * delta2 * f;
+    lhs.c12 += rhs.c12 + delta1 * delta2 * f;
+    lhs.cnt += rhs.cnt;
+}
+
+// Covariance moments of [begin1, end1) and the same number of items from
+// begin2. If skip_nan, the pairs with a nan are left out.
+// The lanes add up deviations from the first pair, instead of the raw
+// values. So the sums stay small, and the squared mean is not taken out of
+// a much larger sum of squares at the end. The result does not depend on
+// the number of lanes beyond rounding of the deviations.
+//
+template<typename T>
+HMDF_SIMD_DISPATCH CovMoments<reduce_moment_t<T>>
+reduce_cov(const T *begin1, const T *end1, const T *begin2,
+           bool skip_nan) noexcept  {
+
+    using M = reduce_moment_t<T>;
+
+    constexpr std::size_t   L = reduce_lanes<M>;
+    const std::size_t       n = end1 - begin1;
+    std::size_t             first = 0;
+    CovMoments<M>           result { };
+
+    if (skip_nan && std::is_floating_point_v<T>)
+        while (first < n &&
+               (begin1[first] != begin1[first] ||
+                begin2[first] != begin2[first]))
+            ++first;
+    if (first == n)  return (result);
+
+    const M             shift1 = M(begin1[first]);
+    const M             shift2 = M(begin2[first]);
+    const std::size_t   vec_n = n - (n - first) % L;
+    M                   s1[L] { }, s2[L] { };
+    M                   s11[L] { }, s22[L] { }, s12[L] { };
+
+    if (skip_nan && std::is_floating_point_v<T>)  {
+        for (std::size_t b = first; b < vec_n; b += reduce_block<M>)  {
+            const std::size_t   block_e = std::min(b + reduce_block<M>, vec_n);
+            reduce_count_t<M>   cnt[L] { };
+
+            for (std::size_t i = b; i < block_e; i += L)
+                for (std::size_t j = 0; j < L; ++j)  {
+                    const T     v1 = begin1[i + j];
+                    const T     v2 = begin2[i + j];
+                    const bool  not_nan = v1 == v1 && v2 == v2;
+                    const M     dev1 = not_nan ? M(v1) - shift1 : M(0);
+                    const M     dev2 = not_nan ? M(v2) - shift2 : M(0);
+
+                    s1[j] += dev1;
+                    s2[j] += dev2;
+                    s11[j] += dev1 * dev1;
+                    s22[j] += dev2 * dev2;
+                    s12[j] += dev1 * dev2;
+                    cnt[j] += not_nan;
+                }
+            for (std::size_t j = 0; j < L; ++j)  result.cnt += cnt[j];
+        }
+    }
+    else  {
+        for (std::size_t i = first; i < vec_n; i += L)
+            for (std::size_t j = 0; j < L; ++j)  {
+                const M dev1 = M(begin1[i + j]) - shift1;
+                const M dev2 = M(begin2[i + j]) - shift2;
+
+                s1[j] += dev1;
+                s2[j] += dev2;
+                s11[j] += dev1 * dev1;
+                s22[j] += dev2 * dev2;
+                s12[j] += dev1 * dev2;
+            }
+        result.cnt = vec_n - first;
+    }
+
+    M   sum1 { 0 }, sum2 { 0 };
+    M   sum11 { 0 }, sum22 { 0 }, sum12 { 0 };
+
+    for (std::size_t j = 0; j < L; ++j)  {
+        sum1 += s1[j];
+        sum2 += s2[j];
+        sum11 += s11[j];
+        sum22 += s22[j];
+        sum12 += s12[j];
+    }
+    for (std::size_t i = vec_n; i < n; ++i)  {
+        const T val1 = begin1[i];
+        const T val2 = begin2[i];
+
+        if (! skip_nan || (val1 == val1 && val2 == val2))  {
+            const M dev1 = M(val1) - shift1;
+            const M dev2 = M(val2) - shift2;
+
+            sum1 += dev1;
+            sum2 += dev2;
+            sum11 += dev1 * dev1;
+            sum22 += dev2 * dev2;
+            sum12 += dev1 * dev2;
+            result.cnt += 1;
+        }
+    }
+
+    const M cnt = M(result.cnt);
+
+    result.mean1 = shift1 + sum1 / cnt;
+    result.mean2 = shift2 + sum2 / cnt;
+    result.m2_1 = sum11 - sum1 * sum1 / cnt;
+    result.m2_2 = sum22 - sum2 * sum2 / cnt;
+    result.c12 = sum12 - sum1 * sum2 / cnt;
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+struct  DotSums  {
+
+    T   dot_prod { 0 };
+    T   mag1 { 0 };      // Sum of squares of the first vector
+    T   mag2 { 0 };      // Sum of squares of the second vector
+    T   euc_dist { 0 };  // Sum of squared differences
+    T   man_dist { 0 };  // Sum of absolute differences
+};
+
+// Dot product, squared magnitudes and distances of [begin1, end1) and the
+// same number of items from begin2
+//
+template<typename T>
+HMDF_SIMD_DISPATCH DotSums<T>
+reduce_dot(const T *begin1, const T *end1, const T *begin2) noexcept  {
+
+    constexpr std::size_t   L = reduce_lanes<T>;
+    const std::size_t       n = end1 - begin1;
+    const std::size_t       vec_n = n - n % L;
+    DotSums<T>              result { };
+    T                       dp[L] { }, m1[L] { }, m2[L] { };
+    T                       euc[L] { }, man[L] { };
+
+    for (std::size_t i = 0; i < vec_n; i += L)
+        for (std::size_t j = 0; j < L; ++j)  {
+            const T val1 = begin1[i + j];
+            const T val2 = begin2[i + j];
+            const T diff = val1 - val2;
+
+            dp[j] += val1 * val2;
+            m1[j] += val1 * val1;
+            m2[j] += val2 * val2;
+            euc[j] += diff * diff;
+            man[j] += diff < T(0) ? -diff : diff;
+        }
+    for (std::size_t j = 0; j < L; ++j)  {
+        result.dot_prod += dp[j];
+        result.mag1 += m1[j];
+        result.mag2 += m2[j];
+        result.euc_dist += euc[j];
+        result.man_dist += man[j];
+    }
+    for (std::size_t i = vec_n; i < n; ++i)  {
+        const T val1 = begin1[i];
+        const T val2 = begin2[i];
+        const T diff = val1 - val2;
+
+        result.dot_prod += val1 * val2;
+        result.mag1 += val1 * val1;
+        result.mag2 += val2 * val2;
+        result.euc_dist += diff * diff;
+        result.man_dist += diff < T(0) ? -diff : diff;
+    }
+    return (result);
+}
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
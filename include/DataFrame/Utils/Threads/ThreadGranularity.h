@@ -31,9 +31,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <DataFrame/Utils/Threads/ThreadPool.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstring>
+#include <limits>
 #include <thread>
+#include <vector>
 
 // ----------------------------------------------------------------------------
 
@@ -44,9 +50,35 @@ struct  ThreadGranularity  {
 
     using size_type = ThreadPool::size_type;
 
+    // Per-byte cost of common kinds of work relative to copying column data.
+    // They are the work parameter of get_thread_level(rows, work, ...)
+    //
+    inline static constexpr double  COPY_WORK = 1.0;
+    inline static constexpr double  GATHER_WORK = 4.0;  // Random access copy
+    inline static constexpr double  VISIT_WORK = 8.0;   // Per-element math
+    inline static constexpr double  SORT_WORK = 24.0;   // Comparison sort
+
+    // The parameters of the threading cost model.
+    // ns_per_byte is the time to copy one byte of column data on one thread.
+    // ns_per_task is the time to dispatch a task to the pool and get its
+    // result. A task is worth dispatching, if it does at least
+    // min_task_ratio times its own overhead.
+    //
+    struct  ThreadCost  {
+
+        double  ns_per_byte { 0.1 };
+        double  ns_per_task { 5000.0 };
+        double  min_task_ratio { 20.0 };
+    };
+
+    // The first time threads are added, the cost model is calibrated by
+    // calibrate_thread_cost(), unless set_thread_cost() was called before.
+    //
     static inline void set_thread_level(size_type n)  {
 
         thr_pool_.add_thread(n - thr_pool_.capacity_threads());
+        if (n > 0 && ! cost_calibrated_.exchange(true))
+            calibrate_thread_cost();
     }
     static inline void set_optimum_thread_level()  {
 
@@ -57,10 +89,108 @@ struct  ThreadGranularity  {
         return (thr_pool_.capacity_threads());
     }
 
+    // It returns the number of threads worth using for an operation over
+    // rows x cols cells of cell_bytes bytes each. work is the per-byte cost
+    // of the operation relative to a copy (see *_WORK above).
+    // It returns 0, if the operation should run on the calling thread.
+    //
+    static inline size_type
+    get_thread_level(size_type rows,
+                     double work,
+                     size_type cols = 1,
+                     size_type cell_bytes = sizeof(double))  {
+
+        const size_type capacity = thr_pool_.capacity_threads();
+
+        if (capacity < 2 || rows <= 0)  return (0);
+
+        const double    cost =
+            double(rows) * double(cols) * double(cell_bytes) * work *
+            ns_per_byte_.load(std::memory_order_relaxed);
+        const double    min_task =
+            ns_per_task_.load(std::memory_order_relaxed) *
+            min_task_ratio_.load(std::memory_order_relaxed);
+        const double    worth = cost / min_task;
+
+        if (worth < 2.0)  return (0);
+        return (worth < double(capacity) ? size_type(worth) : capacity);
+    }
+
+    static inline void set_thread_cost(const ThreadCost &cost)  {
+
+        ns_per_byte_.store(cost.ns_per_byte, std::memory_order_relaxed);
+        ns_per_task_.store(cost.ns_per_task, std::memory_order_relaxed);
+        min_task_ratio_.store(cost.min_task_ratio, std::memory_order_relaxed);
+        cost_calibrated_.store(true);
+    }
+    static inline ThreadCost get_thread_cost()  {
+
+        return (ThreadCost {
+                    ns_per_byte_.load(std::memory_order_relaxed),
+                    ns_per_task_.load(std::memory_order_relaxed),
+                    min_task_ratio_.load(std::memory_order_relaxed) });
+    }
+
+    // It measures the single-thread copy speed and the round trip of a
+    // task through the thread-pool, and sets the cost model accordingly
+    //
+    static inline void calibrate_thread_cost()  {
+
+        using namespace std::chrono;
+
+        constexpr std::size_t   bytes = 8 * 1024 * 1024;
+        std::vector<char>       src(bytes, 1);
+        std::vector<char>       dst(bytes, 0);
+        double                  copy_ns = std::numeric_limits<double>::max();
+
+        for (int i = 0; i < 3; ++i)  {
+            const auto  start = steady_clock::now();
+
+            std::memcpy(dst.data(), src.data(), bytes);
+
+            const auto  end = steady_clock::now();
+
+            copy_ns = std::min(
+                copy_ns,
+                double(duration_cast<nanoseconds>(end - start).count()));
+            src[i] = dst[bytes - 1 - i];  // Keep the copy observable
+        }
+        ns_per_byte_.store(std::max(copy_ns / double(bytes), 0.01),
+                           std::memory_order_relaxed);
+
+        if (thr_pool_.capacity_threads() > 0)  {
+            std::array<double, 33>  samples;
+
+            for (auto &sample : samples)  {
+                const auto  start = steady_clock::now();
+
+                thr_pool_.dispatch(false, []() -> void {  }).get();
+                sample = double(duration_cast<nanoseconds>
+                                    (steady_clock::now() - start).count());
+            }
+            std::nth_element(samples.begin(),
+                             samples.begin() + samples.size() / 2,
+                             samples.end());
+            ns_per_task_.store(
+                std::max(samples[samples.size() / 2], 500.0),
+                std::memory_order_relaxed);
+        }
+        cost_calibrated_.store(true);
+    }
+
     // By defaut, there are no threads
     //
     inline static ThreadPool    thr_pool_ { 0 };
 
+private:
+
+    // Same defaults as ThreadCost
+    //
+    inline static std::atomic<double>   ns_per_byte_ { 0.1 };
+    inline static std::atomic<double>   ns_per_task_ { 5000.0 };
+    inline static std::atomic<double>   min_task_ratio_ { 20.0 };
+    inline static std::atomic_bool      cost_calibrated_ { false };
+
 protected:
 
     ThreadGranularity() = default;
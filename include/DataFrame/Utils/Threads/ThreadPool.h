@@ -30,16 +30,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <DataFrame/Utils/Threads/SharedQueue.h>
+#include <DataFrame/Utils/Threads/WorkStealingDeque.h>
 
 #include <atomic>
 #include <concepts>
+#include <cstddef>
 #include <condition_variable>
 #include <functional>
 #include <future>
 #include <iterator>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <new>
 #include <ranges>
+#include <shared_mutex>
 #include <thread>
 #include <type_traits>
 #include <utility>
@@ -94,20 +99,40 @@ public:
     dispatch_res_t<F, As ...>
     dispatch(bool immediately, F &&routine, As && ... args);
 
-    // It dispatches n / number_of_capacity_threads tasks where n is the
-    // distance between begin and end.
+    // It splits [begin, end) into number_of_capacity_threads blocks of
+    // nearly equal size and dispatches a task for each block.
     //
     template<typename F, typename I, typename ... As>
     loop_res_t<F, I, As ...>
     parallel_loop(I begin, I end, F &&routine, As && ... args);
 
+    // Same as above, but it splits [begin, end) into the given number of
+    // blocks. It is meant to be used with the thread level that
+    // ThreadGranularity::get_thread_level() picks for an operation.
+    // There is at least one block and at most one block per item.
+    //
+    template<typename F, typename I, typename ... As>
+    loop_res_t<F, I, As ...>
+    parallel_loop(size_type blocks,
+                  I begin, I end, F &&routine, As && ... args);
+
     // Parallel loop operating with two ranges
     //
     template<typename F, typename I1, typename I2, typename ... As>
     loop2_res_t<F, I1, I2, As ...>
     parallel_loop2(I1 begin1, I1 end1, I2 begin2, I2 end2,
                    F &&routine, As && ... args);
+    template<typename F, typename I1, typename I2, typename ... As>
+    loop2_res_t<F, I1, I2, As ...>
+    parallel_loop2(size_type blocks,
+                   I1 begin1, I1 end1, I2 begin2, I2 end2,
+                   F &&routine, As && ... args);
 
+    // It sorts [begin, end) in O(n log n) regardless of the input. Sorted and
+    // reverse sorted inputs take one pass. Otherwise, up to
+    // number_of_capacity_threads runs of at least TH items are sorted in
+    // parallel and then merged in parallel. The sort is not stable.
+    //
     template<std::random_access_iterator I, long TH = MUL_THR_THHOLD>
     void parallel_sort(const I begin, const I end);
     template<std::random_access_iterator I, typename P,
@@ -124,44 +149,131 @@ public:
 
     size_type available_threads() const noexcept;
     size_type capacity_threads() const noexcept;
-    size_type pending_tasks() const noexcept; // How many tasks in the queue
+    size_type pending_tasks() const noexcept; // How many tasks in the queues
     bool is_shutdown() const noexcept;
 
     bool shutdown() noexcept;
 
 private:
 
-    using routine_type = std::function<void()>;
-
     enum class WORK_TYPE : unsigned char {
         _undefined_ = 0,
         _client_service_ = 1,
         _terminate_ = 2,
     };
 
+    // Pool threads keep a small per-thread cache of freed memory blocks.
+    // Work units and the shared states of the returned futures are
+    // allocated from it, so in steady state dispatch() from a pool thread
+    // does not call the global allocator. Other threads go straight to the
+    // global allocator.
+    //
+    struct  BlockCache  {
+
+        struct  FreeBlock  { FreeBlock *next; };
+
+        inline static constexpr std::size_t CLASSES = 4;  // 64 to 512 bytes
+        inline static constexpr std::size_t MAX_CACHED = 256;
+
+        FreeBlock   *heads[CLASSES];
+        std::size_t counts[CLASSES];
+        bool        enabled;
+    };
+
+    static void *allocate_block_(std::size_t bytes);
+    static void deallocate_block_(void *ptr, std::size_t bytes) noexcept;
+    static void drain_block_cache_() noexcept;
+
+    inline static thread_local BlockCache   block_cache_ { };
+
+    template<typename T>
+    struct  BlockAllocator  {
+
+        using value_type = T;
+
+        BlockAllocator() = default;
+        template<typename U>
+        BlockAllocator(const BlockAllocator<U> &) noexcept  {   }
+
+        T *allocate(std::size_t n)  {
+
+            return (static_cast<T *>(allocate_block_(n * sizeof(T))));
+        }
+        void deallocate(T *ptr, std::size_t n) noexcept  {
+
+            deallocate_block_(ptr, n * sizeof(T));
+        }
+
+        template<typename U>
+        bool operator == (const BlockAllocator<U> &) const noexcept  {
+
+            return (true);
+        }
+    };
+
+    // A type-erased, move-only void() callable. Callables up to BUF_SIZE
+    // bytes are stored in place, bigger ones on the heap.
+    //
     struct  WorkUnit  {
 
-        WorkUnit() = default;
-        WorkUnit(const WorkUnit &) = default;
-        WorkUnit(WorkUnit &&) = default;
-        WorkUnit &operator=(const WorkUnit &) = default;
-        WorkUnit &operator=(WorkUnit &&) = default;
+        inline static constexpr std::size_t BUF_SIZE = 96;
 
+        WorkUnit() = default;
         explicit WorkUnit(WORK_TYPE work_t) : work_type(work_t)  {   }
-        WorkUnit(WORK_TYPE work_t, routine_type &&routine)
-            : func(std::forward<routine_type>(routine)),
-              work_type(work_t)  {   }
+        template<typename C>
+        WorkUnit(WORK_TYPE work_t, C &&callable);
+        ~WorkUnit()  { if (destroy)  destroy(buffer); }
+
+        WorkUnit(const WorkUnit &) = delete;
+        WorkUnit &operator=(const WorkUnit &) = delete;
+
+        inline void operator() ()  { invoke(buffer); }
+
+        static void *operator new (std::size_t bytes)  {
 
-        routine_type    func {  };
-        WORK_TYPE       work_type { WORK_TYPE::_undefined_ };
+            return (allocate_block_(bytes));
+        }
+        static void operator delete (void *ptr, std::size_t bytes) noexcept  {
+
+            deallocate_block_(ptr, bytes);
+        }
+
+        void        (*invoke)(void *) { nullptr };
+        void        (*destroy)(void *) noexcept { nullptr };
+        WORK_TYPE   work_type { WORK_TYPE::_undefined_ };
+
+        alignas(std::max_align_t) unsigned char buffer[BUF_SIZE];
     };
 
+    // Arguments are passed to the routine as lvalues, with
+    // std::reference_wrapper unwrapped, the same as std::bind does.
+    //
+    template<typename T>
+    static inline std::unwrap_reference_t<T> &unwrap_arg_(T &arg) noexcept  {
+
+        return (arg);
+    }
+
+    // Each pool thread owns a lock-free work-stealing deque. Tasks
+    // dispatched from a pool thread go to its own deque and are popped LIFO
+    // by the owner. Idle threads steal FIFO from a randomly chosen sibling.
+    // Tasks dispatched from outside the pool and terminate requests go
+    // through the global queue.
+    //
+    using GlobalQueueType = SharedQueue<WorkUnit *>;
+    using LocalQueueType = WorkStealingDeque<WorkUnit *>;
+
     bool thread_routine_(size_type local_q_idx) noexcept;  // Engine routine
-    WorkUnit get_one_local_task_() noexcept;
+    void enqueue_(WorkUnit *work_unit);
+    void push_global_(WorkUnit *work_unit) noexcept;
+    WorkUnit *get_one_task_() noexcept;
+    WorkUnit *steal_one_task_() noexcept;
+    void wait_for_task_() noexcept;
+    void wake_threads_(bool all) noexcept;
 
     using guard_type = std::lock_guard<std::mutex>;
-    using GlobalQueueType = SharedQueue<WorkUnit>;
-    using LocalQueueType = std::queue<WorkUnit>;
+    using shared_guard_type = std::shared_lock<std::shared_mutex>;
+    using unique_guard_type = std::unique_lock<std::shared_mutex>;
 
     using LocalQueueList = std::list<LocalQueueType>;
     using ThreadVector = std::vector<thread_type>;
@@ -170,12 +282,19 @@ private:
     LocalQueueList  local_queues_ { };
     GlobalQueueType global_queue_ { };
 
-    inline static thread_local LocalQueueType *local_queue_ { nullptr };
-
-    std::atomic<size_type>  available_threads_ { 0 };
-    std::atomic<size_type>  capacity_threads_ { 0 };
-    std::atomic_bool        shutdown_flag_ { false };
-    mutable std::mutex      state_ { };
+    // A pool thread belongs to exactly one pool
+    //
+    inline static thread_local LocalQueueType   *local_queue_ { nullptr };
+    inline static thread_local const ThreadPool *local_pool_ { nullptr };
+
+    std::atomic<size_type>      available_threads_ { 0 };
+    std::atomic<size_type>      capacity_threads_ { 0 };
+    std::atomic<size_type>      pending_tasks_ { 0 };
+    std::atomic<size_type>      sleeping_threads_ { 0 };
+    std::atomic_bool            shutdown_flag_ { false };
+    mutable std::shared_mutex   state_ { };  // Guards local_queues_ list
+    std::mutex                  sleep_mutex_ { };
+    std::condition_variable     sleep_cv_ { };
 };
 
 } // namespace hmdf
@@ -29,10 +29,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <DataFrame/Utils/Threads/ThreadPool.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <functional>
+#include <exception>
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <type_traits>
 
@@ -44,10 +47,10 @@ namespace hmdf
 inline ThreadPool::ThreadPool(size_type thr_num)  {
 
     threads_.reserve(thr_num * 2);
-    for (size_type i = 0; i < thr_num; ++i)  {
-        local_queues_.push_back(LocalQueueType { });
+    for (size_type i = 0; i < thr_num; ++i)
+        local_queues_.emplace_back();
+    for (size_type i = 0; i < thr_num; ++i)
         threads_.emplace_back(&ThreadPool::thread_routine_, this, i);
-    }
 
     // Make sure all threads are running before we exit the constructor
     //
@@ -63,6 +66,13 @@ inline ThreadPool::~ThreadPool()  {
     for (auto &routine : threads_)
         if (routine.joinable())
             routine.join();
+
+    // Whatever is left over is never going to run
+    //
+    for (auto &q : local_queues_)
+        while (! q.empty())  delete q.steal().value_or(nullptr);
+    while (! global_queue_.empty())
+        delete global_queue_.pop_front(false).value_or(nullptr);
 }
 
 // ----------------------------------------------------------------------------
@@ -87,18 +97,15 @@ ThreadPool::add_thread(size_type thr_num)  {
             throw std::runtime_error(err);
         }
 
-        for (size_type i = 0; i < shutys; ++i)  {
-            const WorkUnit  work_unit { WORK_TYPE::_terminate_ };
-
-            global_queue_.push(work_unit);
-        }
+        for (size_type i = 0; i < shutys; ++i)
+            push_global_(new WorkUnit { WORK_TYPE::_terminate_ });
     }
     else if (thr_num > 0)  {
-        const guard_type    guard { state_ };
-        const size_type     local_size { size_type(threads_.size()) };
+        const unique_guard_type guard { state_ };
+        const size_type         local_size { size_type(threads_.size()) };
 
         for (size_type i = 0; i < thr_num; ++i)  {
-            local_queues_.push_back(LocalQueueType { });
+            local_queues_.emplace_back();
             threads_.emplace_back(&ThreadPool::thread_routine_,
                                   this, local_size + i);
         }
@@ -122,27 +129,38 @@ ThreadPool::dispatch(bool immediately, F &&routine, As && ... args)  {
         std::invoke_result_t<std::decay_t<F>, std::decay_t<As> ...>;
     using future_t = dispatch_res_t<F, As ...>;
 
-    auto            callable  {
-        std::make_shared<std::packaged_task<task_return_t()>>
-            (std::bind<task_return_t>(std::forward<F>(routine),
-                                      std::forward<As>(args) ...))
+    // The allocator is rebound to the type of the future shared state
+    //
+    std::promise<task_return_t> promise {
+        std::allocator_arg, BlockAllocator<char> { }
     };
-    future_t        return_fut { callable->get_future() };
-    const WorkUnit  work_unit {
-        WORK_TYPE::_client_service_, [callable]() -> void { (*callable)(); }
+    future_t                    return_fut { promise.get_future() };
+    auto                        work_unit {
+        std::make_unique<WorkUnit>(
+            WORK_TYPE::_client_service_,
+            [promise = std::move(promise),
+             routine = std::forward<F>(routine),
+             ... args = std::forward<As>(args)]() mutable -> void  {
+                try  {
+                    if constexpr (std::is_void_v<task_return_t>)  {
+                        std::invoke(routine, unwrap_arg_(args) ...);
+                        promise.set_value();
+                    }
+                    else
+                        promise.set_value(
+                            std::invoke(routine, unwrap_arg_(args) ...));
+                }
+                catch (...)  {
+                    promise.set_exception(std::current_exception());
+                }
+            })
     };
 
     if (immediately && available_threads() == 0)
         add_thread(1);
 
-    if (local_queue_)  {  // Is this one of the pool threads
-        const guard_type    guard { state_ };
-
-        local_queue_->push(work_unit);
-    }
-    else
-        global_queue_.push(work_unit);
-
+    enqueue_(work_unit.get());
+    work_unit.release();  // The queues own it now
     return (return_fut);
 }
 
@@ -152,6 +170,19 @@ template<typename F, typename I, typename ... As>
 ThreadPool::loop_res_t<F, I, As ...>
 ThreadPool::parallel_loop(I begin, I end, F &&routine, As && ... args)  {
 
+    return (parallel_loop(capacity_threads(),
+                          begin, end,
+                          std::forward<F>(routine),
+                          std::forward<As>(args) ...));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename F, typename I, typename ... As>
+ThreadPool::loop_res_t<F, I, As ...>
+ThreadPool::parallel_loop(size_type blocks,
+                          I begin, I end, F &&routine, As && ... args)  {
+
     using task_return_t =
         std::invoke_result_t<std::decay_t<F>,
                              std::decay_t<I>,
@@ -166,32 +197,29 @@ ThreadPool::parallel_loop(I begin, I end, F &&routine, As && ... args)  {
     else
         n = std::distance(begin, end);
 
-    const size_type         cap_thrs { capacity_threads() };
-    const size_type         block_size { (n > cap_thrs) ? n / cap_thrs : n };
     std::vector<future_t>   ret;
 
-    if (block_size == n)  {
-        ret.reserve(n);
-        for (size_type i = 0; i < n; ++i)
-            ret.emplace_back(dispatch(false,
-                                      routine,
-                                          begin + i,
-                                          begin + (i + 1),
-                                          std::forward<As>(args) ...));
-    }
-    else  {
-        ret.reserve(cap_thrs + 1);
-        for (size_type i = 0; i < n; i += block_size)  {
-            const size_type block_end {
-                ((i + block_size) > n) ? n : i + block_size
-            };
-
-            ret.emplace_back(dispatch(false,
-                                      routine,
-                                          begin + i,
-                                          begin + block_end,
-                                          std::forward<As>(args) ...));
-        }
+    if (n <= 0)  return (ret);
+    blocks = std::clamp(blocks, size_type(1), n);
+
+    // The first n % blocks blocks get one more item
+    //
+    const size_type block_size { n / blocks };
+    const size_type leftover { n % blocks };
+    size_type       block_begin { 0 };
+
+    ret.reserve(blocks);
+    for (size_type i = 0; i < blocks; ++i)  {
+        const size_type block_end {
+            block_begin + block_size + (i < leftover ? 1 : 0)
+        };
+
+        ret.emplace_back(dispatch(false,
+                                  routine,
+                                      begin + block_begin,
+                                      begin + block_end,
+                                      std::forward<As>(args) ...));
+        block_begin = block_end;
     }
 
     return (ret);
@@ -204,6 +232,20 @@ ThreadPool::loop2_res_t<F, I1, I2, As ...>
 ThreadPool::parallel_loop2(I1 begin1, I1 end1, I2 begin2, I2 end2,
                            F &&routine, As && ... args)  {
 
+    return (parallel_loop2(capacity_threads(),
+                           begin1, end1, begin2, end2,
+                           std::forward<F>(routine),
+                           std::forward<As>(args) ...));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename F, typename I1, typename I2, typename ... As>
+ThreadPool::loop2_res_t<F, I1, I2, As ...>
+ThreadPool::parallel_loop2(size_type blocks,
+                           I1 begin1, I1 end1, I2 begin2, I2 end2,
+                           F &&routine, As && ... args)  {
+
     using task_return_t =
         std::invoke_result_t<std::decay_t<F>,
                              std::decay_t<I1>,
@@ -219,34 +261,28 @@ ThreadPool::parallel_loop2(I1 begin1, I1 end1, I2 begin2, I2 end2,
     else
         n = std::min(std::distance(begin1, end1), std::distance(begin2, end2));
 
-    const size_type         cap_thrs { capacity_threads() };
-    const size_type         block_size { (n > cap_thrs) ? n / cap_thrs : n };
     std::vector<future_t>   ret;
 
-    if (block_size == n)  {
-        ret.reserve(n);
-        for (size_type i = 0; i < n; ++i)
-            ret.emplace_back(dispatch(false,
-                                      routine,
-                                          begin1 + i,
-                                          begin1 + (i + 1),
-                                          begin2 + i,
-                                          std::forward<As>(args) ...));
-    }
-    else  {
-        ret.reserve(cap_thrs + 1);
-        for (size_type i = 0; i < n; i += block_size)  {
-            const size_type block_end {
-                ((i + block_size) > n) ? n : i + block_size
-            };
-
-            ret.emplace_back(dispatch(false,
-                                      routine,
-                                          begin1 + i,
-                                          begin1 + block_end,
-                                          begin2 + i,
-                                          std::forward<As>(args) ...));
-        }
+    if (n <= 0)  return (ret);
+    blocks = std::clamp(blocks, size_type(1), n);
+
+    const size_type block_size { n / blocks };
+    const size_type leftover { n % blocks };
+    size_type       block_begin { 0 };
+
+    ret.reserve(blocks);
+    for (size_type i = 0; i < blocks; ++i)  {
+        const size_type block_end {
+            block_begin + block_size + (i < leftover ? 1 : 0)
+        };
+
+        ret.emplace_back(dispatch(false,
+                                  routine,
+                                      begin1 + block_begin,
+                                      begin1 + block_end,
+                                      begin2 + block_begin,
+                                      std::forward<As>(args) ...));
+        block_begin = block_end;
     }
 
     return (ret);
@@ -271,76 +307,72 @@ template<std::random_access_iterator I, typename P, long TH>
 void
 ThreadPool::parallel_sort(const I begin, const I end, P compare)  {
 
-    using value_type = typename std::iterator_traits<I>::value_type;
     using fut_type = std::future<void>;
 
     if (begin >= end) return;
 
+    // Time indexed data is usually already sorted or reverse sorted
+    //
+    if (std::ranges::is_sorted(begin, end, compare))  return;
+    if (std::ranges::is_sorted(begin, end,
+                               [&compare](const auto &lhs,
+                                          const auto &rhs) -> bool  {
+                                   return (compare(rhs, lhs));
+                               }))  {
+        std::ranges::reverse(begin, end);
+        return;
+    }
+
     const size_type data_size = std::distance(begin, end);
+    const size_type run_cnt = std::min(capacity_threads(), data_size / TH);
 
-    if (data_size > 0)  {
-        auto                left_iter = begin;
-        auto                right_iter = end - 1;
-        bool                is_swapped_left = false;
-        bool                is_swapped_right = false;
-        const value_type    pivot = *begin;
-        auto                fwd_iter = begin + 1;
-
-        while (fwd_iter <= right_iter)  {
-            if (compare(*fwd_iter, pivot))  {
-                is_swapped_left = true;
-                std::iter_swap(left_iter, fwd_iter);
-                ++left_iter;
-                ++fwd_iter;
-            }
-            else if (compare(pivot, *fwd_iter))  {
-                is_swapped_right = true;
-                std::iter_swap(right_iter, fwd_iter);
-                --right_iter;
-            }
-            else ++fwd_iter;
-        }
+    if (run_cnt < 2)  {
+        std::ranges::sort(begin, end, compare);
+        return;
+    }
 
-        const bool  do_left =
-            is_swapped_left && std::distance(begin, left_iter) > 0;
-        const bool  do_right =
-            is_swapped_right && std::distance(right_iter, end) > 0;
-
-        if (data_size >= TH)  {
-            fut_type    left_fut;
-            fut_type    right_fut;
-
-            if (do_left)
-                left_fut = dispatch(false,
-                                    &ThreadPool::parallel_sort<I, P, TH>,
-                                    this,
-                                    begin,
-                                    left_iter,
-                                    compare);
-            if (do_right)
-                right_fut = dispatch(false,
-                                     &ThreadPool::parallel_sort<I, P, TH>,
-                                     this,
-                                     right_iter + 1,
-                                     end,
-                                     compare);
-
-            if (do_left)
-                while (left_fut.wait_for(std::chrono::seconds(0)) ==
-                           std::future_status::timeout)
-                    run_task();
-            if (do_right)
-                while (right_fut.wait_for(std::chrono::seconds(0)) ==
-                           std::future_status::timeout)
-                    run_task();
-        }
-        else  {
-            if (do_left)
-                parallel_sort<I, P, TH>(begin, left_iter, compare);
+    // It is a merge sort. Each thread sorts one run with std::ranges::sort,
+    // which is O(n log n) regardless of the input. Then adjacent runs are
+    // merged in parallel until one run is left.
+    //
+    std::vector<I>          bounds(run_cnt + 1);
+    std::vector<fut_type>   futs;
+    auto                    wait_all = [this, &futs]() -> void  {
+        for (auto &fut : futs)
+            while (fut.wait_for(std::chrono::seconds(0)) ==
+                       std::future_status::timeout)
+                run_task();
+        for (auto &fut : futs)  fut.get();
+        futs.clear();
+    };
 
-            if (do_right)
-                parallel_sort<I, P, TH>(right_iter + 1, end, compare);
-        }
+    for (size_type i = 0; i < run_cnt; ++i)
+        bounds[i] = begin + (data_size * i) / run_cnt;
+    bounds[run_cnt] = end;
+
+    futs.reserve(run_cnt);
+    for (size_type i = 0; i < run_cnt; ++i)
+        futs.push_back(dispatch(false,
+                                [compare](I run_begin, I run_end) -> void  {
+                                    std::ranges::sort(run_begin, run_end,
+                                                      compare);
+                                },
+                                bounds[i],
+                                bounds[i + 1]));
+    wait_all();
+
+    for (size_type width = 1; width < run_cnt; width *= 2)  {
+        for (size_type i = 0; i + width < run_cnt; i += width * 2)
+            futs.push_back(
+                dispatch(false,
+                         [compare](I run_begin, I middle, I run_end) -> void {
+                             std::ranges::inplace_merge(run_begin, middle,
+                                                        run_end, compare);
+                         },
+                         bounds[i],
+                         bounds[i + width],
+                         bounds[std::min(i + width * 2, run_cnt)]));
+        wait_all();
     }
 }
 
@@ -373,7 +405,9 @@ ThreadPool::is_shutdown() const noexcept  {
 inline ThreadPool::size_type
 ThreadPool::pending_tasks() const noexcept  {
 
-    return (global_queue_.size());
+    const size_type ret { pending_tasks_.load(std::memory_order_relaxed) };
+
+    return ((ret > 0) ? ret : 0);
 }
 
 // ----------------------------------------------------------------------------
@@ -388,36 +422,225 @@ ThreadPool::shutdown() noexcept  {
                                                std::memory_order_relaxed))  {
         const size_type capacity { capacity_threads() + 10 };
 
-        for (size_type i = 0; i < capacity; ++i)  {
-            const WorkUnit  work_unit { WORK_TYPE::_terminate_ };
+        for (size_type i = 0; i < capacity; ++i)
+            push_global_(new WorkUnit { WORK_TYPE::_terminate_ });
+        wake_threads_(true);
+    }
+
+    return (true);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename C>
+ThreadPool::WorkUnit::WorkUnit(WORK_TYPE work_t, C &&callable)
+    : work_type(work_t)  {
+
+    using call_t = std::decay_t<C>;
+
+    if constexpr (sizeof(call_t) <= BUF_SIZE &&
+                  alignof(call_t) <= alignof(std::max_align_t))  {
+        ::new (static_cast<void *>(buffer)) call_t(std::forward<C>(callable));
+        invoke = [](void *buf) -> void  {
+            (*std::launder(reinterpret_cast<call_t *>(buf)))();
+        };
+        destroy = [](void *buf) noexcept -> void  {
+            std::launder(reinterpret_cast<call_t *>(buf))->~call_t();
+        };
+    }
+    else  {  // Too big to be stored in place
+        ::new (static_cast<void *>(buffer))
+            call_t *(new call_t(std::forward<C>(callable)));
+        invoke = [](void *buf) -> void  {
+            (**std::launder(reinterpret_cast<call_t **>(buf)))();
+        };
+        destroy = [](void *buf) noexcept -> void  {
+            delete *std::launder(reinterpret_cast<call_t **>(buf));
+        };
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+inline void *
+ThreadPool::allocate_block_(std::size_t bytes)  {
+
+    std::size_t class_idx { 0 };
+
+    while (class_idx < BlockCache::CLASSES && (64UL << class_idx) < bytes)
+        class_idx += 1;
+    if (class_idx == BlockCache::CLASSES)
+        return (::operator new(bytes));
+
+    BlockCache  &cache = block_cache_;
+
+    if (cache.heads[class_idx])  {
+        BlockCache::FreeBlock   *block = cache.heads[class_idx];
+
+        cache.heads[class_idx] = block->next;
+        cache.counts[class_idx] -= 1;
+        return (block);
+    }
+    return (::operator new(64UL << class_idx));
+}
+
+// ----------------------------------------------------------------------------
+
+inline void
+ThreadPool::deallocate_block_(void *ptr, std::size_t bytes) noexcept  {
+
+    std::size_t class_idx { 0 };
 
-            global_queue_.push(work_unit);
+    while (class_idx < BlockCache::CLASSES && (64UL << class_idx) < bytes)
+        class_idx += 1;
+
+    BlockCache  &cache = block_cache_;
+
+    if (class_idx == BlockCache::CLASSES ||
+        ! cache.enabled ||
+        cache.counts[class_idx] >= BlockCache::MAX_CACHED)  {
+        ::operator delete(ptr);
+        return;
+    }
+
+    BlockCache::FreeBlock   *block = ::new (ptr) BlockCache::FreeBlock;
+
+    block->next = cache.heads[class_idx];
+    cache.heads[class_idx] = block;
+    cache.counts[class_idx] += 1;
+}
+
+// ----------------------------------------------------------------------------
+
+inline void
+ThreadPool::drain_block_cache_() noexcept  {
+
+    BlockCache  &cache = block_cache_;
+
+    cache.enabled = false;
+    for (std::size_t i = 0; i < BlockCache::CLASSES; ++i)  {
+        while (cache.heads[i])  {
+            BlockCache::FreeBlock   *block = cache.heads[i];
+
+            cache.heads[i] = block->next;
+            ::operator delete(block);
         }
+        cache.counts[i] = 0;
     }
+}
 
-    return (true);
+// ----------------------------------------------------------------------------
+
+inline void
+ThreadPool::enqueue_(WorkUnit *work_unit)  {
+
+    if (local_pool_ == this)  // Is this one of our pool threads
+        local_queue_->push(work_unit);
+    else
+        global_queue_.push(work_unit);
+
+    // The count is bumped after the task is visible. So it could be
+    // momentarily negative, if the task is taken before we get here.
+    //
+    ++pending_tasks_;
+    wake_threads_(false);
 }
 
 // ----------------------------------------------------------------------------
 
-inline ThreadPool::WorkUnit
-ThreadPool::get_one_local_task_() noexcept  {
+inline void
+ThreadPool::push_global_(WorkUnit *work_unit) noexcept  {
+
+    global_queue_.push(work_unit);
+    ++pending_tasks_;
+    wake_threads_(false);
+}
+
+// ----------------------------------------------------------------------------
+
+inline void
+ThreadPool::wake_threads_(bool all) noexcept  {
+
+    // Sleepers register themselves before checking pending_tasks_. Both
+    // sides use sequentially consistent operations, so either they see the
+    // new task or we see them and notify.
+    //
+    if (sleeping_threads_.load() > 0)  {
+        const guard_type    guard { sleep_mutex_ };
+
+        if (all)  sleep_cv_.notify_all();
+        else  sleep_cv_.notify_one();
+    }
+}
+
+// ----------------------------------------------------------------------------
 
-    WorkUnit            work_unit;
-    const guard_type    guard { state_ };
+inline void
+ThreadPool::wait_for_task_() noexcept  {
 
-    if (local_queue_ && (! local_queue_->empty()))  {
-        work_unit = local_queue_->front();
-        local_queue_->pop();
+    // Spin briefly before sleeping. Tasks tend to come in bursts
+    //
+    for (size_type i = 0; i < 64; ++i)  {
+        if (pending_tasks_.load(std::memory_order_relaxed) > 0)  return;
+        std::this_thread::yield();
     }
-    else  {  // Try to steal tasks from other queues
-        for (auto &q : local_queues_)
-            if (! q.empty())  {
-                work_unit = q.front();
-                q.pop();
-                break;
-            }
+
+    std::unique_lock<std::mutex>    ul { sleep_mutex_ };
+
+    ++sleeping_threads_;
+    sleep_cv_.wait(ul, [this]() -> bool { return (pending_tasks_ > 0); });
+    --sleeping_threads_;
+}
+
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::WorkUnit *
+ThreadPool::steal_one_task_() noexcept  {
+
+    // Per-thread xorshift state to pick the first victim
+    //
+    thread_local std::size_t    seed {
+        std::hash<std::thread::id>{ }(std::this_thread::get_id()) | 1
+    };
+    const shared_guard_type     guard { state_ };
+    const std::size_t           n { local_queues_.size() };
+
+    if (n == 0)  return (nullptr);
+
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    auto        iter = local_queues_.begin();
+    const auto  end = local_queues_.end();
+
+    std::advance(iter, seed % n);
+    for (std::size_t i = 0; i < n; ++i)  {
+        if (&(*iter) != local_queue_)  {
+            const auto  opt_ret = iter->steal();
+
+            if (opt_ret.has_value())  return (opt_ret.value());
+        }
+        if (++iter == end)  iter = local_queues_.begin();
     }
+    return (nullptr);
+}
+
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::WorkUnit *
+ThreadPool::get_one_task_() noexcept  {
+
+    WorkUnit    *work_unit { nullptr };
+
+    if (local_pool_ == this)
+        work_unit = local_queue_->pop().value_or(nullptr);
+    if (! work_unit)
+        work_unit = steal_one_task_();
+    if (! work_unit)
+        work_unit = global_queue_.pop_front(false).value_or(nullptr);
+
+    if (work_unit)  --pending_tasks_;
     return (work_unit);
 }
 
@@ -426,20 +649,15 @@ ThreadPool::get_one_local_task_() noexcept  {
 inline bool
 ThreadPool::run_task() noexcept  {
 
-    WorkUnit    work_unit = get_one_local_task_();
+    WorkUnit    *work_unit = get_one_task_();
 
-    if (work_unit.work_type == WORK_TYPE::_undefined_)  {
-        const auto  opt_ret = global_queue_.pop_front(false); // Don't wait
-
-        if (opt_ret.has_value())
-            work_unit = opt_ret.value();
-    }
-    if (work_unit.work_type == WORK_TYPE::_client_service_) {
-        (work_unit.func)();  // Execute the callable
+    if (! work_unit)  return (false);
+    if (work_unit->work_type == WORK_TYPE::_client_service_) {
+        (*work_unit)();  // Execute the callable
+        delete work_unit;
         return (true);
     }
-    else if (work_unit.work_type != WORK_TYPE::_undefined_)
-        global_queue_.push(work_unit);  // Put it back
+    push_global_(work_unit);  // Put it back
     return (false);
 }
 
@@ -451,33 +669,43 @@ ThreadPool::thread_routine_(size_type local_q_idx) noexcept  {
     if (is_shutdown())
         return (false);
 
-    auto    iter = local_queues_.begin();
+    {
+        const shared_guard_type guard { state_ };
+        auto                    iter = local_queues_.begin();
 
-    std::advance(iter, local_q_idx);
-    local_queue_ = &(*iter);
+        std::advance(iter, local_q_idx);
+        local_queue_ = &(*iter);
+        local_pool_ = this;
+    }
+    block_cache_.enabled = true;
     ++capacity_threads_;
+    ++available_threads_;
     while (true)  {
-        ++available_threads_;
-
-        size_type   counter { 0 };
-
-        while (++counter < 80)  run_task();
-
-        WorkUnit    work_unit { };
-        const auto  opt_ret = global_queue_.pop_front(true); // Wait
+        WorkUnit    *work_unit = get_one_task_();
 
-        if (opt_ret.has_value())
-            work_unit = opt_ret.value();
-
-        --available_threads_;
+        if (! work_unit)  {
+            wait_for_task_();
+            continue;
+        }
 
-        if (work_unit.work_type == WORK_TYPE::_client_service_)
-            (work_unit.func)();  // Execute the callable
-        else if (work_unit.work_type == WORK_TYPE::_terminate_)
+        if (work_unit->work_type == WORK_TYPE::_client_service_)  {
+            --available_threads_;
+            (*work_unit)();  // Execute the callable
+            ++available_threads_;
+            delete work_unit;
+        }
+        else if (work_unit->work_type == WORK_TYPE::_terminate_)  {
+            delete work_unit;
             break;
+        }
+        else
+            delete work_unit;
     }
+    --available_threads_;
     --capacity_threads_;
     local_queue_ = nullptr;
+    local_pool_ = nullptr;
+    drain_block_cache_();
 
     return (true);
 }
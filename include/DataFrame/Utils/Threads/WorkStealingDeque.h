@@ -0,0 +1,132 @@
+// Hossein Moein
+// August 9, 2023
+/*
+Copyright (c) 2023-2028, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// This is a Chase-Lev lock-free work-stealing deque.
+// The owner thread pushes and pops at the bottom (LIFO). Any other thread
+// can steal from the top (FIFO). Only steal() may be called concurrently
+// with the owner.
+// The buffer grows when full. Retired buffers are kept until the deque is
+// destroyed, because a thief may still be reading them.
+//
+template<typename T>
+class   WorkStealingDeque  {
+
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque element must be trivially copyable");
+
+public:
+
+    using value_type = T;
+    using size_type = std::int64_t;
+    using optional_ret = std::optional<value_type>;
+
+    explicit
+    WorkStealingDeque(size_type capacity = 1024);
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+    WorkStealingDeque &operator = (const WorkStealingDeque &) = delete;
+
+    // Owner thread only
+    //
+    void push(value_type element);
+    optional_ret pop() noexcept;
+
+    // Any thread
+    //
+    optional_ret steal() noexcept;
+
+    // These are only snapshots when other threads are active
+    //
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+private:
+
+    struct  Buffer  {
+
+        explicit Buffer(size_type cap)
+            : capacity(cap),
+              mask(cap - 1),
+              data(std::make_unique<std::atomic<value_type>[]>(cap))  {   }
+
+        inline value_type get(size_type i) const noexcept  {
+
+            return (data[i & mask].load(std::memory_order_relaxed));
+        }
+        inline void put(size_type i, value_type element) noexcept  {
+
+            data[i & mask].store(element, std::memory_order_relaxed);
+        }
+
+        const size_type                         capacity;
+        const size_type                         mask;
+        std::unique_ptr<std::atomic<value_type>[]> data;
+    };
+
+    Buffer *grow_(Buffer *old_buf, size_type bottom, size_type top);
+
+    // Keep top_ and bottom_ on separate cache lines. Thieves only write top_
+    //
+    alignas(64) std::atomic<size_type>  top_ { 0 };
+    alignas(64) std::atomic<size_type>  bottom_ { 0 };
+    alignas(64) std::atomic<Buffer *>   buffer_ { nullptr };
+
+    std::vector<std::unique_ptr<Buffer>>    buffers_ { };  // Owner only
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+#ifndef HMDF_DO_NOT_INCLUDE_TCC_FILES
+#  include <DataFrame/Utils/Threads/WorkStealingDeque.tcc>
+#endif // HMDF_DO_NOT_INCLUDE_TCC_FILES
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
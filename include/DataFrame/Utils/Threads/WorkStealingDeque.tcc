@@ -0,0 +1,163 @@
+// Hossein Moein
+// August 9, 2023
+/*
+Copyright (c) 2023-2028, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <DataFrame/Utils/Threads/WorkStealingDeque.h>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+template<typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_type capacity)  {
+
+    size_type   cap { 2 };
+
+    while (cap < capacity)  cap <<= 1;  // Must be a power of two
+    buffers_.push_back(std::make_unique<Buffer>(cap));
+    buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+void
+WorkStealingDeque<T>::push(value_type element)  {
+
+    const size_type b { bottom_.load(std::memory_order_relaxed) };
+    const size_type t { top_.load(std::memory_order_acquire) };
+    Buffer          *buf { buffer_.load(std::memory_order_relaxed) };
+
+    if ((b - t) > (buf->capacity - 1))  buf = grow_(buf, b, t);
+    buf->put(b, element);
+    bottom_.store(b + 1, std::memory_order_release);  // Publish to thieves
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename WorkStealingDeque<T>::optional_ret
+WorkStealingDeque<T>::pop() noexcept  {
+
+    const size_type b { bottom_.load(std::memory_order_relaxed) - 1 };
+    Buffer          *buf { buffer_.load(std::memory_order_relaxed) };
+
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    size_type       t { top_.load(std::memory_order_relaxed) };
+    optional_ret    ret { };
+
+    if (t <= b)  {
+        ret = buf->get(b);
+        if (t == b)  {  // Last element. Race against the thieves for it
+            if (! top_.compare_exchange_strong(t, t + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed))
+                ret.reset();
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+    }
+    else  // Empty
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    return (ret);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename WorkStealingDeque<T>::optional_ret
+WorkStealingDeque<T>::steal() noexcept  {
+
+    size_type   t { top_.load(std::memory_order_acquire) };
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const size_type b { bottom_.load(std::memory_order_acquire) };
+
+    if (t < b)  {
+        const Buffer        *buf { buffer_.load(std::memory_order_acquire) };
+        const value_type    element { buf->get(t) };
+
+        if (top_.compare_exchange_strong(t, t + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed))
+            return (element);
+    }
+    return (optional_ret { });  // Empty or lost the race
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+bool
+WorkStealingDeque<T>::empty() const noexcept  {
+
+    return (size() <= 0);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename WorkStealingDeque<T>::size_type
+WorkStealingDeque<T>::size() const noexcept  {
+
+    const size_type b { bottom_.load(std::memory_order_relaxed) };
+    const size_type t { top_.load(std::memory_order_relaxed) };
+
+    return ((b > t) ? b - t : 0);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename WorkStealingDeque<T>::Buffer *
+WorkStealingDeque<T>::grow_(Buffer *old_buf, size_type bottom, size_type top)  {
+
+    auto    new_buf { std::make_unique<Buffer>(old_buf->capacity * 2) };
+
+    for (size_type i = top; i < bottom; ++i)
+        new_buf->put(i, old_buf->get(i));
+
+    Buffer  *ret { new_buf.get() };
+
+    buffers_.push_back(std::move(new_buf));
+    buffer_.store(ret, std::memory_order_release);
+    return (ret);
+}
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
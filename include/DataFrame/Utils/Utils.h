@@ -179,6 +179,45 @@ is_nan__<long double>(const long double &val)  { return(std::isnan(val)); }
 
 // ----------------------------------------------------------------------------
 
+template<typename T>
+inline bool
+is_inf__(const T &)  { return (false); }
+
+template<>
+inline bool
+is_inf__<double>(const double &val)  { return(std::isinf(val)); }
+
+template<>
+inline bool
+is_inf__<float>(const float &val)  { return(std::isinf(val)); }
+
+template<>
+inline bool
+is_inf__<long double>(const long double &val)  { return(std::isinf(val)); }
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+inline bool
+is_finite__(const T &)  { return (true); }
+
+template<>
+inline bool
+is_finite__<double>(const double &val)  { return(std::isfinite(val)); }
+
+template<>
+inline bool
+is_finite__<float>(const float &val)  { return(std::isfinite(val)); }
+
+template<>
+inline bool
+is_finite__<long double>(const long double &val)  {
+
+    return(std::isfinite(val));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename T>
 inline T
 get_nan()  { return (T()); }
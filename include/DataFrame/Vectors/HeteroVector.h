@@ -35,10 +35,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Vectors/HeteroPtrView.h>
 #include <DataFrame/Vectors/HeteroView.h>
 
-#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <memory>
 #include <new>
 #include <type_traits>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 // ----------------------------------------------------------------------------
@@ -57,14 +60,14 @@ struct HeteroVector  {
 
     using size_type = size_t;
 
-    HeteroVector();
+    HeteroVector() = default;
     HeteroVector(const HeteroVector &that);
-    HeteroVector(HeteroVector &&that);
+    HeteroVector(HeteroVector &&that) noexcept;
 
     ~HeteroVector() { clear(); }
 
     HeteroVector &operator= (const HeteroVector &rhs);
-    HeteroVector &operator= (HeteroVector &&rhs);
+    HeteroVector &operator= (HeteroVector &&rhs) noexcept;
 
     template<typename T>
     [[nodiscard]] std::vector<T, typename allocator_declare<T, A>::type> &
@@ -204,6 +207,11 @@ struct HeteroVector  {
         using types = type_list<Ts ...>;
     };
 
+    // The following run the functor on every vector whose type is in the
+    // functor's types list. Vectors are visited in the order they were
+    // added to this HeteroVector. Each call is a single table lookup per
+    // vector, regardless of how long the types list is.
+    //
     template<typename T>
     void visit (T &&visitor)  {
 
@@ -235,36 +243,116 @@ private:
     template<typename T>
     using vec_t = std::vector<T, typename allocator_declare<T, A>::type>;
 
+    // This is a hand-rolled vtable for the type-erased vectors held by
+    // HeteroVector. There is exactly one instance of it per type (see
+    // vec_ops_<T>), so its address also doubles as the type tag.
+    //
+    struct  VecOps  {
+
+        void (*destroy)(void *vec) noexcept;
+        void (*copy)(const void *from, void *to);
+        void (*move)(void *from, void *to) noexcept;
+    };
+
+    template<typename T>
+    static void destroy_vec_(void *vec) noexcept;
+    template<typename T>
+    static void copy_vec_(const void *from, void *to);
+    template<typename T>
+    static void move_vec_(void *from, void *to) noexcept;
+
+    template<typename T>
+    inline static constexpr VecOps  vec_ops_ {
+        &HeteroVector::destroy_vec_<T>,
+        &HeteroVector::copy_vec_<T>,
+        &HeteroVector::move_vec_<T>
+    };
+
+    // A vector of one type, stored in place. Since the allocators are
+    // stateless, all vec_t<T> have the same size and alignment, except for
+    // vector<bool> which is a bit larger.
+    //
+    struct  VecSlot  {
+
+        VecSlot() = default;
+        VecSlot(const VecSlot &) = delete;
+        VecSlot &operator= (const VecSlot &) = delete;
+        ~VecSlot()  { reset(); }
+
+        template<typename T>
+        [[nodiscard]] inline bool holds() const noexcept  {
+
+            return (ops == &vec_ops_<T>);
+        }
+        template<typename T>
+        [[nodiscard]] inline vec_t<T> &get() noexcept  {
+
+            return (*std::launder(reinterpret_cast<vec_t<T> *>(buffer)));
+        }
+
+        template<typename T>
+        vec_t<T> &emplace();
+        void copy_from(const VecSlot &that);
+        void move_from(VecSlot &that) noexcept;
+        void reset() noexcept;
+
+        const VecOps    *ops { nullptr };
+        std::size_t     type_idx { 0 };  // See type_index_<T>()
+        alignas(vec_t<char>) unsigned char
+            buffer[std::max(sizeof(vec_t<char>), sizeof(vec_t<bool>))];
+    };
+
+    template<typename T>
+    [[nodiscard]] VecSlot *find_slot_() const noexcept;
+
+    // Every type stored in any HeteroVector gets a small dense index the
+    // first time it is stored. The slot records it, so dispatching to the
+    // right instantiation is one table lookup.
+    //
+    inline static std::atomic<std::size_t>  type_count_ { 0 };
+
     template<typename T>
-    inline static
-    std::unordered_map<
-        const HeteroVector *, vec_t<T>,
-        std::hash<const HeteroVector *>,
-        std::equal_to<const HeteroVector *>,
-        typename allocator_declare<
-            std::pair<const HeteroVector *const, vec_t<T>>, A>::type>
-        vectors_ {  };
+    [[nodiscard]] static std::size_t type_index_() noexcept;
+
+    template<typename T>
+    using slot_func_t = void (*)(VecSlot &slot, T &functor);
+
+    // Maps type indices to the slot function instantiated for that type.
+    // There is one table per functor type and types list, built on first
+    // use from the types list.
+    //
+    template<typename T>
+    struct  DispatchTable  {
+
+        using entry_type = std::pair<std::size_t, slot_func_t<T>>;
+
+        DispatchTable(std::initializer_list<entry_type> entries);
 
-    std::vector<std::function<void(HeteroVector &)>>    clear_functions_;
-    std::vector<std::function<void(const HeteroVector &,
-                                   HeteroVector &)>>    copy_functions_;
-    std::vector<std::function<void(HeteroVector &,
-                                   HeteroVector &)>>    move_functions_;
+        void operator() (VecSlot &slot, T &functor) const;
+
+        std::vector<slot_func_t<T>> funcs {  };
+    };
+
+    template<typename T>
+    void dispatch_ (const DispatchTable<T> &table, T &functor) const;
+
+    // In a DataFrame each column holds exactly one type which always lives
+    // in slot_. Vectors of other types go to more_slots_. They are heap
+    // allocated, so references to them stay valid when new types are added.
+    //
+    VecSlot                                 slot_ {  };
+    std::vector<std::unique_ptr<VecSlot>>   more_slots_ {  };
 
     // Visitor stuff
     //
     template<typename T, typename U>
-    void visit_impl_help_ (T &visitor);
-    template<typename T, typename U>
-    void visit_impl_help_ (T &visitor) const;
+    static void visit_slot_ (VecSlot &slot, T &visitor);
 
     template<typename T, typename U>
-    void sort_impl_help_ (T &functor);
+    static void sort_slot_ (VecSlot &slot, T &functor);
 
     template<typename T, typename U>
-    void change_impl_help_ (T &functor);
-    template<typename T, typename U>
-    void change_impl_help_ (T &functor) const;
+    static void change_slot_ (VecSlot &slot, T &functor);
 
     // Specific visit implementations
     //
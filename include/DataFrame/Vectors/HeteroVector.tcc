@@ -37,38 +37,176 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace hmdf
 {
 
+template<std::size_t A>
+template<typename T>
+void HeteroVector<A>::destroy_vec_(void *vec) noexcept  {
+
+    static_cast<vec_t<T> *>(vec)->~vec_t<T>();
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+void HeteroVector<A>::copy_vec_(const void *from, void *to)  {
+
+    new (to) vec_t<T>(*static_cast<const vec_t<T> *>(from));
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+void HeteroVector<A>::move_vec_(void *from, void *to) noexcept  {
+
+    new (to) vec_t<T>(std::move(*static_cast<vec_t<T> *>(from)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+typename HeteroVector<A>::template vec_t<T> &
+HeteroVector<A>::VecSlot::emplace()  {
+
+    static_assert(sizeof(vec_t<T>) <= sizeof(buffer) &&
+                      alignof(vec_t<T>) <= alignof(vec_t<char>),
+                  "HeteroVector: vector does not fit in the slot buffer");
+
+    reset();
+
+    vec_t<T>    *vec = new (buffer) vec_t<T>();
+
+    ops = &vec_ops_<T>;
+    type_idx = type_index_<T>();
+    return (*vec);
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+void HeteroVector<A>::VecSlot::copy_from(const VecSlot &that)  {
+
+    reset();
+    if (that.ops)  {
+        that.ops->copy(that.buffer, buffer);
+        ops = that.ops;
+        type_idx = that.type_idx;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+void HeteroVector<A>::VecSlot::move_from(VecSlot &that) noexcept  {
+
+    reset();
+    if (that.ops)  {
+        that.ops->move(that.buffer, buffer);
+        ops = that.ops;
+        type_idx = that.type_idx;
+        that.reset();
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+void HeteroVector<A>::VecSlot::reset() noexcept  {
+
+    if (ops)  {
+        ops->destroy(buffer);
+        ops = nullptr;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+typename HeteroVector<A>::VecSlot *
+HeteroVector<A>::find_slot_() const noexcept  {
+
+    if (slot_.template holds<T>()) [[likely]]
+        return (const_cast<VecSlot *>(&slot_));
+
+    for (const auto &slot : more_slots_)
+        if (slot->template holds<T>())
+            return (slot.get());
+    return (nullptr);
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+std::size_t HeteroVector<A>::type_index_() noexcept  {
+
+    static const std::size_t    idx = type_count_++;
+
+    return (idx);
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+HeteroVector<A>::DispatchTable<T>::
+DispatchTable(std::initializer_list<entry_type> entries)  {
+
+    for (const auto &[idx, func] : entries)  {
+        if (idx >= funcs.size())
+            funcs.resize(idx + 1, nullptr);
+        funcs[idx] = func;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+void HeteroVector<A>::DispatchTable<T>::
+operator() (VecSlot &slot, T &functor) const  {
+
+    // Types that are not in the functor's list are quietly skipped
+    //
+    if (slot.ops && slot.type_idx < funcs.size())  {
+        const slot_func_t<T>    func = funcs[slot.type_idx];
+
+        if (func) [[likely]]
+            func(slot, functor);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+void HeteroVector<A>::
+dispatch_ (const DispatchTable<T> &table, T &functor) const  {
+
+    table(const_cast<VecSlot &>(slot_), functor);
+    for (const auto &slot : more_slots_)
+        table(*slot, functor);
+}
+
+// ----------------------------------------------------------------------------
+
 template<std::size_t A>
 template<typename T>
 std::vector<T, typename allocator_declare<T, A>::type> &HeteroVector<A>::
 get_vector()  {
 
-    auto    iter = vectors_<T>.find (this);
-
-    // don't have it yet, so create functions for copying and destroying
-    if (iter == vectors_<T>.end()) [[likely]]  {
-        clear_functions_.emplace_back (
-            [](HeteroVector &hv) { vectors_<T>.erase(&hv); });
-
-        // if someone copies me, they need to call each
-        // copy_function and pass themself
-        copy_functions_.emplace_back (
-            [](const HeteroVector &from, HeteroVector &to)  {
-                vectors_<T>[&to] = vectors_<T>[&from];
-            });
-
-        move_functions_.emplace_back (
-            [](HeteroVector &from, HeteroVector &to)  {
-                vectors_<T>[&to] = std::move(vectors_<T>[&from]);
-            });
-
-        iter = vectors_<T>.emplace (
-                   this,
-                   std::vector<
-                       T,
-                       typename allocator_declare<T, A>::type>()).first;
-    }
+    VecSlot *slot = find_slot_<T>();
 
-    return (iter->second);
+    if (slot) [[likely]]
+        return (slot->template get<T>());
+
+    // don't have it yet, so create it in the first free slot
+    if (! slot_.ops)
+        return (slot_.template emplace<T>());
+    return (more_slots_.emplace_back(std::make_unique<VecSlot>())->
+                template emplace<T>());
 }
 
 // ----------------------------------------------------------------------------
@@ -166,84 +304,62 @@ void HeteroVector<A>::emplace (ITR pos, Args &&... args)  {
 
 template<std::size_t A>
 template<typename T, typename U>
-void HeteroVector<A>::visit_impl_help_ (T &visitor)  {
-
-    auto    iter = vectors_<U>.find (this);
+void HeteroVector<A>::visit_slot_ (VecSlot &slot, T &visitor)  {
 
-    if (iter != vectors_<U>.end()) [[likely]]
-        for (auto &&element : iter->second)
-            visitor(element);
+    for (auto &&element : slot.template get<U>())
+        visitor(element);
 }
 
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
 template<typename T, typename U>
-void HeteroVector<A>::visit_impl_help_ (T &visitor) const  {
+void HeteroVector<A>::sort_slot_ (VecSlot &slot, T &functor)  {
 
-    const auto  citer = vectors_<U>.find (this);
+    auto    &vec = slot.template get<U>();
 
-    if (citer != vectors_<U>.end()) [[likely]]
-        for (auto &&element : citer->second)
-            visitor(element);
+    std::sort (vec.begin(), vec.end(), functor);
 }
 
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
 template<typename T, typename U>
-void HeteroVector<A>::sort_impl_help_ (T &functor)  {
+void HeteroVector<A>::change_slot_ (VecSlot &slot, T &functor)  {
 
-    auto    iter = vectors_<U>.find (this);
-
-    if (iter != vectors_<U>.end()) [[likely]]
-        std::sort (iter->second.begin(), iter->second.end(), functor);
+    functor(slot.template get<U>());
 }
 
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
-template<typename T, typename U>
-void HeteroVector<A>::change_impl_help_ (T &functor)  {
-
-    auto    iter = vectors_<U>.find (this);
-
-    if (iter != vectors_<U>.end())
-        functor(iter->second);
-}
-
-// ----------------------------------------------------------------------------
+template<class T, template<class...> class TLIST, class... TYPES>
+void HeteroVector<A>::visit_impl_ (T &&visitor, TLIST<TYPES...>)  {
 
-template<std::size_t A>
-template<typename T, typename U>
-void HeteroVector<A>::change_impl_help_ (T &functor) const  {
+    using func_t = std::remove_reference_t<T>;
 
-    const auto  citer = vectors_<U>.find (this);
+    static const DispatchTable<func_t>  table {
+        { type_index_<TYPES>(),
+          &HeteroVector::visit_slot_<func_t, TYPES> } ...
+    };
 
-    if (citer != vectors_<U>.end()) [[likely]]
-        functor(citer->second);
+    dispatch_ (table, visitor);
 }
 
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
 template<class T, template<class...> class TLIST, class... TYPES>
-void HeteroVector<A>::visit_impl_ (T &&visitor, TLIST<TYPES...>)  {
-
-    // (..., visit_impl_help_<std::decay_t<T>, TYPES>(visitor)); // C++17
-    using expander = int[];
-    (void) expander { 0, (visit_impl_help_<T, TYPES>(visitor), 0) ... };
-}
+void HeteroVector<A>::visit_impl_ (T &&visitor, TLIST<TYPES...>) const  {
 
-// ----------------------------------------------------------------------------
+    using func_t = std::remove_reference_t<T>;
 
-template<std::size_t A>
-template<class T, template<class...> class TLIST, class... TYPES>
-void HeteroVector<A>::visit_impl_ (T &&visitor, TLIST<TYPES...>) const  {
+    static const DispatchTable<func_t>  table {
+        { type_index_<TYPES>(),
+          &HeteroVector::visit_slot_<func_t, TYPES> } ...
+    };
 
-    // (..., visit_impl_help_<std::decay_t<T>, TYPES>(visitor)); // C++17
-    using expander = int[];
-    (void) expander { 0, (visit_impl_help_<T, TYPES>(visitor), 0) ... };
+    dispatch_ (table, visitor);
 }
 
 // ----------------------------------------------------------------------------
@@ -252,8 +368,14 @@ template<std::size_t A>
 template<class T, template<class...> class TLIST, class... TYPES>
 void HeteroVector<A>::sort_impl_ (T &&functor, TLIST<TYPES...>)  {
 
-    using expander = int[];
-    (void) expander { 0, (sort_impl_help_<T, TYPES>(functor), 0) ... };
+    using func_t = std::remove_reference_t<T>;
+
+    static const DispatchTable<func_t>  table {
+        { type_index_<TYPES>(),
+          &HeteroVector::sort_slot_<func_t, TYPES> } ...
+    };
+
+    dispatch_ (table, functor);
 }
 
 // ----------------------------------------------------------------------------
@@ -262,8 +384,14 @@ template<std::size_t A>
 template<class T, template<class...> class TLIST, class... TYPES>
 void HeteroVector<A>::change_impl_ (T &&functor, TLIST<TYPES...>)  {
 
-    using expander = int[];
-    (void) expander { 0, (change_impl_help_<T, TYPES>(functor), 0) ... };
+    using func_t = std::remove_reference_t<T>;
+
+    static const DispatchTable<func_t>  table {
+        { type_index_<TYPES>(),
+          &HeteroVector::change_slot_<func_t, TYPES> } ...
+    };
+
+    dispatch_ (table, functor);
 }
 
 // ----------------------------------------------------------------------------
@@ -272,8 +400,14 @@ template<std::size_t A>
 template<class T, template<class...> class TLIST, class... TYPES>
 void HeteroVector<A>::change_impl_ (T &&functor, TLIST<TYPES...>) const  {
 
-    using expander = int[];
-    (void) expander { 0, (change_impl_help_<T, TYPES>(functor), 0) ... };
+    using func_t = std::remove_reference_t<T>;
+
+    static const DispatchTable<func_t>  table {
+        { type_index_<TYPES>(),
+          &HeteroVector::change_slot_<func_t, TYPES> } ...
+    };
+
+    dispatch_ (table, functor);
 }
 
 // ----------------------------------------------------------------------------
@@ -363,22 +497,15 @@ template<typename T>
 const T &HeteroVector<A>::front() const  { return (get_vector<T>().front ()); }
 
 
-// ----------------------------------------------------------------------------
-
-template<std::size_t A>
-HeteroVector<A>::HeteroVector ()  {
-
-    clear_functions_.reserve(2);
-    copy_functions_.reserve(2);
-    move_functions_.reserve(2);
-}
-
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
 HeteroVector<A>::HeteroVector (const HeteroVector &that)  { *this = that; }
 template<std::size_t A>
-HeteroVector<A>::HeteroVector (HeteroVector &&that)  { *this = that; }
+HeteroVector<A>::HeteroVector (HeteroVector &&that) noexcept  {
+
+    *this = std::move(that);
+}
 
 // ----------------------------------------------------------------------------
 
@@ -387,12 +514,11 @@ HeteroVector<A> &HeteroVector<A>::operator= (const HeteroVector &rhs)  {
 
     if (&rhs != this) [[likely]]  {
         clear();
-        clear_functions_ = rhs.clear_functions_;
-        copy_functions_ = rhs.copy_functions_;
-        move_functions_ = rhs.move_functions_;
-
-        for (auto &&copy_function : copy_functions_)
-            copy_function(rhs, *this);
+        slot_.copy_from(rhs.slot_);
+        more_slots_.reserve(rhs.more_slots_.size());
+        for (const auto &rhs_slot : rhs.more_slots_)
+            more_slots_.emplace_back(std::make_unique<VecSlot>())->
+                copy_from(*rhs_slot);
     }
 
     return (*this);
@@ -401,16 +527,12 @@ HeteroVector<A> &HeteroVector<A>::operator= (const HeteroVector &rhs)  {
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
-HeteroVector<A> &HeteroVector<A>::operator= (HeteroVector &&rhs)  {
+HeteroVector<A> &HeteroVector<A>::operator= (HeteroVector &&rhs) noexcept  {
 
     if (&rhs != this) [[likely]]  {
-        clear();
-        clear_functions_ = std::move(rhs.clear_functions_);
-        copy_functions_ = std::move(rhs.copy_functions_);
-        move_functions_ = std::move(rhs.move_functions_);
-
-        for (auto &&move_function : move_functions_)
-            move_function(rhs, *this);
+        slot_.move_from(rhs.slot_);
+        more_slots_ = std::move(rhs.more_slots_);
+        rhs.more_slots_.clear();
     }
 
     return (*this);
@@ -421,8 +543,8 @@ HeteroVector<A> &HeteroVector<A>::operator= (HeteroVector &&rhs)  {
 template<std::size_t A>
 void HeteroVector<A>::clear()  {
 
-    for (auto &&clear_func : clear_functions_)
-        clear_func (*this);
+    slot_.reset();
+    more_slots_.clear();
 }
 
 } // namespace hmdf
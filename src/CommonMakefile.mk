@@ -25,6 +25,15 @@ SRCS = ../test/dataframe_tester.cc \
        ../test/gen_rand_tester.cc \
        ../test/allocator_tester.cc \
        ../test/linkedin_benchmark.cc \
+       ../benchmarks/hetero_vector_performance.cc \
+       ../benchmarks/csv2_read_performance.cc \
+       ../benchmarks/thread_pool_performance.cc \
+       ../benchmarks/sort_performance.cc \
+       ../benchmarks/parallel_sort_performance.cc \
+       ../benchmarks/groupby_performance.cc \
+       ../benchmarks/join_performance.cc \
+       ../benchmarks/selection_performance.cc \
+       ../benchmarks/visitor_performance.cc \
        Utils/DateTime.cc
 
 HEADERS = $(LOCAL_INCLUDE_DIR)/DataFrame/Vectors/HeteroVector.h \
@@ -52,6 +61,7 @@ HEADERS = $(LOCAL_INCLUDE_DIR)/DataFrame/Vectors/HeteroVector.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Internals/DataFrame_private_decl.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Internals/DataFrame_functors.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Internals/RandGen.tcc \
+          $(LOCAL_INCLUDE_DIR)/DataFrame/DataFrameReader.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/DataFrameStatsVisitors.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/DataFrameMLVisitors.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/DataFrameFinancialVisitors.h \
@@ -64,6 +74,8 @@ HEADERS = $(LOCAL_INCLUDE_DIR)/DataFrame/Vectors/HeteroVector.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/Threads/ThreadGranularity.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/Threads/SharedQueue.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/Threads/SharedQueue.tcc \
+          $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/Threads/WorkStealingDeque.h \
+          $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/Threads/WorkStealingDeque.tcc \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/Threads/ThreadPool.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/Threads/ThreadPool.tcc \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/DateTime.h \
@@ -72,6 +84,8 @@ HEADERS = $(LOCAL_INCLUDE_DIR)/DataFrame/Vectors/HeteroVector.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/Concepts.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/FixedSizeString.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/FixedSizePriorityQueue.h \
+          $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/IndexableSkipList.h \
+          $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/ReduceKernels.h \
           $(LOCAL_INCLUDE_DIR)/DataFrame/Utils/AlignedAllocator.h
 
 LIB_NAME = DataFrame
@@ -92,7 +106,16 @@ TARGETS += $(TARGET_LIB) \
            $(LOCAL_BIN_DIR)/vector_ptr_view_tester \
            $(LOCAL_BIN_DIR)/meta_prog_tester \
            $(LOCAL_BIN_DIR)/date_time_tester \
-           $(LOCAL_BIN_DIR)/gen_rand_tester
+           $(LOCAL_BIN_DIR)/gen_rand_tester \
+           $(LOCAL_BIN_DIR)/hetero_vector_performance \
+           $(LOCAL_BIN_DIR)/csv2_read_performance \
+           $(LOCAL_BIN_DIR)/thread_pool_performance \
+           $(LOCAL_BIN_DIR)/sort_performance \
+           $(LOCAL_BIN_DIR)/parallel_sort_performance \
+           $(LOCAL_BIN_DIR)/groupby_performance \
+           $(LOCAL_BIN_DIR)/join_performance \
+           $(LOCAL_BIN_DIR)/selection_performance \
+           $(LOCAL_BIN_DIR)/visitor_performance
 
 # -----------------------------------------------------------------------------
 
@@ -205,6 +228,42 @@ GEN_RAND_TESTER_OBJ = $(LOCAL_OBJ_DIR)/gen_rand_tester.o
 $(LOCAL_BIN_DIR)/gen_rand_tester: $(TARGET_LIB) $(GEN_RAND_TESTER_OBJ)
 	$(CXX) -o $@ $(GEN_RAND_TESTER_OBJ) $(LIBS)
 
+HETERO_VECTOR_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/hetero_vector_performance.o
+$(LOCAL_BIN_DIR)/hetero_vector_performance: $(TARGET_LIB) $(HETERO_VECTOR_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(HETERO_VECTOR_PERFORMANCE_OBJ) $(LIBS)
+
+CSV2_READ_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/csv2_read_performance.o
+$(LOCAL_BIN_DIR)/csv2_read_performance: $(TARGET_LIB) $(CSV2_READ_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(CSV2_READ_PERFORMANCE_OBJ) $(LIBS)
+
+THREAD_POOL_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/thread_pool_performance.o
+$(LOCAL_BIN_DIR)/thread_pool_performance: $(TARGET_LIB) $(THREAD_POOL_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(THREAD_POOL_PERFORMANCE_OBJ) $(LIBS)
+
+SORT_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/sort_performance.o
+$(LOCAL_BIN_DIR)/sort_performance: $(TARGET_LIB) $(SORT_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(SORT_PERFORMANCE_OBJ) $(LIBS)
+
+PARALLEL_SORT_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/parallel_sort_performance.o
+$(LOCAL_BIN_DIR)/parallel_sort_performance: $(TARGET_LIB) $(PARALLEL_SORT_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(PARALLEL_SORT_PERFORMANCE_OBJ) $(LIBS)
+
+GROUPBY_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/groupby_performance.o
+$(LOCAL_BIN_DIR)/groupby_performance: $(TARGET_LIB) $(GROUPBY_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(GROUPBY_PERFORMANCE_OBJ) $(LIBS)
+
+JOIN_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/join_performance.o
+$(LOCAL_BIN_DIR)/join_performance: $(TARGET_LIB) $(JOIN_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(JOIN_PERFORMANCE_OBJ) $(LIBS)
+
+SELECTION_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/selection_performance.o
+$(LOCAL_BIN_DIR)/selection_performance: $(TARGET_LIB) $(SELECTION_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(SELECTION_PERFORMANCE_OBJ) $(LIBS)
+
+VISITOR_PERFORMANCE_OBJ = $(LOCAL_OBJ_DIR)/visitor_performance.o
+$(LOCAL_BIN_DIR)/visitor_performance: $(TARGET_LIB) $(VISITOR_PERFORMANCE_OBJ)
+	$(CXX) -o $@ $(VISITOR_PERFORMANCE_OBJ) $(LIBS)
+
 # -----------------------------------------------------------------------------
 
 depend:
@@ -218,7 +277,16 @@ clean:
           $(DATAFRAME_TESTER_OBJ_3) $(HELLO_WORLD_OBJ) \
           $(DATAFRAME_PERFORMANCE_2_OBJ) $(DATAFRAME_THREAD_SAFTY_OBJ) \
           $(DATAFRAME_TESTER_SCHEMA_OBJ) $(ALLOCATOR_TESTER_OBJ) \
-          $(LINKEDIN_BENCHMARK_OBJ)
+          $(LINKEDIN_BENCHMARK_OBJ) \
+          $(HETERO_VECTOR_PERFORMANCE_OBJ) \
+          $(CSV2_READ_PERFORMANCE_OBJ) \
+          $(THREAD_POOL_PERFORMANCE_OBJ) \
+          $(SORT_PERFORMANCE_OBJ) \
+          $(PARALLEL_SORT_PERFORMANCE_OBJ) \
+          $(GROUPBY_PERFORMANCE_OBJ) \
+          $(JOIN_PERFORMANCE_OBJ) \
+          $(SELECTION_PERFORMANCE_OBJ) \
+          $(VISITOR_PERFORMANCE_OBJ)
 
 clobber:
 	rm -f $(LIB_OBJS) $(TARGETS) $(DATAFRAME_TESTER_OBJ) $(VECTORS_TESTER_OBJ) \
@@ -228,7 +296,16 @@ clobber:
           $(DATAFRAME_TESTER_OBJ_3) $(HELLO_WORLD_OBJ) \
           $(DATAFRAME_TESTER_SCHEMA_OBJ) $(ALLOCATOR_TESTER_OBJ) \
           $(DATAFRAME_PERFORMANCE_OBJ) $(DATAFRAME_PERFORMANCE_2_OBJ) \
-          $(META_PROG_OBJ) $(LINKEDIN_BENCHMARK_OBJ)
+          $(META_PROG_OBJ) $(LINKEDIN_BENCHMARK_OBJ) \
+          $(HETERO_VECTOR_PERFORMANCE_OBJ) \
+          $(CSV2_READ_PERFORMANCE_OBJ) \
+          $(THREAD_POOL_PERFORMANCE_OBJ) \
+          $(SORT_PERFORMANCE_OBJ) \
+          $(PARALLEL_SORT_PERFORMANCE_OBJ) \
+          $(GROUPBY_PERFORMANCE_OBJ) \
+          $(JOIN_PERFORMANCE_OBJ) \
+          $(SELECTION_PERFORMANCE_OBJ) \
+          $(VISITOR_PERFORMANCE_OBJ)
 
 install_lib:
 	cp -pf $(TARGET_LIB) $(PROJECT_LIB_DIR)/.
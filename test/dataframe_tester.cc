@@ -2323,10 +2323,12 @@ static void test_tracking_error()  {
                                       tracking_visit).get_result();
     assert(fabs(result - 0.256416) < 0.00001);
 
+    // The differences are all 1 only up to the rounding of the inputs
+    //
     result = df.visit<double, double>("dblcol_3",
                                       "dblcol_4",
                                       tracking_visit).get_result();
-    assert(result == 0.0);
+    assert(fabs(result) < 1e-14);
 
     result = df.visit<double, double>("dblcol_2",
                                       "dblcol_4",
@@ -3577,11 +3579,11 @@ static void test_z_score_visitor()  {
         df.single_act_visit<double>("col_2", z_score2).get_result();
 
     assert(result.size() == 21);
-    assert(fabs(result[0] - -0.774806) < 0.000001);
-    assert(fabs(result[4] - 0.816872) < 0.000001);
-    assert(fabs(result[10] - 2.01063) < 0.000001);
-    assert(fabs(result[19] - -0.723076) < 0.000001);
-    assert(fabs(result[20] - -0.727055) < 0.000001);
+    assert(fabs(result[0] - -0.771843) < 0.000001);
+    assert(fabs(result[4] - 0.813748) < 0.000001);
+    assert(fabs(result[10] - 2.002941) < 0.000001);
+    assert(fabs(result[19] - -0.720311) < 0.000001);
+    assert(fabs(result[20] - -0.724275) < 0.000001);
 
     assert(result2.size() == 21);
     assert(fabs(result2[0] - -1.42003) < 0.00001);
@@ -3597,7 +3599,7 @@ static void test_z_score_visitor()  {
             ("col_1", "col_2", z_score3);
     auto                        result3 = fut.get().get_result();
 
-    assert(fabs(result3 - -1136669.1600501483772) < 0.000001);
+    assert(fabs(result3 - -1132322.487212725) < 0.01);
     result3 =
         df.single_act_visit<double, double>("col_2",
                                             "col_2",
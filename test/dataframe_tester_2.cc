@@ -28,12 +28,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/DataFrame.h>
 #include <DataFrame/DataFrameFinancialVisitors.h>
 #include <DataFrame/DataFrameMLVisitors.h>
+#include <DataFrame/DataFrameReader.h>
 #include <DataFrame/DataFrameStatsVisitors.h>
 #include <DataFrame/DataFrameTransformVisitors.h>
 #include <DataFrame/RandGen.h>
 
 #include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <numeric>
+#include <sstream>
 #include <string>
 
 using namespace hmdf;
@@ -1398,6 +1405,440 @@ static void test_io_format_csv2()  {
 
 // -----------------------------------------------------------------------------
 
+static void test_io_format_binary()  {
+
+    std::cout << "\nTesting io_format_binary( ) ..." << std::endl;
+
+    const char  *file_name = "./io_format_binary_test.dat";
+
+    // Columns of different lengths and types
+    //
+    MyDataFrame df;
+
+    df.read("data/csv2_format_data.csv", io_format::csv2);
+    df.write<int, unsigned long, double, bool, char, unsigned char,
+             std::string>(file_name, io_format::binary);
+
+    MyDataFrame df_read;
+
+    df_read.read(file_name, io_format::binary);
+    assert(df_read.get_index().size() == 28);
+    assert(df_read.get_column<bool>("bool_col").size() == 6);
+    assert(df_read.get_column<double>("dbl_col_2").size() == 26);
+    assert(df_read.get_column<std::string>("str_col")[1] == "Description 4/5");
+    assert(df_read.get_column<char>("char_col")[2] == '^');
+    assert((df_read.is_equal<int, unsigned long, double, bool, char,
+                             unsigned char, std::string>(df)));
+
+    // Reading a chunk
+    //
+    MyDataFrame df_chunk;
+
+    df_chunk.read(file_name, io_format::binary, false, 4, 10);
+    assert(df_chunk.get_index().size() == 10);
+    assert(df_chunk.get_index()[0] == df.get_index()[4]);
+    assert(df_chunk.get_column<bool>("bool_col").size() == 2);
+    assert(! df_chunk.get_column<bool>("bool_col")[0]);
+    assert(df_chunk.get_column<bool>("bool_col")[1]);
+    assert(df_chunk.get_column<std::string>("str_col")[9] ==
+           df.get_column<std::string>("str_col")[13]);
+
+    // Columns only into a DataFrame that already has an index
+    //
+    MyDataFrame df_cols;
+
+    df_cols.load_index(MyDataFrame::IndexVecType(df.get_index()));
+    df_cols.read(file_name, io_format::binary, true);
+    assert((df_cols.is_equal<int, unsigned long, double, bool, char,
+                             unsigned char, std::string>(df)));
+    std::remove(file_name);
+
+    // DateTime index through a stream
+    //
+    using DT_DataFrame = StdDataFrame<DateTime>;
+
+    DT_DataFrame        dt_df;
+    DT_DataFrame        dt_df_read;
+    std::stringstream   ss (std::ios_base::in |
+                            std::ios_base::out |
+                            std::ios_base::binary);
+
+    dt_df.read("data/DT_IBM.csv", io_format::csv2);
+    dt_df.write<std::ostream, double, long>(ss, io_format::binary);
+    dt_df_read.read(ss, io_format::binary);
+    assert(dt_df_read.get_index().size() == 5031);
+    assert(dt_df_read.get_index()[18] == DateTime(20001128));
+    assert(dt_df_read.get_column<long>("IBM_Volume")[5022] == 21501100L);
+    assert((dt_df_read.is_equal<double, long>(dt_df)));
+
+    // String index and 256 byte alignment
+    //
+    using StrDataFrame = StdDataFrame256<std::string>;
+
+    StrDataFrame    str_df;
+    StrDataFrame    str_df_read;
+
+    str_df.read("data/IBM.csv", io_format::csv2);
+    str_df.write<double, long>(file_name, io_format::binary);
+    str_df_read.read(file_name, io_format::binary);
+    assert(str_df_read.get_index()[0] == "2000-11-01");
+    assert((str_df_read.is_equal<double, long>(str_df)));
+    std::remove(file_name);
+
+    // Types that cannot be stored in binary format
+    //
+    MyDataFrame df_vec;
+
+    df_vec.load_index(MyDataFrame::gen_sequence_index(0, 3));
+    df_vec.load_column<std::vector<double>>(
+        "vec_col",
+        { { 1.0 }, { 2.0, 3.0 }, { } });
+    try  {
+        std::stringstream   ss2;
+
+        df_vec.write<std::ostream, std::vector<double>>(ss2,
+                                                        io_format::binary);
+        assert(false);
+    }
+    catch (const NotImplemented &)  {   }
+
+    // The longest column name a DataFrame holds must come back whole
+    //
+    const std::string   long_name (70, 'x');
+    MyDataFrame         df_long;
+    MyDataFrame         df_long_read;
+    std::stringstream   ss3 (std::ios_base::in |
+                             std::ios_base::out |
+                             std::ios_base::binary);
+
+    df_long.load_index(MyDataFrame::gen_sequence_index(0, 3));
+    df_long.load_column<double>(long_name.c_str(), { 1.0, 2.0, 3.0 });
+    df_long.write<std::ostream, double>(ss3, io_format::binary);
+    df_long_read.read(ss3, io_format::binary);
+    assert(df_long_read.get_column<double>(long_name.c_str())[2] == 3.0);
+    assert((df_long_read.is_equal<double>(df_long)));
+
+    // A name that doesn't fit the column directory is not cut
+    //
+    try  {
+        std::stringstream               ss4;
+        std::vector<_bin_col_desc_>     dir;
+        std::size_t                     pos { 0 };
+
+        _write_bin_col_(ss4, long_name.c_str(),
+                        std::vector<double> { 1.0 }, 0, 1, 64, pos, dir);
+        assert(false);
+    }
+    catch (const DataFrameError &)  {   }
+}
+// -----------------------------------------------------------------------------
+
+static void test_read_csv2_parallel()  {
+
+    std::cout << "\nTesting read_csv2_parallel( ) ..." << std::endl;
+
+    using StrDataFrame = StdDataFrame<std::string>;
+
+    const auto      thr_level = MyDataFrame::get_thread_level();
+    MyDataFrame     serial_df;
+    MyDataFrame     serial_chunk;
+    StrDataFrame    serial_str_df;
+
+    // Reading from a stream always goes through the serial reader
+    //
+    {
+        std::ifstream   ford_s ("data/FORD.csv");
+        std::ifstream   ford_chunk_s ("data/FORD.csv");
+        std::ifstream   ibm_s ("data/IBM.csv");
+
+        serial_df.read(ford_s, io_format::csv2);
+        serial_chunk.read(ford_chunk_s, io_format::csv2, false, 1000, 5000);
+        serial_str_df.read(ibm_s, io_format::csv2);
+    }
+
+    MyDataFrame     par_df;
+    MyDataFrame     par_chunk;
+    MyDataFrame     par_cols;
+    StrDataFrame    par_str_df;
+
+    MyDataFrame::set_thread_level(4);
+    par_df.read("data/FORD.csv", io_format::csv2);
+    par_chunk.read("data/FORD.csv", io_format::csv2, false, 1000, 5000);
+    par_cols.load_index(MyDataFrame::IndexVecType(serial_df.get_index()));
+    par_cols.read("data/FORD.csv", io_format::csv2, true);
+    par_str_df.read("data/IBM.csv", io_format::csv2);
+    MyDataFrame::set_thread_level(thr_level);
+
+    assert(par_df.get_index().size() == 12265);
+    assert(par_df.get_column<std::string>("Date")[12264] == "01/19/2021");
+    assert((par_df.is_equal<double, long, std::string>(serial_df)));
+    // FORD.csv has \r\n line endings. So the same as read_csv2_(), every
+    // \r and \n counts as a row when skipping to starting_row.
+    //
+    assert(par_chunk.get_index().size() == serial_chunk.get_index().size());
+    assert(par_chunk.get_index()[0] == 500);
+    assert((par_chunk.is_equal<double, long, std::string>(serial_chunk)));
+    assert((par_cols.is_equal<double, long, std::string>(serial_df)));
+    assert(par_str_df.get_index()[5030] == serial_str_df.get_index()[5030]);
+    assert((par_str_df.is_equal<double, long>(serial_str_df)));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_read_csv2_in_place()  {
+
+    std::cout << "\nTesting read_csv2_in_place( ) ..." << std::endl;
+
+    const char  *file_name = "./test_read_csv2_in_place.csv";
+
+    {
+        const std::string   content =
+            "INDEX:4:<ulong>,int_col:4:<int>,long_col:4:<long>,"
+            "ulong_col:4:<ulong>,dbl_col:4:<double>,flt_col:4:<float>,"
+            "bool_col:4:<bool>,char_col:4:<char>,str_col:4:<string>\n"
+            "1,010,0x1F,-5,0x1p3,1e-50,2,65,abc\n"
+            "# A comment line\n"
+            "2,+7, 12,18446744073709551616,inf,-.5,0,x,\n"
+            "3,-2147483649,-9223372036854775807,007,1.5e+3,3.25,1,7,"
+            "a longer string than sixteen bytes\r\n"
+            "4,42,,18446744073709551615,-0.000125,1e40,,,last\n";
+        std::ofstream       out (file_name, std::ios_base::binary);
+
+        out.write(content.data(), content.size());
+    }
+
+    MyDataFrame     stream_df;
+    MyDataFrame     file_df;
+
+    {
+        std::ifstream   in (file_name);
+
+        stream_df.read(in, io_format::csv2);
+    }
+    file_df.read(file_name, io_format::csv2);
+    std::remove(file_name);
+
+    assert((file_df.is_equal<int, long, unsigned long, double, float, bool,
+                             char, std::string>(stream_df)));
+
+    const auto  &int_col = file_df.get_column<int>("int_col");
+    const auto  &long_col = file_df.get_column<long>("long_col");
+    const auto  &ulong_col = file_df.get_column<unsigned long>("ulong_col");
+    const auto  &dbl_col = file_df.get_column<double>("dbl_col");
+    const auto  &flt_col = file_df.get_column<float>("flt_col");
+    const auto  &char_col = file_df.get_column<char>("char_col");
+    const auto  &str_col = file_df.get_column<std::string>("str_col");
+
+    assert(file_df.get_index().size() == 4);
+    assert(int_col.size() == 4);
+    assert(int_col[0] == 8);  // Octal
+    assert(int_col[1] == 7);
+    assert(int_col[3] == 42);
+    assert(long_col.size() == 3);  // Empty numeric cells are skipped
+    assert(long_col[0] == 31);
+    assert(long_col[1] == 12);
+    assert(long_col[2] == -9223372036854775807L);
+    assert(ulong_col[0] == std::numeric_limits<unsigned long>::max() - 4);
+    assert(ulong_col[1] == std::numeric_limits<unsigned long>::max());
+    assert(ulong_col[2] == 7);
+    assert(dbl_col[0] == 8.0);
+    assert(std::isinf(dbl_col[1]));
+    assert(dbl_col[2] == 1500.0);
+    assert(dbl_col[3] == -0.000125);
+    assert(flt_col[0] == 0.0f);
+    assert(flt_col[1] == -0.5f);
+    assert(flt_col[2] == 3.25f);
+    assert(std::isinf(flt_col[3]));
+    assert(char_col[0] == 'A');
+    assert(char_col[1] == 'x');
+    assert(char_col[2] == '7');
+    // An empty cell at the end of a row is dropped, even for strings
+    //
+    assert(str_col.size() == 3);
+    assert(str_col[1] == "a longer string than sixteen bytes\r");
+    assert(str_col[2] == "last");
+}
+
+// -----------------------------------------------------------------------------
+
+// A stream with non-default flags is written cell by cell. unitbuf does not
+// change the formatting, so that is the expected output.
+//
+template<typename ... Ts>
+static bool write_csv2_both(const MyDataFrame &df,
+                            std::streamsize precision,
+                            long max_recs,
+                            bool columns_only)  {
+
+    std::ostringstream  buffered;
+    std::ostringstream  by_cell;
+
+    by_cell.setf(std::ios_base::unitbuf);
+    df.write<std::ostream, Ts ...>(buffered, io_format::csv2,
+                                   precision, columns_only, max_recs);
+    df.write<std::ostream, Ts ...>(by_cell, io_format::csv2,
+                                   precision, columns_only, max_recs);
+    return (! buffered.str().empty() && buffered.str() == by_cell.str());
+}
+
+static void test_write_csv2_buffered()  {
+
+    std::cout << "\nTesting write_csv2_buffered( ) ..." << std::endl;
+
+    constexpr long  all_recs = std::numeric_limits<long>::max();
+
+    MyDataFrame df;
+
+    // Columns of different lengths, char, uchar and bool columns
+    //
+    df.read("data/csv2_format_data.csv", io_format::csv2);
+    assert((write_csv2_both<int, unsigned long, double, bool, char,
+                            unsigned char, std::string>
+                (df, 12, all_recs, false)));
+    assert((write_csv2_both<int, unsigned long, double, bool, char,
+                            unsigned char, std::string>
+                (df, 12, all_recs, true)));
+    assert((write_csv2_both<int, unsigned long, double, bool, char,
+                            unsigned char, std::string>
+                (df, 3, -7, false)));
+
+    MyDataFrame ford_df;
+
+    ford_df.read("data/FORD.csv", io_format::csv2);
+    assert((write_csv2_both<double, long, std::string>
+                (ford_df, 4, all_recs, false)));
+
+    // Parallel formatting
+    //
+    const auto  thr_level = MyDataFrame::get_thread_level();
+
+    MyDataFrame::set_thread_level(4);
+    assert((write_csv2_both<double, long, std::string>
+                (ford_df, 12, all_recs, false)));
+    assert((write_csv2_both<double, long, std::string>
+                (ford_df, 4, -10001, true)));
+    MyDataFrame::set_thread_level(thr_level);
+
+    std::stringstream   ss;
+    MyDataFrame         df_read;
+
+    ford_df.write<std::ostream, double, long, std::string>(ss,
+                                                           io_format::csv2);
+    df_read.read(ss, io_format::csv2);
+    assert((df_read.is_equal<double, long, std::string>(ford_df)));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_DataFrameReader()  {
+
+    std::cout << "\nTesting DataFrameReader{ } ..." << std::endl;
+
+    MyDataFrame df;
+
+    df.read("data/FORD.csv", io_format::csv2);
+
+    const auto  &index = df.get_index();
+    const auto  &close = df.get_column<double>("FORD_Close");
+    const auto  &date = df.get_column<std::string>("Date");
+
+    DataFrameReader<MyDataFrame>    reader ("data/FORD.csv", 1000);
+    MyDataFrame                     chunk;
+    std::size_t                     chunk_cnt = 0;
+    std::size_t                     row_cnt = 0;
+    double                          close_sum = 0;
+
+    while (reader.next(chunk))  {
+        const auto  &chunk_idx = chunk.get_index();
+        const auto  &chunk_close = chunk.get_column<double>("FORD_Close");
+
+        assert(chunk_idx.size() <= 1000);
+        assert(chunk_idx[0] == index[row_cnt]);
+        assert(chunk_close.back() == close[row_cnt + chunk_close.size() - 1]);
+        assert(chunk.get_column<std::string>("Date")[0] == date[row_cnt]);
+        for (const double c : chunk_close)  close_sum += c;
+        row_cnt += chunk_idx.size();
+        chunk_cnt += 1;
+    }
+    assert(chunk_cnt == 13);
+    assert(row_cnt == 12265);
+    assert(reader.rows_read() == 12265);
+    assert(! reader.next(chunk));
+    assert(std::fabs(close_sum -
+                     std::accumulate(close.begin(), close.end(), 0.0)) <
+           0.0000001);
+
+    // Comment lines do not count as rows
+    //
+    std::stringstream               ss (
+        "# Comment\n\nINDEX:3:<ulong>,col_1:3:<double>\n"
+        "1,1.5\n# Comment\n2,2.5\n3,3.5");
+    DataFrameReader<MyDataFrame>    ss_reader (ss, 2);
+
+    assert(ss_reader.next(chunk));
+    assert(chunk.get_index().size() == 2);
+    assert(chunk.get_column<double>("col_1")[1] == 2.5);
+    assert(ss_reader.next(chunk));
+    assert(chunk.get_index().size() == 1);
+    assert(chunk.get_index()[0] == 3);
+    assert(chunk.get_column<double>("col_1")[0] == 3.5);
+    assert(! ss_reader.next(chunk));
+
+    // Empty lines do not count as rows in a chunk either
+    //
+    const char  *blank_data =
+        "INDEX:4:<ulong>,col_1:4:<double>\n"
+        "1,1.5\n2,2.5\n\n3,3.5\n4,4.5\n";
+    std::stringstream               blank_ss (blank_data);
+    DataFrameReader<MyDataFrame>    blank_reader (blank_ss, 1);
+    std::size_t                     blank_cnt = 0;
+
+    while (blank_reader.next(chunk))  {
+        assert(chunk.get_index().size() == 1);
+        blank_cnt += 1;
+        assert(chunk.get_index()[0] == blank_cnt);
+        assert(chunk.get_column<double>("col_1")[0] == blank_cnt + 0.5);
+    }
+    assert(blank_cnt == 4);
+    assert(blank_reader.rows_read() == 4);
+
+    // But read() counts them toward num_rows, from a file or a stream
+    //
+    const char  *blank_file = "./csv2_blank_lines_test.csv";
+
+    {
+        std::ofstream   blank_os (blank_file);
+
+        blank_os << blank_data;
+    }
+    for (const std::size_t starting_row : { 0, 1 })  {
+        std::stringstream   blank_in (blank_data);
+        MyDataFrame         file_df;
+        MyDataFrame         stream_df;
+
+        file_df.read(blank_file, io_format::csv2, false, starting_row, 3);
+        stream_df.read(blank_in, io_format::csv2, false, starting_row, 3);
+        assert(file_df.get_index().size() == 2);
+        assert(file_df.get_index()[0] == starting_row + 1);
+        assert(file_df.get_column<double>("col_1").size() == 2);
+        assert((file_df.is_equal<double>(stream_df)));
+    }
+    std::remove(blank_file);
+
+    // A chunk of only comments at the end of the stream
+    //
+    std::stringstream               tail_ss (
+        "INDEX:2:<ulong>,col_1:2:<double>\n1,1.5\n2,2.5\n#\n\n# End\n");
+    DataFrameReader<MyDataFrame>    tail_reader (tail_ss, 2);
+
+    assert(tail_reader.next(chunk));
+    assert(chunk.get_index().size() == 2);
+    assert(! tail_reader.next(chunk));
+    assert(tail_reader.rows_read() == 2);
+}
+
+// -----------------------------------------------------------------------------
+
 static void test_BoxCoxVisitor()  {
 
     std::cout << "\nTesting BoxCoxVisitor{ } ..." << std::endl;
@@ -5156,6 +5597,1812 @@ static void test_get_view_by_idx_values()  {
 
 // -----------------------------------------------------------------------------
 
+static void test_thread_cost_model()  {
+
+    std::cout << "\nTesting thread cost model ..." << std::endl;
+
+    using TG = ThreadGranularity;
+
+    const TG::ThreadCost    saved = TG::get_thread_cost();
+    const long              capacity = TG::get_thread_level();
+
+    TG::set_thread_cost({ 0.1, 1000.0, 10.0 });
+    assert(TG::get_thread_cost().ns_per_byte == 0.1);
+    assert(TG::get_thread_cost().ns_per_task == 1000.0);
+    assert(TG::get_thread_cost().min_task_ratio == 10.0);
+
+    // Small operations always run on the calling thread
+    //
+    assert(TG::get_thread_level(0, TG::SORT_WORK) == 0);
+    assert(TG::get_thread_level(100, TG::VISIT_WORK) == 0);
+    assert(TG::get_thread_level(100, TG::VISIT_WORK, 10) == 0);
+
+    // Big operations use at most all the threads
+    //
+    const long  big = TG::get_thread_level(10'000'000, TG::VISIT_WORK);
+
+    assert(capacity < 2 ? big == 0 : big == capacity);
+
+    // More work per row is worth at least as many threads
+    //
+    assert(TG::get_thread_level(50'000, TG::COPY_WORK) <=
+           TG::get_thread_level(50'000, TG::GATHER_WORK));
+    assert(TG::get_thread_level(50'000, TG::GATHER_WORK) <=
+           TG::get_thread_level(50'000, TG::SORT_WORK));
+    assert(TG::get_thread_level(50'000, TG::COPY_WORK, 1) <=
+           TG::get_thread_level(50'000, TG::COPY_WORK, 8));
+
+    TG::set_thread_cost(saved);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_radix_sort()  {
+
+    std::cout << "\nTesting radix sort ..." << std::endl;
+
+    // It must be big enough to use the radix sort
+    //
+    constexpr std::size_t   item_cnt = 10000;
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+    StlVecType<int>             int_vec(item_cnt);
+    StlVecType<std::string>     str_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl_vec[i] = double(int(i % 101) - 50) / 4.0;
+        int_vec[i] = int(i % 7) - 3;
+        str_vec[i] = std::to_string(i);
+    }
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl_col", dbl_vec),
+                 std::make_pair("int_col", int_vec),
+                 std::make_pair("str_col", str_vec));
+    df.sort<int, double, int, double, std::string>
+        ("int_col", sort_spec::abs_ascen, "dbl_col", sort_spec::desce);
+
+    const auto  &index = df.get_index();
+    const auto  &dbl_col = df.get_column<double>("dbl_col");
+    const auto  &int_col = df.get_column<int>("int_col");
+    const auto  &str_col = df.get_column<std::string>("str_col");
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        assert(dbl_col[i] == dbl_vec[index[i]]);
+        assert(int_col[i] == int_vec[index[i]]);
+        assert(str_col[i] == str_vec[index[i]]);
+        if (i > 0)  {
+            assert(std::abs(int_col[i - 1]) <= std::abs(int_col[i]));
+            if (std::abs(int_col[i - 1]) == std::abs(int_col[i]))  {
+                assert(dbl_col[i - 1] >= dbl_col[i]);
+
+                // The sort is stable
+                //
+                if (dbl_col[i - 1] == dbl_col[i])
+                    assert(index[i - 1] < index[i]);
+            }
+        }
+    }
+
+    df.sort<unsigned long, double, int, std::string>
+        (DF_INDEX_COL_NAME, sort_spec::desce);
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        assert(index[i] == item_cnt - i - 1);
+        assert(dbl_col[i] == dbl_vec[index[i]]);
+        assert(str_col[i] == str_vec[index[i]]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_hash_groupby()  {
+
+    std::cout << "\nTesting hash groupby ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 10000;
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<int>             int_vec(item_cnt);
+    StlVecType<long>            lng_vec(item_cnt);
+    StlVecType<std::string>     str_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i % 13;
+        int_vec[i] = int((item_cnt - i) % 97);
+        lng_vec[i] = long(i);
+        str_vec[i] = std::to_string(i % 5);
+    }
+    df.load_data(std::move(idx),
+                 std::make_pair("int_col", int_vec),
+                 std::make_pair("lng_col", lng_vec),
+                 std::make_pair("str_col", str_vec));
+
+    const auto  check_same =
+        [](const MyDataFrame &lhs, const MyDataFrame &rhs)  {
+            assert(lhs.get_index() == rhs.get_index());
+            assert(lhs.get_column<long>("sum_lng") ==
+                   rhs.get_column<long>("sum_lng"));
+            assert(lhs.get_column<long>("max_lng") ==
+                   rhs.get_column<long>("max_lng"));
+            assert(lhs.get_column<std::size_t>("cnt_lng") ==
+                   rhs.get_column<std::size_t>("cnt_lng"));
+        };
+
+    const auto  gb1 =
+        [&df](groupby_policy policy)  {
+            return (df.groupby1<int>
+                        (policy,
+                         "int_col",
+                         MinVisitor<unsigned long, unsigned long>(),
+                         std::make_tuple("lng_col", "sum_lng",
+                                         SumVisitor<long>()),
+                         std::make_tuple("lng_col", "max_lng",
+                                         MaxVisitor<long>()),
+                         std::make_tuple("lng_col", "cnt_lng",
+                                         CountVisitor<long>())));
+        };
+    const auto  sort_res1 = gb1(groupby_policy::sort);
+    const auto  hash_res1 = gb1(groupby_policy::hash_sorted);
+
+    assert(sort_res1.get_index().size() == 97);
+    check_same(sort_res1, hash_res1);
+    assert(sort_res1.get_column<int>("int_col") ==
+           hash_res1.get_column<int>("int_col"));
+
+    // Groups are in the order they first appear
+    //
+    const auto  unsorted_res1 = gb1(groupby_policy::hash_unsorted);
+    const auto  &keys = unsorted_res1.get_column<int>("int_col");
+    const auto  &maxes = unsorted_res1.get_column<long>("max_lng");
+
+    assert(keys.size() == 97);
+    for (std::size_t i = 0; i < keys.size(); ++i)  {
+        assert(keys[i] == int_vec[i]);
+        assert(maxes[i] == long(item_cnt - 1 - (item_cnt - 1 - i) % 97));
+    }
+
+    const auto  gb3 =
+        [&df](groupby_policy policy)  {
+            return (df.groupby3<std::string, unsigned long, int>
+                        (policy,
+                         "str_col",
+                         DF_INDEX_COL_NAME,
+                         "int_col",
+                         LastVisitor<unsigned long, unsigned long>(),
+                         std::make_tuple("lng_col", "sum_lng",
+                                         SumVisitor<long>()),
+                         std::make_tuple("lng_col", "max_lng",
+                                         MaxVisitor<long>()),
+                         std::make_tuple("lng_col", "cnt_lng",
+                                         CountVisitor<long>())));
+        };
+    const auto  sort_res3 = gb3(groupby_policy::sort);
+    const auto  hash_res3 = gb3(groupby_policy::hash_sorted);
+
+    check_same(sort_res3, hash_res3);
+    assert(sort_res3.get_column<std::string>("str_col") ==
+           hash_res3.get_column<std::string>("str_col"));
+    assert(sort_res3.get_column<int>("int_col") ==
+           hash_res3.get_column<int>("int_col"));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_parallel_groupby()  {
+
+    std::cout << "\nTesting parallel groupby ..." << std::endl;
+
+    using TG = ThreadGranularity;
+
+    constexpr std::size_t   item_cnt = 100000;
+
+    const TG::ThreadCost    saved = TG::get_thread_cost();
+    const auto              thr_level = MyDataFrame::get_thread_level();
+
+    MyDataFrame::set_thread_level(4);
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<int>             int_vec(item_cnt);
+    StlVecType<long>            lng_vec(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        int_vec[i] = int((i * 7) % 1000);
+        lng_vec[i] = long(i % 13) - 6;
+        dbl_vec[i] = double(i % 101) * 0.5;
+    }
+    // A few big groups, so most of them span more than one thread
+    //
+    for (std::size_t i = 0; i < item_cnt; i += 3)  int_vec[i] = 5;
+    df.load_data(std::move(idx),
+                 std::make_pair("int_col", int_vec),
+                 std::make_pair("lng_col", lng_vec),
+                 std::make_pair("dbl_col", dbl_vec));
+
+    const auto  gb =
+        [&df](groupby_policy policy)  {
+            return (df.groupby1<int>
+                        (policy,
+                         "int_col",
+                         LastVisitor<unsigned long, unsigned long>(),
+                         std::make_tuple("lng_col", "sum_lng",
+                                         SumVisitor<long>()),
+                         std::make_tuple("lng_col", "cnt_lng",
+                                         CountVisitor<long>()),
+                         std::make_tuple("lng_col", "first_lng",
+                                         FirstVisitor<long>()),
+                         std::make_tuple("dbl_col", "max_dbl",
+                                         MaxVisitor<double>()),
+                         std::make_tuple("dbl_col", "mean_dbl",
+                                         MeanVisitor<double>()),
+                         std::make_tuple("dbl_col", "var_dbl",
+                                         VarVisitor<double>())));
+        };
+
+    for (const auto policy : { groupby_policy::sort,
+                               groupby_policy::hash_unsorted })  {
+
+        // Never worth threads
+        //
+        TG::set_thread_cost({ 0.1, 1.0e12, 20.0 });
+
+        const auto  serial = gb(policy);
+
+        // Always worth threads
+        //
+        TG::set_thread_cost({ 1.0, 1.0, 1.0 });
+
+        const auto  parallel = gb(policy);
+
+        assert(serial.get_index().size() == 1000);
+        assert(serial.get_column<int>("int_col") ==
+               parallel.get_column<int>("int_col"));
+        assert(serial.get_column<std::size_t>("cnt_lng") ==
+               parallel.get_column<std::size_t>("cnt_lng"));
+        assert(serial.get_column<double>("max_dbl") ==
+               parallel.get_column<double>("max_dbl"));
+
+        // The visitors see the rows of a group in their original order only
+        // with the hash policies
+        //
+        if (policy == groupby_policy::hash_unsorted)  {
+            assert(serial.get_index() == parallel.get_index());
+            assert(serial.get_column<long>("first_lng") ==
+                   parallel.get_column<long>("first_lng"));
+        }
+        assert(serial.get_column<long>("sum_lng") ==
+               parallel.get_column<long>("sum_lng"));
+
+        const auto  &mean1 = serial.get_column<double>("mean_dbl");
+        const auto  &mean2 = parallel.get_column<double>("mean_dbl");
+        const auto  &var1 = serial.get_column<double>("var_dbl");
+        const auto  &var2 = parallel.get_column<double>("var_dbl");
+
+        for (std::size_t i = 0; i < mean1.size(); ++i)  {
+            assert(std::fabs(mean1[i] - mean2[i]) < 1e-9);
+            assert(std::fabs(var1[i] - var2[i]) < 1e-6);
+        }
+    }
+
+    TG::set_thread_cost(saved);
+    MyDataFrame::set_thread_level(thr_level);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_grouping()  {
+
+    std::cout << "\nTesting get_grouping( ) ..." << std::endl;
+
+    using TG = ThreadGranularity;
+
+    constexpr std::size_t   item_cnt = 20000;
+
+    const TG::ThreadCost    saved = TG::get_thread_cost();
+    const auto              thr_level = MyDataFrame::get_thread_level();
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<int>             int_vec(item_cnt);
+    StlVecType<std::string>     str_vec(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        int_vec[i] = int(i % 37);
+        str_vec[i] = (i % 3) ? "AA" : "BB";
+        dbl_vec[i] = double((i * 13) % 1001) * 0.25;
+    }
+    df.load_data(std::move(idx),
+                 std::make_pair("int_col", int_vec),
+                 std::make_pair("str_col", str_vec),
+                 std::make_pair("dbl_col", dbl_vec));
+
+    const auto  grp1 = df.get_grouping1<int>("int_col");
+
+    assert(grp1.group_count() == 37);
+    assert(grp1.permutation.size() == item_cnt);
+    assert(grp1.offsets.front() == 0);
+    assert(grp1.offsets.back() == item_cnt);
+
+    const auto  agg1 =
+        df.groupby(grp1,
+                   LastVisitor<unsigned long, unsigned long>(),
+                   std::make_tuple("int_col", "int_col", FirstVisitor<int>()),
+                   std::make_tuple("dbl_col", "sum_dbl",
+                                   SumVisitor<double>()));
+    const auto  agg2 =
+        df.groupby(grp1,
+                   LastVisitor<unsigned long, unsigned long>(),
+                   std::make_tuple("dbl_col", "cnt_dbl",
+                                   CountVisitor<double>()));
+    const auto  gb1 =
+        df.groupby1<int>("int_col",
+                         LastVisitor<unsigned long, unsigned long>(),
+                         std::make_tuple("dbl_col", "sum_dbl",
+                                         SumVisitor<double>()),
+                         std::make_tuple("dbl_col", "cnt_dbl",
+                                         CountVisitor<double>()));
+
+    assert(agg1.get_index() == gb1.get_index());
+    assert(agg2.get_index() == gb1.get_index());
+    assert(agg1.get_column<int>("int_col") == gb1.get_column<int>("int_col"));
+    assert(agg1.get_column<double>("sum_dbl") ==
+           gb1.get_column<double>("sum_dbl"));
+    assert(agg2.get_column<std::size_t>("cnt_dbl") ==
+           gb1.get_column<std::size_t>("cnt_dbl"));
+    assert(! agg2.has_column("int_col"));
+
+    // Index as a group-by column, with a hash policy
+    //
+    const auto  grp_idx =
+        df.get_grouping1<unsigned long>(DF_INDEX_COL_NAME,
+                                        groupby_policy::hash_unsorted);
+
+    assert(grp_idx.group_count() == item_cnt);
+
+    // Not mergeable visitors, one column per thread
+    //
+    MyDataFrame::set_thread_level(4);
+    TG::set_thread_cost({ 1.0, 1.0, 1.0 });
+
+    const auto  grp2 =
+        df.get_grouping2<std::string, int>("str_col", "int_col",
+                                           groupby_policy::hash_sorted);
+    const auto  agg3 =
+        df.groupby(grp2,
+                   LastVisitor<unsigned long, unsigned long>(),
+                   std::make_tuple("dbl_col", "median_dbl",
+                                   MedianVisitor<double>()),
+                   std::make_tuple("dbl_col", "max_dbl",
+                                   MaxVisitor<double>()),
+                   std::make_tuple("int_col", "median_int",
+                                   MedianVisitor<int>()));
+
+    TG::set_thread_cost({ 0.1, 1.0e12, 20.0 });
+
+    const auto  gb2 =
+        df.groupby2<std::string, int>(
+            groupby_policy::hash_sorted,
+            "str_col", "int_col",
+            LastVisitor<unsigned long, unsigned long>(),
+            std::make_tuple("dbl_col", "median_dbl",
+                            MedianVisitor<double>()),
+            std::make_tuple("int_col", "median_int",
+                            MedianVisitor<int>()));
+
+    assert(grp2.group_count() == 74);
+    assert(agg3.get_index() == gb2.get_index());
+    assert(agg3.get_column<double>("median_dbl") ==
+           gb2.get_column<double>("median_dbl"));
+    assert(agg3.get_column<int>("median_int") ==
+           gb2.get_column<int>("median_int"));
+    assert(agg3.get_column<double>("max_dbl").size() == 74);
+
+    TG::set_thread_cost(saved);
+    MyDataFrame::set_thread_level(thr_level);
+
+    // A Grouping that does not fit the DataFrame is rejected
+    //
+    const auto  bad_groupby =
+        [&df](const MyDataFrame::Grouping &grp) -> bool  {
+            try  {
+                auto    res =
+                    df.groupby(grp,
+                               LastVisitor<unsigned long, unsigned long>(),
+                               std::make_tuple("dbl_col", "sum_dbl",
+                                               SumVisitor<double>()));
+            }
+            catch (const InconsistentData &)  { return (true); }
+            return (false);
+        };
+    MyDataFrame::Grouping   bad_grp = grp1;
+
+    assert(! bad_groupby(bad_grp));
+    bad_grp.offsets.front() = 1;
+    assert(bad_groupby(bad_grp));
+    bad_grp = grp1;
+    bad_grp.offsets.back() -= 1;
+    assert(bad_groupby(bad_grp));
+    bad_grp = grp1;
+    std::swap(bad_grp.offsets[3], bad_grp.offsets[4]);
+    assert(bad_groupby(bad_grp));
+    bad_grp = grp1;
+    bad_grp.offsets[4] = bad_grp.offsets[3];  // An empty group
+    assert(bad_groupby(bad_grp));
+    bad_grp = grp1;
+    bad_grp.offsets.clear();
+    assert(bad_groupby(bad_grp));
+    bad_grp = grp1;
+    bad_grp.permutation[100] = item_cnt;
+    assert(bad_groupby(bad_grp));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_join_strategies()  {
+
+    std::cout << "\nTesting join strategies ..." << std::endl;
+
+    constexpr std::size_t   big_cnt = 2000;
+    constexpr std::size_t   small_cnt = 100;
+
+    // Unique but shuffled keys on both sides
+    //
+    StlVecType<unsigned long>   big_idx(big_cnt);
+    StlVecType<int>             big_ints(big_cnt);
+    StlVecType<unsigned long>   small_idx(small_cnt);
+    StlVecType<double>          small_dbls(small_cnt);
+
+    for (std::size_t i = 0; i < big_cnt; ++i)  {
+        big_idx[i] = (i * 7919) % big_cnt;
+        big_ints[i] = int(big_idx[i]) * 2;
+    }
+    for (std::size_t i = 0; i < small_cnt; ++i)  {
+        small_idx[i] = ((i * 37) % small_cnt) * 30;
+        small_dbls[i] = double(small_idx[i]) + 0.5;
+    }
+
+    MyDataFrame big;
+    MyDataFrame small;
+
+    big.load_data(std::move(big_idx), std::make_pair("ints", big_ints));
+    small.load_data(std::move(small_idx),
+                    std::make_pair("dbls", small_dbls));
+
+    const auto  same_dbls =
+        [](const auto &lhs, const auto &rhs) -> bool  {
+            if (lhs.size() != rhs.size())  return (false);
+            for (std::size_t i = 0; i < lhs.size(); ++i)
+                if (lhs[i] != rhs[i] &&
+                    ! (std::isnan(lhs[i]) && std::isnan(rhs[i])))
+                    return (false);
+            return (true);
+        };
+
+    MyDataFrame big_sorted = big;
+    MyDataFrame small_sorted = small;
+
+    big_sorted.sort<unsigned long, int, double>(DF_INDEX_COL_NAME,
+                                                sort_spec::ascen);
+    small_sorted.sort<unsigned long, int, double>(DF_INDEX_COL_NAME,
+                                                  sort_spec::ascen);
+
+    for (const auto policy : { join_policy::inner_join,
+                               join_policy::left_join,
+                               join_policy::right_join,
+                               join_policy::left_right_join })  {
+        // Hash join for some of the policies, sort-merge for the rest
+        //
+        const auto  res1 =
+            small.join_by_index<MyDataFrame, int, double>(big, policy);
+        const auto  res2 =
+            big.join_by_index<MyDataFrame, int, double>(small, policy);
+
+        // Straight merge
+        //
+        const auto  res3 =
+            small_sorted.join_by_index<MyDataFrame, int, double>
+                (big_sorted, policy, sort_state::sorted);
+        const auto  res4 =
+            big_sorted.join_by_index<MyDataFrame, int, double>
+                (small_sorted, policy);
+
+        assert(res1.get_index() == res3.get_index());
+        assert(res1.get_column<int>("ints") == res3.get_column<int>("ints"));
+        assert(res2.get_index() == res4.get_index());
+        assert(same_dbls(res2.get_column<double>("dbls"),
+                         res4.get_column<double>("dbls")));
+    }
+
+    const auto  inner =
+        small.join_by_index<MyDataFrame, int, double>
+            (big, join_policy::inner_join);
+
+    assert(inner.get_index().size() == 67);
+    assert(inner.get_index()[0] == 0);
+    assert(inner.get_index()[1] == 30);
+    assert(inner.get_column<int>("ints")[1] == 60);
+    assert(inner.get_column<double>("dbls")[66] == 1980.5);
+
+    // Duplicate keys by column, hash join
+    //
+    MyDataFrame         lhs;
+    MyDataFrame         rhs;
+    StlVecType<int>     lhs_keys = { 5, 3, 5, 9, 1, 3, 5, 7, 9, 2, 8, 6,
+                                     4, 3, 2, 1, 0, 9, 8, 7, 6, 3, 0, 9 };
+    StlVecType<int>     rhs_keys = { 3, 9, 3 };
+    StlVecType<double>  rhs_vals = { 30.0, 90.0, 31.0 };
+
+    lhs.load_data(MyDataFrame::gen_sequence_index(0, lhs_keys.size(), 1),
+                  std::make_pair("key", lhs_keys));
+    rhs.load_data(MyDataFrame::gen_sequence_index(100, 103, 1),
+                  std::make_pair("key", rhs_keys),
+                  std::make_pair("val", rhs_vals));
+
+    const auto  by_col =
+        lhs.join_by_column<MyDataFrame, int, double>
+            (rhs, "key", join_policy::inner_join);
+    const auto  &keys = by_col.get_column<int>("key");
+    const auto  &lhs_idx = by_col.get_column<unsigned long>("lhs.INDEX");
+    const auto  &rhs_idx = by_col.get_column<unsigned long>("rhs.INDEX");
+    const auto  &vals = by_col.get_column<double>("val");
+
+    // The first lhs row of a key goes with all its rhs rows. The rest go
+    // with the last rhs row.
+    //
+    assert((keys == StlVecType<int> { 3, 3, 3, 3, 3, 9, 9, 9, 9 }));
+    assert((lhs_idx ==
+            StlVecType<unsigned long> { 1, 1, 5, 13, 21, 3, 8, 17, 23 }));
+    assert((rhs_idx ==
+            StlVecType<unsigned long> { 100, 102, 102, 102, 102,
+                                        101, 101, 101, 101 }));
+    assert((vals ==
+            StlVecType<double> { 30.0, 31.0, 31.0, 31.0, 31.0,
+                                 90.0, 90.0, 90.0, 90.0 }));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_join_asof()  {
+
+    std::cout << "\nTesting join_asof( ) ..." << std::endl;
+
+    MyDataFrame trades;
+    MyDataFrame quotes;
+
+    trades.load_data(StlVecType<unsigned long> { 3, 5, 10, 10, 17, 30 },
+                     std::make_pair("price",
+                                    StlVecType<double> { 100.1, 100.2, 100.4,
+                                                         100.3, 100.0, 99.9 }),
+                     std::make_pair("symbol",
+                                    StlVecType<std::string> {
+                                        "IBM", "AAPL", "IBM", "AAPL", "AAPL",
+                                        "MSFT" }));
+    quotes.load_data(StlVecType<unsigned long> { 1, 4, 5, 9, 12, 20 },
+                     std::make_pair("bid",
+                                    StlVecType<double> { 99.0, 99.1, 99.2,
+                                                         99.3, 99.4, 99.5 }),
+                     std::make_pair("symbol",
+                                    StlVecType<std::string> {
+                                        "AAPL", "IBM", "IBM", "AAPL", "IBM",
+                                        "AAPL" }));
+
+    const auto  back =
+        trades.join_asof<MyDataFrame, double, std::string>(quotes);
+    const auto  &back_bid = back.get_column<double>("bid");
+
+    assert(back.get_index() == trades.get_index());
+    assert(back.get_column<double>("price") ==
+           trades.get_column<double>("price"));
+    assert((back_bid == StlVecType<double> { 99.0, 99.2, 99.3, 99.3,
+                                             99.4, 99.5 }));
+    assert(back.get_column<std::string>("lhs.symbol")[5] == "MSFT");
+    assert(back.get_column<std::string>("rhs.symbol")[5] == "AAPL");
+
+    const auto  forw =
+        trades.join_asof<MyDataFrame, double, std::string>
+            (quotes, asof_policy::forward);
+    const auto  &forw_bid = forw.get_column<double>("bid");
+
+    assert(forw_bid.size() == 6);
+    assert(forw_bid[0] == 99.1);
+    assert(forw_bid[1] == 99.2);
+    assert(forw_bid[2] == 99.4);
+    assert(forw_bid[4] == 99.5);
+    assert(std::isnan(forw_bid[5]));
+
+    const auto  near =
+        trades.join_asof<MyDataFrame, double, std::string>
+            (quotes, asof_policy::nearest, 2.0);
+    const auto  &near_bid = near.get_column<double>("bid");
+
+    assert(near_bid[0] == 99.1);  // 4 is closer than 1
+    assert(near_bid[2] == 99.3);  // 9 is closer than 12
+    assert(near_bid[3] == 99.3);
+    assert(std::isnan(near_bid[4]));  // 17 is 3 away from 20 and 5 from 12
+    assert(std::isnan(near_bid[5]));
+
+    // Per symbol
+    //
+    const auto  by_sym =
+        trades.join_asof<MyDataFrame, std::string, double, std::string>
+            (quotes, "symbol");
+    const auto  &by_bid = by_sym.get_column<double>("bid");
+
+    assert(by_bid.size() == 6);
+    assert(std::isnan(by_bid[0]));  // No IBM quotes before 3
+    assert(by_bid[1] == 99.0);  // AAPL at 1
+    assert(by_bid[2] == 99.2);  // IBM at 5
+    assert(by_bid[3] == 99.3);  // AAPL at 9
+    assert(by_bid[4] == 99.3);  // AAPL at 9
+    assert(std::isnan(by_bid[5]));  // No MSFT quotes
+
+    const auto  by_sym_tol =
+        trades.join_asof<MyDataFrame, std::string, double, std::string>
+            (quotes, "symbol", asof_policy::backward, 4.0);
+    const auto  &by_tol_bid = by_sym_tol.get_column<double>("bid");
+
+    assert(std::isnan(by_tol_bid[0]));
+    assert(by_tol_bid[1] == 99.0);  // 4 away
+    assert(std::isnan(by_tol_bid[2]));  // 5 away
+    assert(by_tol_bid[3] == 99.3);
+    assert(std::isnan(by_tol_bid[4]));  // 8 away
+
+    bool    thrown = false;
+
+    try  {
+        quotes.get_index()[0] = 100;
+        (void) trades.join_asof<MyDataFrame, double, std::string>(quotes);
+    }
+    catch (const NotFeasible &)  { thrown = true; }
+    assert(thrown);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_get_data_by_pred()  {
+
+    std::cout << "\nTesting get_data_by_pred( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 1000;
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+    StlVecType<int>             int_vec(item_cnt - 70);  // Shorter column
+    StlVecType<std::string>     str_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl_vec[i] = double((i * 37) % 101) * 0.5;
+        str_vec[i] = (i % 4) ? "AA" : "BB";
+        if (i < int_vec.size())  int_vec[i] = int(i % 13);
+    }
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl_col", dbl_vec),
+                 std::make_pair("str_col", str_vec));
+    df.load_column("int_col", std::move(int_vec),
+                   nan_policy::dont_pad_with_nans);
+
+    auto    sel1 =
+        [](const unsigned long &, const double &val) -> bool  {
+            return (val > 8.0);
+        };
+    auto    sel2 =
+        [](const unsigned long &, const double &dval, const int &ival)
+            -> bool  {
+            return (dval <= 30.0 && ival != 5);
+        };
+
+    const auto  res1 =
+        df.get_data_by_pred<double, int, std::string>(
+            ColumnPred<double> { "dbl_col", compare_op::gt, 8.0 });
+    const auto  exp1 =
+        df.get_data_by_sel<double, decltype(sel1), double, int, std::string>
+            ("dbl_col", sel1);
+
+    assert(res1.get_index() == exp1.get_index());
+    assert(res1.get_column<double>("dbl_col") ==
+           exp1.get_column<double>("dbl_col"));
+    assert(res1.get_column<std::string>("str_col") ==
+           exp1.get_column<std::string>("str_col"));
+
+    // Two columns. Rows past the end of int_col are not selected.
+    //
+    const auto  res2 =
+        df.get_data_by_pred<double, int, std::string>(
+            ColumnPred<double> { "dbl_col", compare_op::le, 30.0 },
+            ColumnPred<int> { "int_col", compare_op::ne, 5 });
+    const auto  exp2 =
+        df.get_data_by_sel<double, int, decltype(sel2), double, int,
+                           std::string>
+            ("dbl_col", "int_col", sel2);
+    std::size_t past_end = 0;
+
+    for (const auto i : exp2.get_index())
+        if (i >= item_cnt - 70)  past_end += 1;
+    assert(past_end > 0);
+    assert(res2.get_index().size() + past_end == exp2.get_index().size());
+    assert(std::ranges::equal(res2.get_index(),
+                              exp2.get_index() |
+                                  std::views::take(res2.get_index().size())));
+    assert(res2.get_index().back() < item_cnt - 70);
+
+    const auto  view =
+        df.get_view_by_pred<double, int, std::string>(
+            ColumnPred<std::string> { "str_col", compare_op::eq, "BB" },
+            ColumnPred<unsigned long> { DF_INDEX_COL_NAME, compare_op::lt,
+                                        200 });
+
+    assert(view.get_index().size() == 50);
+    assert(view.get_index()[1] == 4);
+    assert(view.get_column<std::string>("str_col")[49] == "BB");
+
+    const std::size_t   before = df.get_index().size();
+
+    df.remove_data_by_pred<double, int, std::string>(
+        ColumnPred<double> { "dbl_col", compare_op::gt, 8.0 });
+    assert(df.get_index().size() == before - res1.get_index().size());
+    for (const auto val : df.get_column<double>("dbl_col"))
+        assert(val <= 8.0);
+}
+
+// -----------------------------------------------------------------------------
+
+struct  SelSchema  {
+
+    DECL_COL(dbl_col, double);
+    DECL_COL(int_col, int);
+};
+
+static void test_get_data_by_sel_parallel()  {
+
+    std::cout << "\nTesting get_data_by_sel( ) in parallel ..." << std::endl;
+
+    using TG = ThreadGranularity;
+
+    constexpr std::size_t   item_cnt = 20000;
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+    StlVecType<int>             int_vec(item_cnt - 500);  // Shorter column
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl_vec[i] = double((i * 37) % 101);
+        if (i < int_vec.size())  int_vec[i] = int(i % 13);
+    }
+    df.load_data(std::move(idx), std::make_pair("dbl_col", dbl_vec));
+    df.load_column("int_col", std::move(int_vec),
+                   nan_policy::dont_pad_with_nans);
+
+    auto    sel1 =
+        [](const unsigned long &, const double &val) -> bool  {
+            return (val > 50.0);
+        };
+    auto    sel2 =
+        [](const unsigned long &, const double &dval, const int &ival)
+            -> bool  {
+            return (dval < 70.0 && ival != 5);
+        };
+
+    // The default serial scan is the reference
+    //
+    const auto  exp1 =
+        df.get_data_by_sel<double, decltype(sel1), double, int>
+            ("dbl_col", sel1);
+    const auto  exp2 =
+        df.get_data_by_sel<double, int, decltype(sel2), double, int>
+            ("dbl_col", "int_col", sel2);
+
+    const TG::ThreadCost    saved = TG::get_thread_cost();
+    const long              thr_level = TG::get_thread_level();
+
+    MyDataFrame::set_thread_level(4);
+    TG::set_thread_cost({ 0.1, 10.0, 1.0 });
+
+    // Without parallel, a functor with shared state is safe to use
+    //
+    std::size_t last_row { 0 };
+    std::size_t cnt { 0 };
+    bool        in_order { true };
+    auto        counting_sel =
+        [&last_row, &cnt, &in_order]
+        (const unsigned long &idx, const double &val) -> bool  {
+            if (cnt++ > 0 && idx != last_row + 1)  in_order = false;
+            last_row = idx;
+            return (val > 50.0);
+        };
+    const auto  res0 =
+        df.get_data_by_sel<double, decltype(counting_sel), double, int>
+            ("dbl_col", counting_sel);
+
+    assert(cnt == item_cnt);
+    assert(in_order);
+    assert(res0.get_index() == exp1.get_index());
+
+    const auto  res1 =
+        df.get_data_by_sel<double, decltype(sel1), double, int>
+            ("dbl_col", sel1, true);
+    const auto  res2 =
+        df.get_view_by_sel<double, int, decltype(sel2), double, int>
+            ("dbl_col", "int_col", sel2, true);
+
+    assert(res1.get_index().size() > 1000);
+    assert(res1.get_index() == exp1.get_index());
+    assert(res1.get_column<double>("dbl_col") ==
+           exp1.get_column<double>("dbl_col"));
+    assert(res2.get_index().size() == exp2.get_index().size());
+    for (std::size_t i = 0; i < res2.get_index().size(); ++i)
+        assert(res2.get_index()[i] == exp2.get_index()[i]);
+    assert(res2.get_index().back() >= item_cnt - 500);  // Past int_col end
+
+    // The schema and column tuple based overloads
+    //
+    using sel_types = projection_type_list<double, int>;
+
+    const auto  res3 =
+        df.get_data_by_sel<sel_types, decltype(sel1), SelSchema::dbl_col>
+            (sel1, true);
+    const auto  res4 =
+        df.get_data_by_sel<sel_types, decltype(sel2)>
+            (sel2, true, SelSchema::dbl_col(), SelSchema::int_col());
+
+    assert(res3.get_index() == exp1.get_index());
+    assert(res3.get_column<double>("dbl_col") ==
+           exp1.get_column<double>("dbl_col"));
+    assert(res4.get_index() == exp2.get_index());
+    assert(res4.get_column<int>("int_col") ==
+           exp2.get_column<int>("int_col"));
+
+    df.remove_data_by_sel<double, decltype(sel1), double, int>
+        ("dbl_col", sel1, true);
+    assert(df.get_index().size() ==
+           item_cnt - exp1.get_index().size());
+    for (const auto val : df.get_column<double>("dbl_col"))
+        assert(val <= 50.0);
+
+    TG::set_thread_cost(saved);
+    MyDataFrame::set_thread_level(thr_level);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_is_index_sorted()  {
+
+    std::cout << "\nTesting is_index_sorted( ) ..." << std::endl;
+
+    MyDataFrame df;
+
+    df.load_data(
+        StlVecType<unsigned long> { 1, 2, 2, 4, 7, 8, 9, 13, 14, 20 },
+        std::make_pair(
+            "dbl_col",
+            StlVecType<double> { 1, 2, 2, 4, 7, 8, 9, 13, 14, 20 }));
+    assert(df.is_index_sorted());
+
+    // Sorted index: binary search
+    //
+    const auto  sel =
+        df.get_data_by_idx<double>(Index2D<unsigned long> { 2, 8 });
+
+    assert((sel.get_index() == StlVecType<unsigned long> { 2, 2, 4, 7, 8 }));
+    assert(sel.is_index_sorted());
+
+    // by_distance buckets from the cached bucket starts. The trailing open
+    // bucket is dropped.
+    //
+    const auto  bkt =
+        df.bucketize(bucket_type::by_distance, 5,
+                     LastVisitor<unsigned long, unsigned long>(),
+                     std::make_tuple("dbl_col", "sum", SumVisitor<double>()));
+
+    assert((bkt.get_index() == StlVecType<unsigned long> { 4, 9, 14 }));
+    assert((bkt.get_column<double>("sum") ==
+            StlVecType<double> { 9, 24, 27 }));
+
+    // Groupby on a sorted index skips the sort
+    //
+    const auto  gb =
+        df.groupby1<unsigned long>(DF_INDEX_COL_NAME,
+                                   LastVisitor<unsigned long, unsigned long>(),
+                                   std::make_tuple("dbl_col", "sum",
+                                                   SumVisitor<double>()));
+
+    assert(gb.get_index().size() == 9);
+    assert(gb.get_index()[1] == 2);
+    assert(gb.get_column<double>("sum")[1] == 4.0);
+    assert(gb.get_column<double>("sum")[8] == 20.0);
+
+    unsigned long   idx_val = 25;
+
+    df.append_row(&idx_val, std::make_pair("dbl_col", 25.0));
+    assert(df.is_index_sorted());
+
+    MyDataFrame df2 = df;
+
+    idx_val = 3;
+    df.append_row(&idx_val, std::make_pair("dbl_col", 3.0));
+    assert(! df.is_index_sorted());
+    assert(df2.is_index_sorted());
+    df.swap(df2);
+    assert(df.is_index_sorted() && ! df2.is_index_sorted());
+
+    // Unsorted index: a scan in row order
+    //
+    MyDataFrame df3;
+
+    df3.load_data(StlVecType<unsigned long> { 5, 1, 9, 3, 7, 3 },
+                  std::make_pair("dbl_col",
+                                 StlVecType<double> { 6, 5, 4, 3, 2, 1 }));
+    assert(! df3.is_index_sorted());
+
+    const auto  sel2 =
+        df3.get_data_by_idx<double>(Index2D<unsigned long> { 3, 7 });
+
+    assert((sel2.get_index() == StlVecType<unsigned long> { 5, 3, 7, 3 }));
+    assert((sel2.get_column<double>("dbl_col") ==
+            StlVecType<double> { 6, 3, 2, 1 }));
+
+    bool    thrown = false;
+
+    try  {
+        auto    view =
+            df3.get_view_by_idx<double>(Index2D<unsigned long> { 3, 7 });
+    }
+    catch (const NotFeasible &)  { thrown = true; }
+    assert(thrown);
+
+    df3.remove_data_by_idx<double>({ 3, 5 });
+    assert((df3.get_index() == StlVecType<unsigned long> { 1, 9, 7 }));
+    assert((df3.get_column<double>("dbl_col") ==
+            StlVecType<double> { 5, 4, 2 }));
+    assert(! df3.is_index_sorted());
+
+    df3.sort<unsigned long, double>(DF_INDEX_COL_NAME, sort_spec::ascen);
+    assert(df3.is_index_sorted());
+    df3.sort<double, double>("dbl_col", sort_spec::ascen);
+    assert((df3.get_index() == StlVecType<unsigned long> { 7, 9, 1 }));
+    assert(! df3.is_index_sorted());
+
+    // Erasing rows keeps a sorted index sorted
+    //
+    df3.sort<unsigned long, double>(DF_INDEX_COL_NAME, sort_spec::ascen);
+    df3.remove_data_by_loc<double>({ 0, 1 });
+    assert(df3.is_index_sorted());
+
+    // The non-const get_index() drops the cached state
+    //
+    df3.get_index()[0] = 100;
+    assert(! df3.is_index_sorted());
+}
+
+// -----------------------------------------------------------------------------
+
+// It hides the rolling protocol of V, so SimpleRollAdopter reruns it over
+// every window
+//
+template<typename V>
+struct  NoRollUpdates  {
+
+    using value_type = typename V::value_type;
+    using index_type = typename V::index_type;
+    using size_type = typename V::size_type;
+    using result_type = typename V::result_type;
+
+    template<typename K, typename H>
+    inline void
+    operator() (const K &idx_begin, const K &idx_end,
+                const H &column_begin, const H &column_end)  {
+
+        visitor(idx_begin, idx_end, column_begin, column_end);
+    }
+    inline void pre ()  { visitor.pre(); }
+    inline void post ()  { visitor.post(); }
+    inline result_type get_result () const  { return (visitor.get_result()); }
+
+    V   visitor;
+};
+
+template<typename V>
+static void test_roll_against_rerun_(const MyDataFrame &df,
+                                     const V &visitor,
+                                     std::size_t roll_count,
+                                     double tolerance)  {
+
+    static_assert(rolling_updatable<V>);
+    static_assert(! rolling_updatable<NoRollUpdates<V>>);
+
+    SimpleRollAdopter<V, double>                    inc_roller(
+        V(visitor), roll_count);
+    SimpleRollAdopter<NoRollUpdates<V>, double>     rerun_roller(
+        NoRollUpdates<V> { visitor }, roll_count);
+
+    const auto  &inc =
+        df.single_act_visit<double>("dbl_col", inc_roller).get_result();
+    const auto  &rerun =
+        df.single_act_visit<double>("dbl_col", rerun_roller).get_result();
+
+    assert(inc.size() == rerun.size());
+    for (std::size_t i = 0; i < inc.size(); ++i)  {
+        if (std::isnan(rerun[i]))
+            assert(std::isnan(inc[i]));
+        else if (std::isinf(rerun[i]))
+            assert(inc[i] == rerun[i]);
+        else
+            assert(std::fabs(inc[i] - rerun[i]) <= tolerance);
+    }
+}
+
+static void test_rolling_updates()  {
+
+    std::cout << "\nTesting rolling add( )/remove( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 2000;
+    constexpr double        nan = std::numeric_limits<double>::quiet_NaN();
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl_vec[i] = double((i * 7919) % 1013) / 10.0 - 50.0;
+        if (i % 97 == 5 || (i >= 1500 && i < 1520))  dbl_vec[i] = nan;
+    }
+    df.load_data(std::move(idx), std::make_pair("dbl_col", dbl_vec));
+
+    for (const std::size_t roll_count : { 1, 2, 7, 30, 250 })  {
+        for (const bool skip_nan : { false, true })  {
+            test_roll_against_rerun_(df, SumVisitor<double>(skip_nan),
+                                     roll_count, 1e-8);
+            test_roll_against_rerun_(df, MeanVisitor<double>(skip_nan),
+                                     roll_count, 1e-10);
+            test_roll_against_rerun_(df, VarVisitor<double>(false, skip_nan),
+                                     roll_count, 1e-7);
+            test_roll_against_rerun_(df, StdVisitor<double>(true, skip_nan),
+                                     roll_count, 1e-8);
+            test_roll_against_rerun_(df, MaxVisitor<double>(skip_nan),
+                                     roll_count, 0);
+            test_roll_against_rerun_(df, MinVisitor<double>(skip_nan),
+                                     roll_count, 0);
+        }
+    }
+
+    // A large value leaving the window must not take the small ones with it
+    //
+    MyDataFrame wide_df;
+
+    wide_df.load_data(
+        StlVecType<unsigned long> { 1, 2, 3, 4, 5, 6, 7, 8 },
+        std::make_pair("dbl_col",
+                       StlVecType<double> { 1e20, 1, 1, -3e18, 2, 1e-3, 4,
+                                            -1e16 }));
+
+    SimpleRollAdopter<SumVisitor<double>, double>   sum_roller(
+        SumVisitor<double>(), 2);
+    SimpleRollAdopter<MeanVisitor<double>, double>  mean_roller(
+        MeanVisitor<double>(), 2);
+    SimpleRollAdopter<VarVisitor<double>, double>   var_roller(
+        VarVisitor<double>(), 2);
+
+    wide_df.single_act_visit<double>("dbl_col", sum_roller);
+    wide_df.single_act_visit<double>("dbl_col", mean_roller);
+    wide_df.single_act_visit<double>("dbl_col", var_roller);
+    assert(sum_roller.get_result()[2] == 2.0);
+    assert(mean_roller.get_result()[2] == 1.0);
+    assert(var_roller.get_result()[2] == 0.0);
+    assert(sum_roller.get_result()[5] == 2.001);
+    assert(std::fabs(var_roller.get_result()[5] - 1.9980005) < 1e-12);
+
+    for (const std::size_t roll_count : { 2, 3, 5 })  {
+        test_roll_against_rerun_(wide_df, SumVisitor<double>(),
+                                 roll_count, 1e-12);
+        test_roll_against_rerun_(wide_df, MeanVisitor<double>(),
+                                 roll_count, 1e-12);
+    }
+
+    // Once an infinity leaves the window, the results must recover
+    //
+    constexpr double    inf = std::numeric_limits<double>::infinity();
+    MyDataFrame         inf_df;
+
+    inf_df.load_data(
+        StlVecType<unsigned long> { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 },
+        std::make_pair("dbl_col",
+                       StlVecType<double> { 1, inf, 2, 3, 4, 5, -inf, inf, 6,
+                                            1e308, 1e308, 7 }));
+
+    SimpleRollAdopter<SumVisitor<double>, double>   inf_sum_roller(
+        SumVisitor<double>(), 2);
+    SimpleRollAdopter<MeanVisitor<double>, double>  inf_mean_roller(
+        MeanVisitor<double>(), 2);
+    SimpleRollAdopter<StdVisitor<double>, double>   inf_std_roller(
+        StdVisitor<double>(), 2);
+
+    inf_df.single_act_visit<double>("dbl_col", inf_sum_roller);
+    inf_df.single_act_visit<double>("dbl_col", inf_mean_roller);
+    inf_df.single_act_visit<double>("dbl_col", inf_std_roller);
+
+    const auto  &inf_sum = inf_sum_roller.get_result();
+    const auto  &inf_mean = inf_mean_roller.get_result();
+    const auto  &inf_std = inf_std_roller.get_result();
+
+    assert(std::isnan(inf_sum[0]));
+    assert(inf_sum[1] == inf && inf_sum[2] == inf);
+    assert(inf_sum[3] == 5.0 && inf_sum[4] == 7.0 && inf_sum[5] == 9.0);
+    assert(inf_sum[6] == -inf);
+    assert(std::isnan(inf_sum[7]));   // -inf + inf
+    assert(inf_sum[8] == inf && inf_sum[9] == 1e308 + 6.0);
+    assert(inf_sum[10] == inf);       // Overflow
+    assert(inf_sum[11] == 1e308 + 7.0);
+    assert(inf_mean[2] == inf && inf_mean[3] == 2.5 && inf_mean[5] == 4.5);
+    assert(inf_mean[11] == (1e308 + 7.0) / 2.0);
+    assert(std::isnan(inf_std[1]) && std::isnan(inf_std[2]));
+    assert(std::fabs(inf_std[3] - std::sqrt(0.5)) < 1e-12);
+    assert(std::fabs(inf_std[5] - std::sqrt(0.5)) < 1e-12);
+    assert(std::isnan(inf_std[7]));
+
+    for (const std::size_t roll_count : { 1, 2, 3, 5 })  {
+        test_roll_against_rerun_(inf_df, SumVisitor<double>(),
+                                 roll_count, 1e-12);
+        test_roll_against_rerun_(inf_df, MeanVisitor<double>(),
+                                 roll_count, 1e-12);
+    }
+
+    // Integer variances are rerun per window. So they must match visit()
+    //
+    static_assert(! rolling_updatable<VarVisitor<int>>);
+    static_assert(! rolling_updatable<StdVisitor<unsigned int>>);
+
+    MyDataFrame int_df;
+
+    int_df.load_data(
+        StlVecType<unsigned long> { 1, 2, 3, 4, 5, 6, 7, 8 },
+        std::make_pair("int_col",
+                       StlVecType<int> { 7, -3, 12, 5, -20, 9, 1, 30 }),
+        std::make_pair("uint_col",
+                       StlVecType<unsigned int> { 9, 2, 14, 3, 8, 1, 20, 6 }));
+
+    SimpleRollAdopter<VarVisitor<int>, int>                     int_roller(
+        VarVisitor<int>(), 3);
+    SimpleRollAdopter<VarVisitor<unsigned int>, unsigned int>   uint_roller(
+        VarVisitor<unsigned int>(), 3);
+
+    const auto  &int_var =
+        int_df.single_act_visit<int>("int_col", int_roller).get_result();
+    const auto  &uint_var =
+        int_df.single_act_visit<unsigned int>("uint_col",
+                                              uint_roller).get_result();
+    const auto  &int_col = int_df.get_column<int>("int_col");
+    const auto  &uint_col = int_df.get_column<unsigned int>("uint_col");
+    const auto  &int_idx = int_df.get_index();
+
+    assert(int_var.size() == int_col.size());
+    assert(uint_var.size() == uint_col.size());
+    for (std::size_t i = 2; i < int_col.size(); ++i)  {
+        VarVisitor<int>             int_visitor;
+        VarVisitor<unsigned int>    uint_visitor;
+
+        int_visitor.pre();
+        int_visitor(int_idx.begin() + (i - 2), int_idx.begin() + (i + 1),
+                    int_col.begin() + (i - 2), int_col.begin() + (i + 1));
+        int_visitor.post();
+        uint_visitor.pre();
+        uint_visitor(int_idx.begin() + (i - 2), int_idx.begin() + (i + 1),
+                     uint_col.begin() + (i - 2), uint_col.begin() + (i + 1));
+        uint_visitor.post();
+        assert(int_var[i] == int_visitor.get_result());
+        assert(uint_var[i] == uint_visitor.get_result());
+    }
+    assert(int_var[2] == 58);   // 7, -3, 12
+    assert(uint_var[3] == 44);  // 2, 14, 3
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_rolling_order_stats()  {
+
+    std::cout << "\nTesting Rolling{Median,Quantile,MAD,PercentRank}Visitor "
+                 "..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 1500;
+    constexpr double        nan = std::numeric_limits<double>::quiet_NaN();
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+    StlVecType<double>          nan_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl_vec[i] = double((i * 7919) % 1013) / 10.0 - 50.0;
+        if (i % 13 == 0 && i > 0)  dbl_vec[i] = dbl_vec[i - 1];  // Repeats
+        nan_vec[i] = dbl_vec[i];
+        if (i % 97 == 5 || (i >= 700 && i < 720))  nan_vec[i] = nan;
+    }
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl_col", dbl_vec),
+                 std::make_pair("nan_col", nan_vec));
+
+    // Rolling order statistics must match rerunning the column visitors
+    // over every window.
+    // 1100 goes over flat_roll_count, so the skip list is used
+    //
+    for (const std::size_t roll_count : { 1, 2, 5, 20, 31, 1100 })  {
+        const auto  match =
+            [&df, roll_count](auto &&roll_v, auto &&col_v, double tol)  {
+                using col_v_t = std::decay_t<decltype(col_v)>;
+
+                SimpleRollAdopter<col_v_t, double>  rerun_v(
+                    std::move(col_v), roll_count);
+                const auto                          &result =
+                    df.single_act_visit<double>("dbl_col",
+                                                roll_v).get_result();
+                const auto                          &rerun =
+                    df.single_act_visit<double>("dbl_col",
+                                                rerun_v).get_result();
+
+                assert(result.size() == item_cnt);
+                for (std::size_t i = 0; i < item_cnt; ++i)  {
+                    if (i + 1 < roll_count)
+                        assert(std::isnan(result[i]));
+                    else
+                        assert(std::fabs(result[i] - rerun[i]) <= tol);
+                }
+            };
+
+        match(RollingMedianVisitor<double>(roll_count),
+              MedianVisitor<double>(), 0);
+        for (const auto policy : { quantile_policy::lower_value,
+                                   quantile_policy::higher_value,
+                                   quantile_policy::mid_point,
+                                   quantile_policy::linear })  {
+            for (const double qt : { 0.0, 0.25, 0.77, 1.0 })  {
+                // QuantileVisitor can't select the 0th item
+                //
+                if (qt > 0 && qt < 1 && std::round(qt * roll_count) < 1)
+                    continue;
+                match(RollingQuantileVisitor<double>(roll_count, qt, policy),
+                      QuantileVisitor<double>(qt, policy), 0);
+            }
+        }
+        for (const auto mt : { mad_type::mean_abs_dev_around_mean,
+                               mad_type::mean_abs_dev_around_median,
+                               mad_type::median_abs_dev_around_mean,
+                               mad_type::median_abs_dev_around_median })
+            match(RollingMADVisitor<double>(roll_count, mt),
+                  MADVisitor<double>(mt), 1e-8);
+    }
+
+    // Nan handling and percentile ranks against brute force
+    //
+    for (const std::size_t roll_count : { 1, 4, 20 })  {
+        for (const bool skip_nan : { false, true })  {
+            RollingMedianVisitor<double>        med_v(roll_count, skip_nan);
+            RollingPercentRankVisitor<double>   rank_v(roll_count,
+                                                       rank_policy::average,
+                                                       skip_nan);
+            const auto                          &meds =
+                df.single_act_visit<double>("nan_col", med_v).get_result();
+            const auto                          &ranks =
+                df.single_act_visit<double>("nan_col", rank_v).get_result();
+
+            for (std::size_t i = roll_count - 1; i < item_cnt; ++i)  {
+                StlVecType<double>  window;
+                bool                has_nan = false;
+
+                for (std::size_t j = i + 1 - roll_count; j <= i; ++j)  {
+                    if (std::isnan(nan_vec[j]))  has_nan = true;
+                    else  window.push_back(nan_vec[j]);
+                }
+                if ((has_nan && ! skip_nan) || window.empty())  {
+                    assert(std::isnan(meds[i]));
+                    assert(std::isnan(ranks[i]));
+                    continue;
+                }
+                std::sort(window.begin(), window.end());
+
+                const std::size_t   half = window.size() >> 1;
+
+                assert(meds[i] == ((window.size() & 0x01)
+                                       ? window[half]
+                                       : (window[half - 1] + window[half]) /
+                                         2.0));
+                if (std::isnan(nan_vec[i]))  {
+                    assert(std::isnan(ranks[i]));
+                    continue;
+                }
+
+                const auto  lower = std::lower_bound(window.begin(),
+                                                     window.end(),
+                                                     nan_vec[i]);
+                const auto  upper = std::upper_bound(window.begin(),
+                                                     window.end(),
+                                                     nan_vec[i]);
+                const double    rank =
+                    double(lower - window.begin()) +
+                    double(upper - lower - 1) / 2.0;
+
+                assert(std::fabs(ranks[i] -
+                                 (rank + 1.0) / double(window.size())) <
+                       1e-12);
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_fused_visit()  {
+
+    std::cout << "\nTesting FusedVisitor{ } and grouped multi_visit( ) ..."
+              << std::endl;
+
+    constexpr std::size_t   item_cnt = 5000;
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+    StlVecType<double>          short_vec(item_cnt - 100);
+    StlVecType<int>             int_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl_vec[i] = std::sin(double(i) * 0.1) * 100.0;
+        int_vec[i] = int(i % 17);
+        if (i < short_vec.size())  short_vec[i] = double(i) * 0.5;
+    }
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl_col", dbl_vec),
+                 std::make_pair("short_col", short_vec),
+                 std::make_pair("int_col", int_vec));
+
+    // Visitors on the same column are run in one pass. The results must
+    // be the same as visiting one by one
+    //
+    MeanVisitor<double>     mean_v1;
+    MaxVisitor<double>      max_v1;
+    StatsVisitor<double>    stats_v1;
+    SumVisitor<int>         sum_v1;
+    MeanVisitor<double>     short_mean_v1(true);
+
+    df.multi_visit(std::make_pair("dbl_col", &mean_v1),
+                   std::make_pair("int_col", &sum_v1),
+                   std::make_pair("dbl_col", &max_v1),
+                   std::make_pair("short_col", &short_mean_v1),
+                   std::make_pair("dbl_col", &stats_v1));
+
+    MeanVisitor<double>     mean_v2;
+    MaxVisitor<double>      max_v2;
+    StatsVisitor<double>    stats_v2;
+    SumVisitor<int>         sum_v2;
+    MeanVisitor<double>     short_mean_v2(true);
+
+    df.visit<double>("dbl_col", mean_v2);
+    df.visit<double>("dbl_col", max_v2);
+    df.visit<double>("dbl_col", stats_v2);
+    df.visit<int>("int_col", sum_v2);
+    df.visit<double>("short_col", short_mean_v2);
+    assert(mean_v1.get_result() == mean_v2.get_result());
+    assert(max_v1.get_result() == max_v2.get_result());
+    assert(max_v1.get_index() == max_v2.get_index());
+    assert(stats_v1.get_skew() == stats_v2.get_skew());
+    assert(sum_v1.get_result() == sum_v2.get_result());
+    assert(short_mean_v1.get_result() == short_mean_v2.get_result());
+    assert(short_mean_v1.get_count() == item_cnt - 100);
+
+    // A visitor given more than once ends up as if only its last pair ran
+    //
+    MeanVisitor<double>     dup_mean_v;
+    SumVisitor<int>         dup_sum_v;
+
+    df.multi_visit(std::make_pair("dbl_col", &dup_mean_v),
+                   std::make_pair("int_col", &dup_sum_v),
+                   std::make_pair("dbl_col", &dup_mean_v),
+                   std::make_pair("int_col", &dup_sum_v));
+    assert(dup_mean_v.get_result() == mean_v2.get_result());
+    assert(dup_mean_v.get_count() == item_cnt);
+    assert(dup_sum_v.get_result() == sum_v2.get_result());
+    df.multi_visit(std::make_pair("dbl_col", &dup_mean_v),
+                   std::make_pair("short_col", &dup_mean_v),
+                   std::make_pair("dbl_col", &max_v1));
+    assert(dup_mean_v.get_count() == item_cnt);  // Not skipping nans
+    assert(std::isnan(dup_mean_v.get_result()));
+    assert(max_v1.get_result() == max_v2.get_result());
+
+    // One-by-one visitors are fed block by block and MedianVisitor is
+    // passed the whole column
+    //
+    MeanVisitor<double>     fmean_v;
+    VarVisitor<double>      fvar_v;
+    MedianVisitor<double>   fmedian_v;
+    StatsVisitor<double>    fstats_v;
+    FusedVisitor            fused_v(fmean_v, fvar_v, fmedian_v, fstats_v);
+
+    df.single_act_visit<double>("dbl_col", fused_v);
+    assert(&(fused_v.get_visitor<2>()) == &fmedian_v);
+
+    MeanVisitor<double>     mean_v;
+    VarVisitor<double>      var_v;
+    MedianVisitor<double>   median_v;
+    StatsVisitor<double>    stats_v;
+
+    df.single_act_visit<double>("dbl_col", mean_v);
+    df.single_act_visit<double>("dbl_col", var_v);
+    df.single_act_visit<double>("dbl_col", median_v);
+    df.single_act_visit<double>("dbl_col", stats_v);
+    assert(std::fabs(fmean_v.get_result() - mean_v.get_result()) < 1e-10);
+    assert(std::fabs(fvar_v.get_result() - var_v.get_result()) < 1e-6);
+    assert(fmedian_v.get_result() == median_v.get_result());
+    assert(fstats_v.get_kurtosis() == stats_v.get_kurtosis());
+
+    // It also works through the one-by-one visit()
+    //
+    df.visit<double>("dbl_col", fused_v);
+    assert(std::fabs(fmean_v.get_result() - mean_v.get_result()) < 1e-10);
+    assert(fmedian_v.get_result() == median_v.get_result());
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_parallel_visit()  {
+
+    std::cout << "\nTesting parallel_visit( ) ..." << std::endl;
+
+    using TG = ThreadGranularity;
+
+    constexpr std::size_t   item_cnt = 100003;
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl_vec(item_cnt);
+    StlVecType<double>          dbl_vec2(item_cnt - 1000);  // Shorter column
+    StlVecType<long>            lng_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl_vec[i] = std::sin(double(i) * 0.01) * 1000.0 + 1000.0;
+        lng_vec[i] = long(i % 29) - 14;
+        if (i < dbl_vec2.size())  dbl_vec2[i] = double(i % 101) * 0.25;
+    }
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl_col", dbl_vec),
+                 std::make_pair("lng_col", lng_vec));
+    df.load_column("dbl_col_2", std::move(dbl_vec2),
+                   nan_policy::dont_pad_with_nans);
+
+    SumVisitor<double>      sum_s;
+    SumVisitor<long>        lsum_s;
+    CountVisitor<double>    cnt_s(true);
+    MeanVisitor<double>     mean_s(true);
+    MaxVisitor<double>      max_s;
+    MinVisitor<long>        min_s;
+    VarVisitor<double>      var_s;
+    StdVisitor<double>      std_s;
+    CovVisitor<double>      cov_s(false, true);
+    CorrVisitor<double>     corr_s;
+    DotProdVisitor<double>  dot_s;
+
+    df.visit<double>("dbl_col", sum_s);
+    df.visit<long>("lng_col", lsum_s);
+    df.visit<double>("dbl_col_2", cnt_s);
+    df.visit<double>("dbl_col_2", mean_s);
+    df.visit<double>("dbl_col", max_s);
+    df.visit<long>("lng_col", min_s);
+    df.visit<double>("dbl_col", var_s);
+    df.visit<double>("dbl_col", std_s);
+    df.visit<double, double>("dbl_col", "dbl_col_2", cov_s);
+    df.visit<double, double>("dbl_col", "dbl_col", corr_s);
+    df.visit<double, double>("dbl_col", "dbl_col", dot_s);
+
+    const TG::ThreadCost    saved = TG::get_thread_cost();
+    const long              thr_level = TG::get_thread_level();
+
+    MyDataFrame::set_thread_level(4);
+    TG::set_thread_cost({ 1.0, 1.0, 1.0 });  // Always worth threads
+
+    SumVisitor<double>      sum_p;
+    SumVisitor<long>        lsum_p;
+    CountVisitor<double>    cnt_p(true);
+    MeanVisitor<double>     mean_p(true);
+    MaxVisitor<double>      max_p;
+    MinVisitor<long>        min_p;
+    VarVisitor<double>      var_p;
+    StdVisitor<double>      std_p;
+    CovVisitor<double>      cov_p(false, true);
+    CorrVisitor<double>     corr_p;
+    DotProdVisitor<double>  dot_p;
+
+    df.parallel_visit<double>("dbl_col", sum_p);
+    df.parallel_visit<long>("lng_col", lsum_p);
+    df.parallel_visit<double>("dbl_col_2", cnt_p);
+    df.parallel_visit<double>("dbl_col_2", mean_p);
+    df.parallel_visit<double>("dbl_col", max_p);
+    df.parallel_visit<long>("lng_col", min_p);
+    df.parallel_visit<double>("dbl_col", var_p);
+    df.parallel_visit<double>("dbl_col", std_p);
+    df.parallel_visit<double, double>("dbl_col", "dbl_col_2", cov_p);
+    df.parallel_visit<double, double>("dbl_col", "dbl_col", corr_p);
+    df.parallel_visit<double, double>("dbl_col", "dbl_col", dot_p);
+
+    const auto  close =
+        [](double lhs, double rhs) -> bool  {
+            return (std::fabs(lhs - rhs) <=
+                    1.0e-9 * std::max(1.0, std::fabs(rhs)));
+        };
+
+    assert(close(sum_p.get_result(), sum_s.get_result()));
+    assert(lsum_p.get_result() == lsum_s.get_result());
+    assert(cnt_p.get_result() == cnt_s.get_result());
+    assert(cnt_p.get_result() == item_cnt - 1000);
+    assert(close(mean_p.get_result(), mean_s.get_result()));
+    assert(max_p.get_result() == max_s.get_result());
+    assert(max_p.get_index() == max_s.get_index());
+    assert(min_p.get_result() == min_s.get_result());
+    assert(min_p.get_index() == min_s.get_index());
+    assert(close(var_p.get_result(), var_s.get_result()));
+    assert(close(std_p.get_result(), std_s.get_result()));
+    assert(close(cov_p.get_result(), cov_s.get_result()));
+    assert(close(corr_p.get_result(), corr_s.get_result()));
+    assert(close(corr_p.get_result(), 1.0));
+    assert(close(dot_p.get_result(), dot_s.get_result()));
+    assert(close(dot_p.get_magnitude1(), dot_s.get_magnitude1()));
+
+    // A chunk with an infinity must give what visit() gives
+    //
+    constexpr double    inf = std::numeric_limits<double>::infinity();
+    StlVecType<double>  inf_vec(dbl_vec);
+    StlVecType<double>  both_inf_vec(dbl_vec);
+
+    inf_vec[item_cnt / 3] = inf;
+    both_inf_vec[10] = inf;
+    both_inf_vec[item_cnt - 10] = -inf;
+    df.load_column("inf_col", std::move(inf_vec));
+    df.load_column("both_inf_col", std::move(both_inf_vec));
+
+    SumVisitor<double>  inf_sum_s;
+    SumVisitor<double>  inf_sum_p;
+    MeanVisitor<double> inf_mean_s;
+    MeanVisitor<double> inf_mean_p;
+    SumVisitor<double>  both_inf_sum_p;
+
+    df.visit<double>("inf_col", inf_sum_s);
+    df.visit<double>("inf_col", inf_mean_s);
+    df.parallel_visit<double>("inf_col", inf_sum_p);
+    df.parallel_visit<double>("inf_col", inf_mean_p);
+    df.parallel_visit<double>("both_inf_col", both_inf_sum_p);
+    assert(inf_sum_s.get_result() == inf);
+    assert(inf_sum_p.get_result() == inf);
+    assert(inf_mean_s.get_result() == inf);
+    assert(inf_mean_p.get_result() == inf);
+    assert(std::isnan(both_inf_sum_p.get_result()));
+
+    // Near-constant data, like col_1 of test_z_score_visitor(). Its
+    // variance is far below the rounding error of raw sums of squares. So
+    // the chunks must be merged with their centered moments.
+    //
+    StlVecType<double>  near_vec(item_cnt);
+    StlVecType<double>  near_vec2(item_cnt);
+    double              near_mean { 0 };
+    double              near_mean2 { 0 };
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        near_vec[i] = 99.0001 + double(i % 97) * 1.0e-7;
+        near_vec2[i] = 99.0001 - double(i % 97 + i % 7) * 1.0e-7;
+        near_mean += near_vec[i];
+        near_mean2 += near_vec2[i];
+    }
+    near_mean /= double(item_cnt);
+    near_mean2 /= double(item_cnt);
+
+    double  near_m2 { 0 };
+    double  near_c12 { 0 };
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        near_m2 += (near_vec[i] - near_mean) * (near_vec[i] - near_mean);
+        near_c12 += (near_vec[i] - near_mean) * (near_vec2[i] - near_mean2);
+    }
+    df.load_column("near_col", std::move(near_vec));
+    df.load_column("near_col_2", std::move(near_vec2));
+
+    VarVisitor<double>  near_var_s;
+    VarVisitor<double>  near_var_p;
+    StdVisitor<double>  near_std_s;
+    StdVisitor<double>  near_std_p;
+    CovVisitor<double>  near_cov_s;
+    CovVisitor<double>  near_cov_p;
+    CorrVisitor<double> near_corr_s;
+    CorrVisitor<double> near_corr_p;
+
+    df.visit<double>("near_col", near_var_s);
+    df.visit<double>("near_col", near_std_s);
+    df.visit<double, double>("near_col", "near_col_2", near_cov_s);
+    df.visit<double, double>("near_col", "near_col_2", near_corr_s);
+    df.parallel_visit<double>("near_col", near_var_p);
+    df.parallel_visit<double>("near_col", near_std_p);
+    df.parallel_visit<double, double>("near_col", "near_col_2", near_cov_p);
+    df.parallel_visit<double, double>("near_col", "near_col_2", near_corr_p);
+
+    const auto      rel_close =
+        [](double lhs, double rhs) -> bool  {
+            return (std::fabs(lhs - rhs) <= 1.0e-8 * std::fabs(rhs));
+        };
+    const double    near_var = near_m2 / double(item_cnt - 1);
+    const double    near_cov = near_c12 / double(item_cnt - 1);
+
+    assert(rel_close(near_var_s.get_result(), near_var));
+    assert(rel_close(near_var_p.get_result(), near_var));
+    assert(rel_close(near_std_s.get_result(), std::sqrt(near_var)));
+    assert(rel_close(near_std_p.get_result(), std::sqrt(near_var)));
+    assert(rel_close(near_cov_s.get_result(), near_cov));
+    assert(rel_close(near_cov_p.get_result(), near_cov));
+    assert(rel_close(near_corr_p.get_result(), near_corr_s.get_result()));
+
+    bool    thrown = false;
+
+    try  {
+        CorrVisitor<double> spearman { correlation_type::spearman };
+
+        spearman.merge(CorrVisitor<double> { correlation_type::spearman });
+    }
+    catch (const NotFeasible &)  { thrown = true; }
+    assert(thrown);
+
+    // A spearman correlation is rejected whether threads are used or not
+    //
+    MyDataFrame small_df;
+
+    small_df.load_data(
+        StlVecType<unsigned long> { 1, 2, 3, 4, 5 },
+        std::make_pair("dbl_col", StlVecType<double> { 5, 3, 4, 1, 2 }));
+
+    for (MyDataFrame *frame : { &df, &small_df })  {
+        for (const bool use_threads : { true, false })  {
+            if (! use_threads)  {
+                TG::set_thread_cost(saved);
+                MyDataFrame::set_thread_level(0);
+            }
+
+            CorrVisitor<double> spearman { correlation_type::spearman };
+
+            thrown = false;
+            try  {
+                frame->parallel_visit<double, double>("dbl_col", "dbl_col",
+                                                      spearman);
+            }
+            catch (const NotFeasible &)  { thrown = true; }
+            assert(thrown);
+        }
+        MyDataFrame::set_thread_level(4);
+        TG::set_thread_cost({ 1.0, 1.0, 1.0 });
+    }
+
+    TG::set_thread_cost(saved);
+    MyDataFrame::set_thread_level(thr_level);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_reduce_kernels()  {
+
+    std::cout << "\nTesting reduce kernels ..." << std::endl;
+
+    // Not a multiple of the lanes and more than one extremum block
+    //
+    constexpr std::size_t   item_cnt = 10007;
+
+    StlVecType<double>  dvec(item_cnt);
+    StlVecType<double>  dvec2(item_cnt);
+    StlVecType<int>     ivec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        dvec[i] = double(int(i * 37) % 101 - 50) * 0.25;
+        dvec2[i] = double(int(i * 13) % 17) * 0.5;
+        ivec[i] = int(i * 7) % 23 - 11;
+    }
+    dvec[5] = dvec[77] = dvec[9000] = std::numeric_limits<double>::quiet_NaN();
+
+    const double    *db = dvec.data();
+    const double    *de = dvec.data() + item_cnt;
+    double          sum { 0 };
+    std::size_t     cnt { 0 };
+
+    for (const double val : dvec)
+        if (! std::isnan(val))  { sum += val; cnt += 1; }
+
+    const auto  sc = reduce_sum(db, de, true);
+
+    assert(std::fabs(sc.sum - sum) < 1e-9);
+    assert(sc.cnt == cnt);
+    assert(reduce_count(db, de) == cnt);
+    assert(std::isnan(reduce_sum(db, de, false).sum));
+    assert(reduce_sum(ivec.data(), ivec.data() + item_cnt, false).sum ==
+           std::accumulate(ivec.begin(), ivec.end(), 0));
+
+    // The first of the ties, and nans are never picked
+    //
+    const std::size_t   max_pos = reduce_extremum<true>(db, de, -1000.0);
+    const std::size_t   min_pos = reduce_extremum<false>(db, de, 1000.0);
+
+    assert(dvec[max_pos] == 12.5);
+    assert(dvec[min_pos] == -12.5);
+    for (std::size_t i = 0; i < max_pos; ++i)  assert(! (dvec[i] == 12.5));
+    for (std::size_t i = 0; i < min_pos; ++i)  assert(! (dvec[i] == -12.5));
+    assert(reduce_extremum<true>(db, de, 100.0) == item_cnt);
+    assert(reduce_extremum<true>(db, de, dvec[5]) == item_cnt);
+    assert(ivec[reduce_extremum<false>(ivec.data(), ivec.data() + item_cnt,
+                                       0)] == -11);
+
+    const auto  cs = reduce_cov(db, de, dvec2.data(), true);
+    const auto  ds = reduce_dot(dvec2.data(), dvec2.data() + item_cnt, db);
+    double      dot { 0 };
+    double      man { 0 };
+    double      mean1 { 0 };
+    double      mean2 { 0 };
+    double      co_moment { 0 };
+
+    for (std::size_t i = 0; i < item_cnt; ++i)
+        if (! std::isnan(dvec[i]))  {
+            dot += dvec[i] * dvec2[i];
+            man += std::fabs(dvec2[i] - dvec[i]);
+            mean1 += dvec[i];
+            mean2 += dvec2[i];
+        }
+    mean1 /= double(cnt);
+    mean2 /= double(cnt);
+    for (std::size_t i = 0; i < item_cnt; ++i)
+        if (! std::isnan(dvec[i]))
+            co_moment += (dvec[i] - mean1) * (dvec2[i] - mean2);
+    assert(cs.cnt == cnt);
+    assert(std::fabs(cs.mean1 - mean1) < 1e-9);
+    assert(std::fabs(cs.mean2 - mean2) < 1e-9);
+    assert(std::fabs(cs.c12 - co_moment) < 1e-6);
+    assert(std::isnan(ds.dot_prod));
+
+    dvec[5] = dvec[77] = dvec[9000] = 0;
+
+    const auto  ds2 = reduce_dot(dvec2.data(), dvec2.data() + item_cnt, db);
+
+    assert(std::fabs(ds2.dot_prod - dot) < 1e-6);
+    assert(std::fabs(ds2.man_dist - man -
+                     std::fabs(dvec2[5]) - std::fabs(dvec2[77]) -
+                     std::fabs(dvec2[9000])) < 1e-6);
+
+    // The visitors take the kernel path through single_act_visit()
+    //
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idx(item_cnt);
+
+    std::iota(idx.begin(), idx.end(), 100);
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl_col", dvec),
+                 std::make_pair("dbl_col_2", dvec2));
+
+    MaxVisitor<double>      max_v;
+    SumVisitor<double>      sum_v;
+    CorrVisitor<double>     corr_v;
+    CorrVisitor<double>     corr_v2;
+
+    df.single_act_visit<double>("dbl_col", max_v);
+    df.single_act_visit<double>("dbl_col", sum_v);
+    df.single_act_visit<double, double>("dbl_col", "dbl_col_2", corr_v);
+    df.visit<double, double>("dbl_col", "dbl_col_2", corr_v2);
+    assert(max_v.get_result() == 12.5);
+    assert(max_v.get_index() == max_pos + 100);
+    assert(std::fabs(sum_v.get_result() - sum) < 1e-9);
+    assert(std::fabs(corr_v.get_result() - corr_v2.get_result()) < 1e-12);
+}
+
+// -----------------------------------------------------------------------------
+
 int main(int, char *[]) {
 
     MyDataFrame::set_optimum_thread_level();
@@ -5250,6 +7497,26 @@ int main(int, char *[]) {
     test_get_view_by_rand();
     test_get_view_by_loc_location();
     test_get_view_by_idx_values();
+    test_io_format_binary();
+    test_read_csv2_parallel();
+    test_read_csv2_in_place();
+    test_write_csv2_buffered();
+    test_DataFrameReader();
+    test_thread_cost_model();
+    test_radix_sort();
+    test_hash_groupby();
+    test_parallel_groupby();
+    test_grouping();
+    test_join_strategies();
+    test_join_asof();
+    test_get_data_by_pred();
+    test_get_data_by_sel_parallel();
+    test_is_index_sorted();
+    test_rolling_updates();
+    test_rolling_order_stats();
+    test_fused_visit();
+    test_parallel_visit();
+    test_reduce_kernels();
 
     return (0);
 }
@@ -0,0 +1,461 @@
+// Hossein Moein
+// October 17, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <DataFrame/Utils/Threads/ThreadPool.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace hmdf;
+
+// ----------------------------------------------------------------------------
+
+// It sums [begin, end) by splitting it in half recursively. The left half is
+// dispatched and the caller runs other tasks while it waits for it.
+//
+static long nested_sum_(ThreadPool &thr_pool, long begin, long end)  {
+
+    if (end - begin <= 1000)  {
+        long    sum { 0 };
+
+        for (long i = begin; i < end; ++i)  sum += i;
+        return (sum);
+    }
+
+    const long  mid { begin + (end - begin) / 2 };
+    auto        left_fut =
+        thr_pool.dispatch(false, nested_sum_, std::ref(thr_pool), begin, mid);
+    const long  right { nested_sum_(thr_pool, mid, end) };
+
+    while (left_fut.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::timeout)
+        thr_pool.run_task();
+    return (left_fut.get() + right);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_nested_dispatch ()  {
+
+    std::cout << "Testing nested dispatch ..." << std::endl;
+
+    constexpr long  n { 1'000'000 };
+    constexpr long  expected { (n * (n - 1)) / 2 };
+
+    // With one or two threads, every pool thread ends up waiting on a
+    // dispatched task. It only finishes, if the waiters run the pending
+    // tasks themselves.
+    //
+    for (const long thr_cnt : { 1L, 2L, 4L })  {
+        ThreadPool  thr_pool (thr_cnt);
+
+        // From a pool thread, the children go to its own deque
+        //
+        auto    fut =
+            thr_pool.dispatch(false,
+                              nested_sum_, std::ref(thr_pool), 0L, n);
+
+        assert(fut.get() == expected);
+
+        // From outside the pool, the children go to the global queue
+        //
+        assert(nested_sum_(thr_pool, 0, n) == expected);
+        assert(thr_pool.pending_tasks() == 0);
+    }
+
+    // run_task() returns false when there is nothing to run
+    //
+    ThreadPool  thr_pool (2);
+
+    assert(! thr_pool.run_task());
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_stealing ()  {
+
+    std::cout << "Testing work stealing ..." << std::endl;
+
+    constexpr long  task_cnt { 10'000 };
+
+    ThreadPool  thr_pool (4);
+
+    // The parent runs on a pool thread, so its children are pushed to its
+    // own deque. If help is false, the parent never pops them and the other
+    // threads must steal all of them. If help is true, the parent pops from
+    // the bottom while the thieves steal from the top.
+    //
+    auto    parent =
+        [&thr_pool](std::vector<std::atomic<int>> &runs,
+                    std::atomic<long> &stolen,
+                    bool help) -> void  {
+            const auto          parent_id { std::this_thread::get_id() };
+            std::atomic<long>   done { 0 };
+
+            for (long i = 0; i < long(runs.size()); ++i)
+                thr_pool.dispatch(false,
+                                  [&runs, &stolen, &done, i, parent_id]()
+                                      -> void  {
+                                      runs[i] += 1;
+                                      if (std::this_thread::get_id() !=
+                                              parent_id)
+                                          stolen += 1;
+                                      done += 1;
+                                  });
+            while (done < long(runs.size()))
+                if (! help || ! thr_pool.run_task())
+                    std::this_thread::yield();
+        };
+
+    {
+        std::vector<std::atomic<int>>   runs(task_cnt);
+        std::atomic<long>               stolen { 0 };
+
+        thr_pool.dispatch(false, parent,
+                          std::ref(runs), std::ref(stolen), false).get();
+        for (const auto &r : runs)  assert(r == 1);
+        assert(stolen == task_cnt);
+    }
+
+    // Two parents pop their own deques, the other threads steal from both
+    // and the main thread keeps the global queue busy at the same time.
+    // Every task must run exactly once.
+    //
+    for (int round = 0; round < 20; ++round)  {
+        std::vector<std::atomic<int>>   runs1(task_cnt);
+        std::vector<std::atomic<int>>   runs2(task_cnt);
+        std::vector<std::atomic<int>>   runs3(task_cnt);
+        std::atomic<long>               stolen1 { 0 };
+        std::atomic<long>               stolen2 { 0 };
+        std::atomic<long>               stolen3 { 0 };
+
+        auto    fut1 =
+            thr_pool.dispatch(false, parent,
+                              std::ref(runs1), std::ref(stolen1), true);
+        auto    fut2 =
+            thr_pool.dispatch(false, parent,
+                              std::ref(runs2), std::ref(stolen2), true);
+
+        parent(runs3, stolen3, true);
+        fut1.get();
+        fut2.get();
+        for (const auto &r : runs1)  assert(r == 1);
+        for (const auto &r : runs2)  assert(r == 1);
+        for (const auto &r : runs3)  assert(r == 1);
+        assert(thr_pool.pending_tasks() == 0);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// A move-only callable that counts its live instances. With a small N it
+// fits in the WorkUnit buffer. With a big N it is stored on the heap.
+//
+template<std::size_t N>
+struct  LiveCallable  {
+
+    inline static std::atomic<long> live { 0 };
+
+    explicit LiveCallable(std::atomic<long> &calls) : calls_(&calls)  {
+
+        live += 1;
+    }
+    LiveCallable(LiveCallable &&that) noexcept : calls_(that.calls_)  {
+
+        live += 1;
+    }
+    LiveCallable(const LiveCallable &) = delete;
+    ~LiveCallable()  { live -= 1; }
+
+    long operator() (long val) const  {
+
+        if (val < 0)
+            throw std::invalid_argument("LiveCallable: Negative value");
+        *calls_ += 1;
+        return (val + long(N));
+    }
+
+    std::atomic<long>       *calls_;
+    std::array<char, N>     pad_ { };
+};
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t N>
+static void dispatch_live_(ThreadPool &thr_pool, long task_cnt)  {
+
+    std::atomic<long>               calls { 0 };
+    std::vector<std::future<long>>  futs;
+
+    futs.reserve(task_cnt);
+    for (long i = 0; i < task_cnt; ++i)
+        futs.push_back(
+            thr_pool.dispatch(false, LiveCallable<N> { calls }, i));
+    for (long i = 0; i < task_cnt; ++i)  {
+        while (futs[i].wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::timeout)
+            thr_pool.run_task();
+        assert(futs[i].get() == i + long(N));
+    }
+    assert(calls == task_cnt);
+
+    // The exception is delivered through the future and the callable is
+    // still destroyed
+    //
+    auto    fut = thr_pool.dispatch(false, LiveCallable<N> { calls }, -1L);
+    bool    thrown { false };
+
+    try  { fut.get(); }
+    catch (const std::invalid_argument &)  { thrown = true; }
+    assert(thrown);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_work_unit ()  {
+
+    std::cout << "Testing WorkUnit storage ..." << std::endl;
+
+    using small_t = LiveCallable<8>;
+    using big_t = LiveCallable<256>;
+
+    static_assert(sizeof(small_t) <= 32);
+    static_assert(sizeof(big_t) >= 256);
+
+    {
+        ThreadPool  thr_pool (3);
+
+        // Dispatched from outside the pool
+        //
+        dispatch_live_<8>(thr_pool, 2'000);
+        dispatch_live_<256>(thr_pool, 2'000);
+
+        // Dispatched from pool threads. Their work units and future states
+        // come from the per-thread block cache, and are freed on whichever
+        // thread runs them.
+        //
+        for (int round = 0; round < 10; ++round)  {
+            auto    fut1 =
+                thr_pool.dispatch(false, dispatch_live_<8>,
+                                  std::ref(thr_pool), 2'000L);
+            auto    fut2 =
+                thr_pool.dispatch(false, dispatch_live_<256>,
+                                  std::ref(thr_pool), 2'000L);
+
+            fut1.get();
+            fut2.get();
+        }
+    }
+
+    // Once the pool is gone, every work unit has been destroyed
+    //
+    assert(small_t::live == 0);
+    assert(big_t::live == 0);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_parallel_loop ()  {
+
+    std::cout << "Testing parallel_loop ..." << std::endl;
+
+    using block_t = std::pair<long, long>;
+
+    ThreadPool  thr_pool (4);
+
+    // The blocks come back in order, cover [begin, end) without gaps or
+    // overlaps, and differ in size by at most one item
+    //
+    for (const long n : { 0L, 1L, 5L, 16L, 1'001L })  {
+        for (const long blocks : { -1L, 0L, 1L, 3L, 4L, 7L, 16L, 5'000L })  {
+            auto    futs =
+                thr_pool.parallel_loop(
+                    blocks, 0L, n,
+                    [](long begin, long end) -> block_t  {
+                        return (block_t { begin, end });
+                    });
+
+            if (n == 0)  {
+                assert(futs.empty());
+                continue;
+            }
+            assert(long(futs.size()) == std::clamp(blocks, 1L, n));
+
+            long    prev_end { 0 };
+            long    prev_size { n };
+
+            for (auto &fut : futs)  {
+                const block_t   block = fut.get();
+                const long      size { block.second - block.first };
+
+                assert(block.first == prev_end);
+                assert(size >= 1);
+                assert(size <= prev_size);  // Bigger blocks come first
+                assert(size >= n / long(futs.size()));
+                prev_end = block.second;
+                prev_size = size;
+            }
+            assert(prev_end == n);
+        }
+    }
+
+    // Every item is visited exactly once
+    //
+    std::vector<int>    vec(10'007, 0);
+    auto                futs =
+        thr_pool.parallel_loop(vec.begin(), vec.end(),
+                               [](auto begin, auto end) -> void  {
+                                   for ( ; begin != end; ++begin)
+                                       *begin += 1;
+                               });
+
+    for (auto &fut : futs)  fut.get();
+    assert(futs.size() == 4);
+    assert(std::ranges::all_of(vec, [](int v) -> bool { return (v == 1); }));
+
+    // The second range is split at the same points as the first
+    //
+    std::vector<long>   vec1(10'007);
+    std::vector<long>   vec2(20'000, 0);
+
+    std::iota(vec1.begin(), vec1.end(), 0L);
+
+    auto    futs2 =
+        thr_pool.parallel_loop2(7, vec1.cbegin(), vec1.cend(),
+                                vec2.begin(), vec2.end(),
+                                [](auto begin1, auto end1, auto begin2)
+                                    -> void  {
+                                    for ( ; begin1 != end1; ++begin1, ++begin2)
+                                        *begin2 = *begin1 + 1;
+                                });
+
+    for (auto &fut : futs2)  fut.get();
+    assert(futs2.size() == 7);
+    for (long i = 0; i < long(vec2.size()); ++i)
+        assert(vec2[i] == (i < long(vec1.size()) ? i + 1 : 0));
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_parallel_sort ()  {
+
+    std::cout << "Testing parallel_sort ..." << std::endl;
+
+    constexpr long      n { 100'007 };
+    constexpr long      th { 1'000 };  // So the runs are sorted and merged
+    std::mt19937_64     gen { 123 };
+    ThreadPool          thr_pool (4);
+
+    std::vector<long>   random(n);
+    std::vector<long>   dups(n);
+    std::vector<long>   sorted(n);
+    std::vector<long>   reverse(n);
+    std::vector<long>   nearly(n);
+
+    for (long i = 0; i < n; ++i)  {
+        random[i] = long(gen() % 1'000'000'000);
+        dups[i] = long(gen() % 10);
+        sorted[i] = i;
+        reverse[i] = n - i;
+        nearly[i] = i;
+    }
+    for (long i = 0; i < 100; ++i)
+        std::swap(nearly[gen() % n], nearly[gen() % n]);
+
+    for (auto *vec : { &random, &dups, &sorted, &reverse, &nearly })  {
+        std::vector<long>   expected = *vec;
+        std::vector<long>   expected_desc = *vec;
+
+        std::ranges::sort(expected);
+        std::ranges::sort(expected_desc, std::greater<long> { });
+
+        std::vector<long>   result = *vec;
+
+        thr_pool.parallel_sort<std::vector<long>::iterator, th>
+            (result.begin(), result.end());
+        assert(result == expected);
+
+        result = *vec;
+        thr_pool.parallel_sort<std::vector<long>::iterator,
+                               std::greater<long>,
+                               th>
+            (result.begin(), result.end(), std::greater<long> { });
+        assert(result == expected_desc);
+
+        // With the default threshold it is sorted on one thread
+        //
+        result = *vec;
+        thr_pool.parallel_sort(result.begin(), result.end());
+        assert(result == expected);
+    }
+
+    // Non-trivial value type, fewer items than threads and an empty range
+    //
+    std::vector<std::string>    strs { "d", "a", "c", "b", "e" };
+
+    thr_pool.parallel_sort<std::vector<std::string>::iterator, 1>
+        (strs.begin(), strs.end());
+    assert((strs == std::vector<std::string> { "a", "b", "c", "d", "e" }));
+    thr_pool.parallel_sort(strs.begin(), strs.begin());
+}
+
+// ----------------------------------------------------------------------------
+
+int main (int, char *[])  {
+
+    test_nested_dispatch();
+    test_stealing();
+    test_work_unit();
+    test_parallel_loop();
+    test_parallel_sort();
+
+    return (EXIT_SUCCESS);
+}
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End: